@@ -0,0 +1,87 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "Benchmark.h"
+
+#include <GLTFSDK/ResourceReaderUtils.h>
+
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+
+using namespace Microsoft::glTF;
+
+namespace
+{
+    // The per-character decoder Base64Decode used before decoding blocks of characters with SIMD kernels
+    std::vector<uint8_t> Base64DecodePerChar(const std::string& encodedData)
+    {
+        static const std::vector<uint8_t> decodeTable = GetDecodeTable();
+
+        const Base64StringView encodedView(encodedData);
+
+        std::vector<uint8_t> decodedData(encodedView.GetByteCount());
+        uint8_t* decodedBytePtr = decodedData.data();
+
+        uint32_t block = 0U;
+        uint32_t blockBits = 0U;
+
+        for (const auto encodedChar : encodedView)
+        {
+            const auto index = static_cast<uint8_t>(encodedChar);
+
+            if (index >= decodeTable.size() || decodeTable[index] == std::numeric_limits<uint8_t>::max())
+            {
+                throw std::runtime_error("Invalid base64 character");
+            }
+
+            block = (block << 6U) | decodeTable[index];
+            blockBits += 6U;
+
+            if (blockBits >= 8U)
+            {
+                blockBits -= 8U;
+                *(decodedBytePtr++) = static_cast<uint8_t>(block >> blockBits);
+                block &= (1U << blockBits) - 1U;
+            }
+        }
+
+        return decodedData;
+    }
+}
+
+namespace Benchmark
+{
+    void BenchmarkBase64Decode(size_t byteCount, size_t iterationCount)
+    {
+        std::string encodedData;
+        encodedData.reserve(ByteCountToCharCount(byteCount) + 4U);
+
+        for (size_t i = 0U; i < byteCount; i += 3U)
+        {
+            encodedData.push_back(characterSet[(i * 7U) % 64U]);
+            encodedData.push_back(characterSet[(i * 11U + 5U) % 64U]);
+            encodedData.push_back(characterSet[(i * 13U + 9U) % 64U]);
+            encodedData.push_back(characterSet[(i * 17U + 3U) % 64U]);
+        }
+
+        std::vector<uint8_t> perCharData;
+        std::vector<uint8_t> vectorData;
+
+        const double perChar = Measure(iterationCount, [&]() { perCharData = Base64DecodePerChar(encodedData); });
+        const double vector = Measure(iterationCount, [&]() { vectorData = Base64Decode(encodedData); });
+
+        if (perCharData != vectorData)
+        {
+            throw std::runtime_error("Vectorized base64 decode results don't match the per-character decoder");
+        }
+
+        std::cout << "Base64 decode, " << encodedData.size() << " characters\n";
+
+        PrintResult("per-character", perChar, vectorData.size());
+        PrintResult("vectorized", vector, vectorData.size());
+
+        std::cout << "  speedup " << std::setprecision(1) << (perChar / vector) << "x\n";
+    }
+}
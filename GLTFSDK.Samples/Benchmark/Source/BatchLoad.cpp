@@ -0,0 +1,102 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "Benchmark.h"
+
+#include <GLTFSDK/BatchLoader.h>
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+using namespace Microsoft::glTF;
+
+namespace
+{
+    // Reads an asset's files from the directory the asset root refers to
+    class FileStreamReader : public IStreamReader
+    {
+    public:
+        explicit FileStreamReader(std::filesystem::path root) : m_root(std::move(root))
+        {
+        }
+
+        std::shared_ptr<std::istream> GetInputStream(const std::string& filename) const override
+        {
+            return std::make_shared<std::ifstream>(m_root / filename, std::ios_base::binary);
+        }
+
+    private:
+        std::filesystem::path m_root;
+    };
+
+    // Every .gltf and .glb file in the directory and its subdirectories
+    std::vector<BatchAsset> FindAssets(const std::filesystem::path& directory)
+    {
+        std::vector<BatchAsset> assets;
+
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(directory))
+        {
+            const auto extension = entry.path().extension();
+
+            if (entry.is_regular_file() && (extension == ".gltf" || extension == ".glb"))
+            {
+                assets.push_back({ entry.path().parent_path().string(), entry.path().filename().string() });
+            }
+        }
+
+        return assets;
+    }
+}
+
+namespace Benchmark
+{
+    void BenchmarkBatchLoad(const std::filesystem::path& resourcesDirectory, size_t iterationCount)
+    {
+        if (!std::filesystem::is_directory(resourcesDirectory))
+        {
+            std::cout << "Batch load, skipped as " << resourcesDirectory.string() << " was not found\n";
+            return;
+        }
+
+        // Load the corpus several times over so that there is enough work to spread across the threads
+        std::vector<BatchAsset> assets;
+
+        for (size_t i = 0U; i < 20U; ++i)
+        {
+            auto corpus = FindAssets(resourcesDirectory);
+            assets.insert(assets.end(), corpus.begin(), corpus.end());
+        }
+
+        const auto streamReaderFactory = [](const std::string& root) { return std::make_shared<FileStreamReader>(root); };
+
+        BatchLoaderOptions options;
+        options.decodeAccessors = true;
+
+        BatchLoader loader(streamReaderFactory, options);
+
+        size_t failureCount = 0U;
+
+        for (const auto& result : loader.Load(assets))
+        {
+            failureCount += result.IsSuccess() ? 0U : 1U;
+        }
+
+        const auto manifestByteCount = loader.GetStats().manifestByteCount;
+
+        const double sequential = Measure(iterationCount, [&]() { loader.Load(assets, SequentialExecutor()); });
+
+        loader.ResetStats();
+
+        const double batched = Measure(iterationCount, [&]() { loader.Load(assets); });
+
+        std::cout << "Batch load, " << assets.size() << " assets (" << failureCount << " failed) on "
+                  << ThreadExecutor().GetThreadCount() << " threads\n";
+
+        PrintResult("sequential", sequential, manifestByteCount);
+        PrintResult("batched", batched, manifestByteCount);
+
+        std::cout << "  " << std::setprecision(0) << loader.GetStats().GetAssetsPerSecond() << " assets/s batched\n";
+        std::cout << "  speedup " << std::setprecision(1) << (sequential / batched) << "x\n";
+    }
+}
@@ -0,0 +1,54 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "Benchmark.h"
+
+#include <GLTFSDK/Serialize.h>
+
+#include <iomanip>
+#include <iostream>
+
+using namespace Microsoft::glTF;
+
+namespace Benchmark
+{
+    void PrintResult(const char* name, double milliseconds, size_t byteCount)
+    {
+        const double megabytesPerSecond = (static_cast<double>(byteCount) / (1024.0 * 1024.0)) / (milliseconds / 1000.0);
+
+        std::cout << "  " << std::left << std::setw(24) << name
+                  << std::right << std::fixed << std::setprecision(2) << std::setw(10) << milliseconds << " ms"
+                  << std::setw(12) << megabytesPerSecond << " MB/s\n";
+    }
+
+    std::string CreateLargeManifest(size_t elementCount)
+    {
+        auto document = Document::create();
+
+        for (size_t i = 0U; i < elementCount; ++i)
+        {
+            Accessor accessor;
+            accessor.componentType = COMPONENT_FLOAT;
+            accessor.type = TYPE_VEC3;
+            accessor.count = 1U + i % 1000U;
+            accessor.min = { -1.0f, -1.0f, -1.0f };
+            accessor.max = { 1.0f, 1.0f, 1.0f };
+            document->accessors.Append(std::move(accessor), AppendIdPolicy::GenerateOnEmpty);
+
+            MeshPrimitive primitive;
+            primitive.attributes[ACCESSOR_POSITION] = std::to_string(i);
+
+            Mesh mesh;
+            mesh.primitives.push_back(std::move(primitive));
+            document->meshes.Append(std::move(mesh), AppendIdPolicy::GenerateOnEmpty);
+
+            Node node;
+            node.name = "node" + std::to_string(i);
+            node.meshId = std::to_string(i);
+            node.translation = { static_cast<float>(i), 0.0f, 0.0f };
+            document->nodes.Append(std::move(node), AppendIdPolicy::GenerateOnEmpty);
+        }
+
+        return Serializer::Serialize(document);
+    }
+}
@@ -0,0 +1,78 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/GLTF.h>
+#include <GLTFSDK/GLTFResourceReader.h>
+#include <GLTFSDK/MemoryStream.h>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Benchmark
+{
+    // Serves a single in-memory buffer so that the benchmarks measure the resource reader rather than file I/O
+    class MemoryStreamReader : public Microsoft::glTF::IStreamReader
+    {
+    public:
+        explicit MemoryStreamReader(std::shared_ptr<const std::vector<uint8_t>> data) : m_data(std::move(data))
+        {
+        }
+
+        std::shared_ptr<std::istream> GetInputStream(const std::string&) const override
+        {
+            return std::make_shared<Microsoft::glTF::MemoryStream>(std::span<const uint8_t>(*m_data), m_data);
+        }
+
+        std::shared_ptr<const Microsoft::glTF::IRandomAccessReader> GetRandomAccessReader(const std::string&) const override
+        {
+            return std::make_shared<Microsoft::glTF::MemoryRandomAccessReader>(std::span<const uint8_t>(*m_data), m_data);
+        }
+
+    private:
+        std::shared_ptr<const std::vector<uint8_t>> m_data;
+    };
+
+    // Runs fn the specified number of times and returns the fastest run in milliseconds
+    template<typename Fn>
+    double Measure(size_t iterationCount, Fn&& fn)
+    {
+        double best = std::numeric_limits<double>::max();
+
+        for (size_t i = 0U; i < iterationCount; ++i)
+        {
+            const auto begin = std::chrono::steady_clock::now();
+            fn();
+            const auto end = std::chrono::steady_clock::now();
+
+            best = std::min(best, std::chrono::duration<double, std::milli>(end - begin).count());
+        }
+
+        return best;
+    }
+
+    // Prints a benchmark result as its duration and the throughput of byteCount bytes
+    void PrintResult(const char* name, double milliseconds, size_t byteCount);
+
+    // A manifest with elementCount accessors, meshes and nodes, the shape of a large scene exported from a DCC tool
+    std::string CreateLargeManifest(size_t elementCount);
+
+    // Each benchmark is defined in its own source file and compares a code path with the one it replaced
+    void BenchmarkInterleavedRead(size_t vertexCount, size_t iterationCount);
+    void BenchmarkQuantizedRead(size_t vertexCount, size_t iterationCount);
+    void BenchmarkBase64Decode(size_t byteCount, size_t iterationCount);
+    void BenchmarkDeserialize(size_t elementCount, size_t iterationCount);
+    void BenchmarkPeek(size_t elementCount, size_t iterationCount);
+    void BenchmarkSerialize(size_t elementCount, size_t iterationCount);
+    void BenchmarkMemoryResource(size_t elementCount, size_t iterationCount);
+    void BenchmarkHandles(size_t elementCount, size_t iterationCount);
+    void BenchmarkRemove(size_t elementCount, size_t iterationCount);
+    void BenchmarkDocumentIndex(size_t elementCount, size_t iterationCount);
+    void BenchmarkBatchLoad(const std::filesystem::path& resourcesDirectory, size_t iterationCount);
+}
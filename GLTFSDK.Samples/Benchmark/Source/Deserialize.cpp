@@ -0,0 +1,50 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "Benchmark.h"
+
+#include <GLTFSDK/Deserialize.h>
+
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+
+using namespace Microsoft::glTF;
+
+namespace Benchmark
+{
+    namespace
+    {
+        void BenchmarkDeserialize(const std::string& manifest, SchemaFlags schemaFlags, size_t iterationCount)
+        {
+            std::shared_ptr<Document> domDocument;
+            std::shared_ptr<Document> streamingDocument;
+
+            const double dom = Measure(iterationCount, [&]() { domDocument = Deserializer::Deserialize(manifest, schemaFlags); });
+            const double streaming = Measure(iterationCount, [&]() { streamingDocument = Deserializer::DeserializeStreaming(manifest, schemaFlags); });
+
+            if (!(*domDocument == *streamingDocument))
+            {
+                throw std::runtime_error("Streaming deserialization results don't match the DOM deserializer");
+            }
+
+            PrintResult("DOM", dom, manifest.size());
+            PrintResult("streaming", streaming, manifest.size());
+
+            std::cout << "  speedup " << std::setprecision(1) << (dom / streaming) << "x\n";
+        }
+    }
+
+    void BenchmarkDeserialize(size_t elementCount, size_t iterationCount)
+    {
+        const auto manifest = CreateLargeManifest(elementCount);
+
+        // Validated elements still go through a DOM of their own
+        std::cout << "Deserialize, " << elementCount << " accessors, meshes and nodes\n";
+        BenchmarkDeserialize(manifest, SchemaFlags::None, iterationCount);
+
+        // Without validation accessors, meshes and nodes are read without any DOM
+        std::cout << "Deserialize without validation, " << elementCount << " accessors, meshes and nodes\n";
+        BenchmarkDeserialize(manifest, SchemaFlags::DisableSchemaRoot, iterationCount);
+    }
+}
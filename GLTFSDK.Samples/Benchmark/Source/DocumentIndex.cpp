@@ -0,0 +1,74 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "Benchmark.h"
+
+#include <GLTFSDK/Deserialize.h>
+#include <GLTFSDK/DocumentIndex.h>
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+
+using namespace Microsoft::glTF;
+
+namespace Benchmark
+{
+    // Finds the nodes that use each of the first thousand meshes, scanning the nodes and looking them up in an index
+    void BenchmarkDocumentIndex(size_t elementCount, size_t iterationCount)
+    {
+        const auto manifest = CreateLargeManifest(elementCount);
+        const auto document = Deserializer::Deserialize(manifest);
+
+        const size_t queryCount = std::min<size_t>(document->meshes.Size(), 1000U);
+
+        size_t scanCount = 0U;
+        size_t indexCount = 0U;
+
+        const double scan = Measure(iterationCount, [&]()
+        {
+            scanCount = 0U;
+
+            for (size_t i = 0U; i < queryCount; ++i)
+            {
+                const auto& meshId = document->meshes[i].id;
+
+                for (const auto& node : document->nodes.Elements())
+                {
+                    scanCount += (node.meshId == meshId) ? 1U : 0U;
+                }
+            }
+        });
+
+        DocumentIndex index;
+
+        const double build = Measure(iterationCount, [&]() { index = DocumentIndex(*document); });
+
+        const double lookup = Measure(iterationCount, [&]()
+        {
+            indexCount = 0U;
+
+            for (size_t i = 0U; i < queryCount; ++i)
+            {
+                for (const auto& element : index.GetReferencedBy({ DocumentCollections::Meshes, i }))
+                {
+                    indexCount += (element.collection == DocumentCollections::Nodes) ? 1U : 0U;
+                }
+            }
+        });
+
+        if (scanCount != indexCount)
+        {
+            throw std::runtime_error("The document index doesn't match scanning the nodes");
+        }
+
+        std::cout << "Find the nodes using " << queryCount << " meshes, " << elementCount << " nodes, meshes and accessors\n";
+
+        PrintResult("scan", scan, manifest.size());
+        PrintResult("DocumentIndex build", build, manifest.size());
+        PrintResult("DocumentIndex lookup", lookup, manifest.size());
+
+        std::cout << "  speedup " << std::setprecision(1) << (scan / (build + lookup)) << "x including the build\n";
+    }
+}
@@ -0,0 +1,65 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "Benchmark.h"
+
+#include <GLTFSDK/Deserialize.h>
+#include <GLTFSDK/DocumentHandles.h>
+
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+
+using namespace Microsoft::glTF;
+
+namespace Benchmark
+{
+    // Sums the vertex count of every node's mesh, following the references node -> mesh -> accessor
+    void BenchmarkHandles(size_t elementCount, size_t iterationCount)
+    {
+        const auto manifest = CreateLargeManifest(elementCount);
+        const auto document = Deserializer::Deserialize(manifest);
+
+        size_t stringIdCount = 0U;
+        size_t handleCount = 0U;
+
+        const double stringIds = Measure(iterationCount, [&]()
+        {
+            stringIdCount = 0U;
+
+            for (const auto& node : document->nodes.Elements())
+            {
+                const auto& primitive = document->meshes[node.meshId].primitives.front();
+                stringIdCount += document->accessors[primitive.GetAttributeAccessorId(ACCESSOR_POSITION)].count;
+            }
+        });
+
+        DocumentHandles handles;
+
+        const double resolve = Measure(iterationCount, [&]() { handles = DocumentHandles::Resolve(*document); });
+
+        const double handleIds = Measure(iterationCount, [&]()
+        {
+            handleCount = 0U;
+
+            for (const auto& node : handles.nodes)
+            {
+                const auto& primitive = handles.meshes[node.mesh.index].primitives.front();
+                handleCount += document->accessors[primitive.attributes.front().second].count;
+            }
+        });
+
+        if (stringIdCount != handleCount)
+        {
+            throw std::runtime_error("Traversing handles doesn't match traversing string ids");
+        }
+
+        std::cout << "Traverse references, " << elementCount << " nodes, meshes and accessors\n";
+
+        PrintResult("string ids", stringIds, manifest.size());
+        PrintResult("DocumentHandles::Resolve", resolve, manifest.size());
+        PrintResult("handles", handleIds, manifest.size());
+
+        std::cout << "  speedup " << std::setprecision(1) << (stringIds / handleIds) << "x\n";
+    }
+}
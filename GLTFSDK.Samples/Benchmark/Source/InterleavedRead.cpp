@@ -0,0 +1,122 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "Benchmark.h"
+
+#include <GLTFSDK/StreamUtils.h>
+
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+
+using namespace Microsoft::glTF;
+
+namespace
+{
+    // The per-element path GLTFResourceReader used for interleaved accessors before reading in bulk: one seek and
+    // one read for every element
+    std::vector<float> ReadInterleavedPerElement(std::istream& stream, const Document& document, const Accessor& accessor)
+    {
+        const BufferView& bufferView = document.bufferViews.Get(accessor.bufferViewId);
+
+        const size_t elementSize = sizeof(float) * Accessor::GetTypeCount(accessor.type);
+        const size_t stride = bufferView.byteStride.Get();
+
+        std::vector<float> data(accessor.count * Accessor::GetTypeCount(accessor.type));
+        std::streamoff position = bufferView.byteOffset + accessor.byteOffset;
+
+        for (size_t i = 0U; i < accessor.count; ++i, position += stride)
+        {
+            stream.seekg(position);
+            StreamUtils::ReadBinary(stream, reinterpret_cast<char*>(data.data()) + i * elementSize, elementSize);
+        }
+
+        return data;
+    }
+
+    // Scales up the layout of the BoxInterleaved sample: a single bufferView interleaving a VEC3 position and a VEC3
+    // normal per vertex (a 24 byte stride) with an accessor for each attribute
+    std::shared_ptr<const std::vector<uint8_t>> CreateInterleavedDocument(Document& document, size_t vertexCount)
+    {
+        const size_t stride = 6U * sizeof(float);
+
+        auto data = std::make_shared<std::vector<uint8_t>>(vertexCount * stride);
+
+        for (size_t i = 0U; i < vertexCount * 6U; ++i)
+        {
+            const float value = static_cast<float>(i % 1021U) * 0.25f;
+            std::memcpy(data->data() + i * sizeof(float), &value, sizeof(float));
+        }
+
+        Buffer buffer;
+        buffer.uri = "interleaved.bin";
+        buffer.byteLength = data->size();
+
+        auto bufferId = document.buffers.Append(std::move(buffer), AppendIdPolicy::GenerateOnEmpty).id;
+
+        BufferView bufferView;
+        bufferView.bufferId = bufferId;
+        bufferView.byteLength = data->size();
+        bufferView.byteStride = stride;
+        bufferView.target = BufferViewTarget::ARRAY_BUFFER;
+
+        auto bufferViewId = document.bufferViews.Append(std::move(bufferView), AppendIdPolicy::GenerateOnEmpty).id;
+
+        for (size_t attributeOffset : { size_t(0U), 3U * sizeof(float) })
+        {
+            Accessor accessor;
+            accessor.bufferViewId = bufferViewId;
+            accessor.byteOffset = attributeOffset;
+            accessor.componentType = COMPONENT_FLOAT;
+            accessor.type = TYPE_VEC3;
+            accessor.count = vertexCount;
+
+            document.accessors.Append(std::move(accessor), AppendIdPolicy::GenerateOnEmpty);
+        }
+
+        return data;
+    }
+}
+
+namespace Benchmark
+{
+    void BenchmarkInterleavedRead(size_t vertexCount, size_t iterationCount)
+    {
+        auto documentPtr = Document::create();
+        auto& document = *documentPtr;
+
+        auto data = CreateInterleavedDocument(document, vertexCount);
+
+        GLTFResourceReader reader(std::make_shared<MemoryStreamReader>(data));
+        MemoryStream stream(*data);
+
+        std::cout << "Interleaved VEC3 float accessors, " << vertexCount << " vertices, 24 byte stride\n";
+
+        for (const auto& accessor : document.accessors.Elements())
+        {
+            const size_t byteCount = accessor.count * 3U * sizeof(float);
+
+            std::vector<float> perElementData;
+            std::vector<float> bulkData;
+            std::vector<float> outputData(accessor.count * 3U);
+
+            const double perElement = Measure(iterationCount, [&]() { perElementData = ReadInterleavedPerElement(stream, document, accessor); });
+            const double bulk = Measure(iterationCount, [&]() { bulkData = reader.ReadBinaryData<float>(document, accessor); });
+            const double bulkInto = Measure(iterationCount, [&]() { reader.ReadBinaryData<float>(document, accessor, outputData); });
+
+            if (perElementData != bulkData || perElementData != outputData)
+            {
+                throw std::runtime_error("Bulk read results don't match the per-element read");
+            }
+
+            std::cout << " Accessor " << accessor.id << ":\n";
+
+            PrintResult("per-element", perElement, byteCount);
+            PrintResult("bulk + gather", bulk, byteCount);
+            PrintResult("bulk + gather (into)", bulkInto, byteCount);
+
+            std::cout << "  speedup " << std::setprecision(1) << (perElement / bulkInto) << "x\n";
+        }
+    }
+}
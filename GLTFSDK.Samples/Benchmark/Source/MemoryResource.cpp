@@ -0,0 +1,43 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "Benchmark.h"
+
+#include <GLTFSDK/Deserialize.h>
+
+#include <iomanip>
+#include <iostream>
+#include <memory_resource>
+
+using namespace Microsoft::glTF;
+
+namespace Benchmark
+{
+    // Deserializes and destroys a document with the indices of its top-level arrays' ids allocated from the heap and
+    // from an arena. Only the index nodes come from the arena, the elements are allocated from the heap either way.
+    void BenchmarkMemoryResource(size_t elementCount, size_t iterationCount)
+    {
+        const auto manifest = CreateLargeManifest(elementCount);
+
+        DeserializeOptions options;
+        options.schemaFlags = SchemaFlags::DisableSchemaRoot;
+
+        const double heap = Measure(iterationCount, [&]() { Deserializer::Deserialize(manifest, options); });
+
+        const double arena = Measure(iterationCount, [&]()
+        {
+            std::pmr::monotonic_buffer_resource resource;
+
+            options.memoryResource = &resource;
+            Deserializer::Deserialize(manifest, options);
+            options.memoryResource = nullptr;
+        });
+
+        std::cout << "Load and destroy, id indices of " << elementCount << " accessors, meshes and nodes\n";
+
+        PrintResult("default resource", heap, manifest.size());
+        PrintResult("monotonic arena", arena, manifest.size());
+
+        std::cout << "  speedup " << std::setprecision(1) << (heap / arena) << "x\n";
+    }
+}
@@ -0,0 +1,38 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "Benchmark.h"
+
+#include <GLTFSDK/Deserialize.h>
+
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+
+using namespace Microsoft::glTF;
+
+namespace Benchmark
+{
+    void BenchmarkPeek(size_t elementCount, size_t iterationCount)
+    {
+        const auto manifest = CreateLargeManifest(elementCount);
+
+        std::shared_ptr<Document> document;
+        DocumentSummary summary;
+
+        const double deserialize = Measure(iterationCount, [&]() { document = Deserializer::Deserialize(manifest); });
+        const double peek = Measure(iterationCount, [&]() { summary = Deserializer::Peek(manifest); });
+
+        if (summary.accessorCount != document->accessors.Size() || summary.nodeCount != document->nodes.Size() || summary.generator != document->asset.generator)
+        {
+            throw std::runtime_error("Peek results don't match the deserialized document");
+        }
+
+        std::cout << "Peek, " << elementCount << " accessors, meshes and nodes\n";
+
+        PrintResult("Deserialize", deserialize, manifest.size());
+        PrintResult("Peek", peek, manifest.size());
+
+        std::cout << "  speedup " << std::setprecision(1) << (deserialize / peek) << "x\n";
+    }
+}
@@ -0,0 +1,112 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "Benchmark.h"
+
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+
+using namespace Microsoft::glTF;
+
+namespace
+{
+    // The two pass decode ReadFloatData used before converting components with SIMD kernels as they are read: the
+    // raw components are read into a vector and then converted one at a time
+    std::vector<float> ReadFloatDataTwoPass(const GLTFResourceReader& reader, const Document& document, const Accessor& accessor)
+    {
+        const std::vector<uint16_t> rawData = reader.ReadBinaryData<uint16_t>(document, accessor);
+
+        std::vector<float> floatData;
+        floatData.reserve(rawData.size());
+
+        for (size_t i = 0; i < rawData.size(); ++i)
+        {
+            floatData.push_back(ComponentToFloat(rawData[i]));
+        }
+
+        return floatData;
+    }
+
+    // A quantized mesh layout: a single bufferView interleaving a normalized unsigned short VEC3 position (padded to
+    // 8 bytes) and a normalized unsigned short VEC2 texture coordinate per vertex (a 12 byte stride)
+    std::shared_ptr<const std::vector<uint8_t>> CreateQuantizedDocument(Document& document, size_t vertexCount)
+    {
+        const size_t stride = 12U;
+
+        auto data = std::make_shared<std::vector<uint8_t>>(vertexCount * stride);
+
+        for (size_t i = 0U; i < data->size(); ++i)
+        {
+            (*data)[i] = static_cast<uint8_t>(i * 31U + 7U);
+        }
+
+        Buffer buffer;
+        buffer.uri = "quantized.bin";
+        buffer.byteLength = data->size();
+
+        auto bufferId = document.buffers.Append(std::move(buffer), AppendIdPolicy::GenerateOnEmpty).id;
+
+        BufferView bufferView;
+        bufferView.bufferId = bufferId;
+        bufferView.byteLength = data->size();
+        bufferView.byteStride = stride;
+        bufferView.target = BufferViewTarget::ARRAY_BUFFER;
+
+        auto bufferViewId = document.bufferViews.Append(std::move(bufferView), AppendIdPolicy::GenerateOnEmpty).id;
+
+        for (auto [attributeOffset, attributeType] : { std::pair(size_t(0U), TYPE_VEC3), std::pair(size_t(8U), TYPE_VEC2) })
+        {
+            Accessor accessor;
+            accessor.bufferViewId = bufferViewId;
+            accessor.byteOffset = attributeOffset;
+            accessor.componentType = COMPONENT_UNSIGNED_SHORT;
+            accessor.normalized = true;
+            accessor.type = attributeType;
+            accessor.count = vertexCount;
+
+            document.accessors.Append(std::move(accessor), AppendIdPolicy::GenerateOnEmpty);
+        }
+
+        return data;
+    }
+}
+
+namespace Benchmark
+{
+    void BenchmarkQuantizedRead(size_t vertexCount, size_t iterationCount)
+    {
+        auto documentPtr = Document::create();
+        auto& document = *documentPtr;
+
+        auto data = CreateQuantizedDocument(document, vertexCount);
+
+        GLTFResourceReader reader(std::make_shared<MemoryStreamReader>(data));
+
+        std::cout << "Interleaved normalized unsigned short accessors read as floats, " << vertexCount << " vertices, 12 byte stride\n";
+
+        for (const auto& accessor : document.accessors.Elements())
+        {
+            const size_t byteCount = accessor.count * Accessor::GetTypeCount(accessor.type) * sizeof(float);
+
+            std::vector<float> twoPassData;
+            std::vector<float> fusedData;
+
+            const double twoPass = Measure(iterationCount, [&]() { twoPassData = ReadFloatDataTwoPass(reader, document, accessor); });
+            const double fused = Measure(iterationCount, [&]() { fusedData = reader.ReadFloatData(document, accessor); });
+
+            if (twoPassData != fusedData)
+            {
+                throw std::runtime_error("Fused float conversion results don't match the two pass conversion");
+            }
+
+            std::cout << " Accessor " << accessor.id << ":\n";
+
+            PrintResult("read + convert", twoPass, byteCount);
+            PrintResult("fused", fused, byteCount);
+
+            std::cout << "  speedup " << std::setprecision(1) << (twoPass / fused) << "x\n";
+        }
+    }
+}
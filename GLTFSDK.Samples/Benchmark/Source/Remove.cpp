@@ -0,0 +1,51 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "Benchmark.h"
+
+#include <GLTFSDK/Deserialize.h>
+
+#include <iomanip>
+#include <iostream>
+
+using namespace Microsoft::glTF;
+
+namespace Benchmark
+{
+    // Removes every other accessor of a copy of the accessors one at a time and in a single pass
+    void BenchmarkRemove(size_t elementCount, size_t iterationCount)
+    {
+        const auto manifest = CreateLargeManifest(elementCount);
+        const auto document = Deserializer::Deserialize(manifest);
+
+        std::vector<std::string> removedIds;
+
+        for (size_t i = 0U; i < document->accessors.Size(); i += 2U)
+        {
+            removedIds.push_back(document->accessors[i].id);
+        }
+
+        const double oneByOne = Measure(iterationCount, [&]()
+        {
+            auto accessors = document->accessors;
+
+            for (const auto& id : removedIds)
+            {
+                accessors.Remove(id);
+            }
+        });
+
+        const double batched = Measure(iterationCount, [&]()
+        {
+            auto accessors = document->accessors;
+            accessors.RemoveMany(removedIds);
+        });
+
+        std::cout << "Remove " << removedIds.size() << " of " << document->accessors.Size() << " accessors\n";
+
+        PrintResult("Remove", oneByOne, manifest.size());
+        PrintResult("RemoveMany", batched, manifest.size());
+
+        std::cout << "  speedup " << std::setprecision(1) << (oneByOne / batched) << "x\n";
+    }
+}
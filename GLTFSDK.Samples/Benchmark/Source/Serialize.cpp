@@ -0,0 +1,46 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "Benchmark.h"
+
+#include <GLTFSDK/Deserialize.h>
+#include <GLTFSDK/Serialize.h>
+
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+using namespace Microsoft::glTF;
+
+namespace Benchmark
+{
+    // Serializes a document via a DOM of the whole manifest and straight to a stream
+    void BenchmarkSerialize(size_t elementCount, size_t iterationCount)
+    {
+        const auto document = Deserializer::Deserialize(CreateLargeManifest(elementCount));
+
+        std::string dom;
+        std::string streamed;
+
+        const double domTime = Measure(iterationCount, [&]() { dom = Serializer::Serialize(document, true); });
+        const double streamTime = Measure(iterationCount, [&]()
+        {
+            std::ostringstream stream;
+            Serializer::Serialize(*document, stream, true);
+            streamed = std::move(stream).str();
+        });
+
+        if (dom != streamed)
+        {
+            throw std::runtime_error("The streamed manifest doesn't match the DOM's");
+        }
+
+        std::cout << "Serialize, " << elementCount << " accessors, meshes and nodes\n";
+
+        PrintResult("DOM", domTime, dom.size());
+        PrintResult("stream", streamTime, streamed.size());
+
+        std::cout << "  speedup " << std::setprecision(1) << (domTime / streamTime) << "x\n";
+    }
+}
@@ -0,0 +1,45 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "Benchmark.h"
+
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+
+using namespace Benchmark;
+
+int main(int argc, char* argv[])
+{
+    try
+    {
+        // The vertex count can optionally be specified on the command line
+        const size_t vertexCount = (argc > 1) ? std::stoul(argv[1]) : 2000000U;
+        const size_t iterationCount = 5U;
+
+        // As can the directory of assets loaded by the batch load benchmark
+        const std::filesystem::path resourcesDirectory = (argc > 2) ? std::filesystem::path(argv[2]) : std::filesystem::path("GLTFSDK.Test/Resources");
+
+        BenchmarkInterleavedRead(vertexCount, iterationCount);
+        BenchmarkQuantizedRead(vertexCount, iterationCount);
+        BenchmarkBase64Decode(vertexCount * 6U * sizeof(float), iterationCount);
+        BenchmarkDeserialize(vertexCount / 20U, iterationCount);
+        BenchmarkPeek(vertexCount / 20U, iterationCount);
+        BenchmarkSerialize(vertexCount / 20U, iterationCount);
+        BenchmarkHandles(vertexCount / 20U, iterationCount);
+        BenchmarkMemoryResource(vertexCount / 20U, iterationCount);
+        BenchmarkRemove(vertexCount / 200U, iterationCount);
+        BenchmarkDocumentIndex(vertexCount / 20U, iterationCount);
+        BenchmarkBatchLoad(resourcesDirectory, iterationCount);
+    }
+    catch (const std::exception& ex)
+    {
+        std::cerr << "Error! - ";
+        std::cerr << ex.what() << "\n";
+
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
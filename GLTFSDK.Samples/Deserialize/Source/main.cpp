@@ -69,6 +69,16 @@ namespace
             return stream;
         }
 
+        // Buffers are read with positional reads, so the GLTFResourceReader can be shared between threads
+        // without serializing their reads
+        std::shared_ptr<const IRandomAccessReader> GetRandomAccessReader(const std::string& filename) const override
+        {
+            // FileRandomAccessReader expects a UTF-8 encoded path
+            const auto path = (m_pathBase / fs::u8path(filename)).u8string();
+
+            return std::make_shared<FileRandomAccessReader>(std::string(path.begin(), path.end()));
+        }
+
     private:
         fs::path m_pathBase;
     };
@@ -0,0 +1,162 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/AccessorCache.h>
+#include <GLTFSDK/Document.h>
+
+#include "TestUtils.h"
+
+using namespace glTF::UnitTest;
+
+namespace
+{
+    Microsoft::glTF::Accessor MakeAccessor(const std::string& id, size_t count)
+    {
+        Microsoft::glTF::Accessor accessor;
+        accessor.id = id;
+        accessor.bufferViewId = "0";
+        accessor.componentType = Microsoft::glTF::COMPONENT_FLOAT;
+        accessor.type = Microsoft::glTF::TYPE_SCALAR;
+        accessor.count = count;
+        return accessor;
+    }
+}
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(AccessorCacheTests)
+            {
+                GLTFSDK_TEST_METHOD(AccessorCacheTests, AccessorCache_GetSet)
+                {
+                    AccessorCache cache;
+                    const auto readerId = AccessorCache::CreateReaderId();
+
+                    auto document = Document::create();
+                    const auto accessor = MakeAccessor("0", 3U);
+
+                    Assert::IsTrue(cache.Get<float>(readerId, *document, accessor) == nullptr);
+
+                    auto data = cache.Set<float>(readerId, *document, accessor, { 0.0f, 1.0f, 2.0f });
+
+                    Assert::IsTrue(cache.Get<float>(readerId, *document, accessor) == data);
+                    Assert::AreEqual<size_t>(1U, cache.Size());
+                    Assert::AreEqual<size_t>(3U * sizeof(float), cache.GetByteCount());
+
+                    Assert::AreEqual<size_t>(1U, cache.GetHitCount());
+                    Assert::AreEqual<size_t>(1U, cache.GetMissCount());
+
+                    cache.ResetCounters();
+
+                    Assert::AreEqual<size_t>(0U, cache.GetHitCount());
+                    Assert::AreEqual<size_t>(0U, cache.GetMissCount());
+
+                    cache.Clear();
+
+                    Assert::IsTrue(cache.Get<float>(readerId, *document, accessor) == nullptr);
+                    Assert::AreEqual<size_t>(0U, cache.GetByteCount());
+                }
+
+                GLTFSDK_TEST_METHOD(AccessorCacheTests, AccessorCache_Keys)
+                {
+                    AccessorCache cache;
+                    const auto readerId = AccessorCache::CreateReaderId();
+
+                    auto document = Document::create();
+                    auto otherDocument = Document::create();
+
+                    const auto accessor = MakeAccessor("0", 3U);
+
+                    cache.Set<float>(readerId, *document, accessor, { 0.0f, 1.0f, 2.0f });
+
+                    // The same accessor requested as another type, or from another document, is a separate entry
+                    Assert::IsTrue(cache.Get<float, AccessorCache::FloatData>(readerId, *document, accessor) == nullptr);
+                    Assert::IsTrue(cache.Get<float>(readerId, *otherDocument, accessor) == nullptr);
+
+                    // As is a modified accessor with the same id
+                    Assert::IsTrue(cache.Get<float>(readerId, *document, MakeAccessor("0", 2U)) == nullptr);
+
+                    cache.Set<float, AccessorCache::FloatData>(readerId, *document, accessor, { 0.0f, 0.5f, 1.0f });
+                    cache.Set<float>(readerId, *otherDocument, accessor, { 0.0f, 1.0f, 2.0f });
+
+                    Assert::AreEqual<size_t>(3U, cache.Size());
+
+                    cache.Clear(*document);
+
+                    Assert::AreEqual<size_t>(1U, cache.Size());
+                    Assert::IsTrue(cache.Get<float>(readerId, *otherDocument, accessor) != nullptr);
+                }
+
+                GLTFSDK_TEST_METHOD(AccessorCacheTests, AccessorCache_Readers)
+                {
+                    AccessorCache cache;
+
+                    const auto readerId = AccessorCache::CreateReaderId();
+                    const auto otherReaderId = AccessorCache::CreateReaderId();
+
+                    Assert::IsTrue(readerId != otherReaderId);
+
+                    auto document = Document::create();
+                    const auto accessor = MakeAccessor("0", 3U);
+
+                    cache.Set<float>(readerId, *document, accessor, { 0.0f, 1.0f, 2.0f });
+
+                    // A reader over other resources may decode different data for the same document and accessor
+                    Assert::IsTrue(cache.Get<float>(otherReaderId, *document, accessor) == nullptr);
+
+                    cache.Set<float>(otherReaderId, *document, accessor, { 3.0f, 4.0f, 5.0f });
+
+                    Assert::AreEqual<size_t>(2U, cache.Size());
+
+                    cache.Clear(readerId);
+
+                    Assert::AreEqual<size_t>(1U, cache.Size());
+                    Assert::IsTrue(cache.Get<float>(otherReaderId, *document, accessor) != nullptr);
+                }
+
+                GLTFSDK_TEST_METHOD(AccessorCacheTests, AccessorCache_ByteBudget)
+                {
+                    AccessorCache cache(32U);
+                    const auto readerId = AccessorCache::CreateReaderId();
+
+                    auto document = Document::create();
+
+                    const auto accessor0 = MakeAccessor("0", 3U);
+                    const auto accessor1 = MakeAccessor("1", 3U);
+                    const auto accessor2 = MakeAccessor("2", 3U);
+                    const auto accessor3 = MakeAccessor("3", 3U);
+
+                    cache.Set<float>(readerId, *document, accessor0, std::vector<float>(3U));
+                    cache.Set<float>(readerId, *document, accessor1, std::vector<float>(3U));
+
+                    // Make accessor0 the most recently used so that accessor1 is evicted first
+                    Assert::IsTrue(cache.Get<float>(readerId, *document, accessor0) != nullptr);
+
+                    cache.Set<float>(readerId, *document, accessor2, std::vector<float>(3U));
+
+                    Assert::IsTrue(cache.Get<float>(readerId, *document, accessor0) != nullptr);
+                    Assert::IsTrue(cache.Get<float>(readerId, *document, accessor1) == nullptr);
+                    Assert::IsTrue(cache.Get<float>(readerId, *document, accessor2) != nullptr);
+                    Assert::AreEqual<size_t>(24U, cache.GetByteCount());
+
+                    // Data larger than the whole budget is returned but not cached
+                    auto data = cache.Set<float>(readerId, *document, accessor3, std::vector<float>(9U));
+
+                    Assert::AreEqual<size_t>(9U, data->size());
+                    Assert::IsTrue(cache.Get<float>(readerId, *document, accessor3) == nullptr);
+                    Assert::AreEqual<size_t>(2U, cache.Size());
+
+                    cache.SetByteBudget(0U);
+
+                    Assert::AreEqual<size_t>(0U, cache.Size());
+                    Assert::AreEqual<size_t>(0U, cache.GetByteCount());
+                }
+            };
+        }
+    }
+}
@@ -78,6 +78,11 @@ namespace Microsoft
                     animationSampler.outputAccessorId = accessor.id;
                     output = AnimationUtils::GetMorphWeights(*doc, reader, animationSampler);
                     AreEqual(expectedOutput, output, msg.c_str());
+
+                    // Caller-provided output
+                    std::vector<float> outputInto(expectedOutput.size());
+                    AnimationUtils::GetMorphWeightsInto(*doc, reader, animationSampler, outputInto);
+                    AreEqual(expectedOutput, outputInto, msg.c_str());
                 }
 
                 // Utility for verifying GetRotations
@@ -125,6 +130,11 @@ namespace Microsoft
                     animationSampler.outputAccessorId = accessor.id;
                     output = AnimationUtils::GetRotations(*doc, reader, animationSampler);
                     AreEqual(expectedOutput, output, msg.c_str());
+
+                    // Caller-provided output
+                    std::vector<float> outputInto(expectedOutput.size());
+                    AnimationUtils::GetRotationsInto(*doc, reader, animationSampler, outputInto);
+                    AreEqual(expectedOutput, outputInto, msg.c_str());
                 }
             }
 
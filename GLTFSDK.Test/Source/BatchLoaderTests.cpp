@@ -0,0 +1,175 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/BatchLoader.h>
+#include <GLTFSDK/ExtensionsKHR.h>
+#include <GLTFSDK/GLBResourceReader.h>
+
+#include "TestUtils.h"
+
+#include <atomic>
+
+using namespace glTF::UnitTest;
+
+namespace
+{
+    using namespace Microsoft::glTF;
+
+    // Reads an asset's files from the test resources directory the asset root refers to
+    class LocalStreamReader : public IStreamReader
+    {
+    public:
+        explicit LocalStreamReader(std::string root) : m_root(std::move(root))
+        {
+        }
+
+        std::shared_ptr<std::istream> GetInputStream(const std::string& filename) const override
+        {
+            return Test::ReadLocalAsset(m_root + "\\" + filename);
+        }
+
+    private:
+        std::string m_root;
+    };
+
+    std::vector<BatchAsset> GetAssets()
+    {
+        return {
+            { "Resources\\gltf", "SimpleSparseAccessor.gltf" },
+            { "Resources\\glb", "BoxInterleaved.glb" },
+            { "Resources\\gltf", "CameraInvalidProjection.gltf" },
+            { "Resources\\gltf", "NoSuchAsset.gltf" },
+            { "Resources\\gltf", "TextureTransformTest.gltf" }
+        };
+    }
+}
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(BatchLoaderTests)
+            {
+                GLTFSDK_TEST_METHOD(BatchLoaderTests, Load)
+                {
+                    std::atomic<size_t> streamReaderCount = 0U;
+
+                    BatchLoaderOptions options;
+                    options.extensionDeserializer = KHR::GetKHRExtensionDeserializer();
+                    options.threadCount = 4U;
+
+                    BatchLoader loader([&](const std::string& root)
+                    {
+                        ++streamReaderCount;
+                        return std::make_shared<LocalStreamReader>(root);
+                    }, options);
+
+                    const auto assets = GetAssets();
+                    const auto results = loader.Load(assets);
+
+                    Assert::AreEqual(assets.size(), results.size());
+                    Assert::AreEqual(assets.size(), streamReaderCount.load());
+
+                    for (size_t i = 0U; i < results.size(); ++i)
+                    {
+                        Assert::AreEqual(assets[i].manifest, results[i].asset.manifest);
+                        Assert::AreEqual(i != 2U && i != 3U, results[i].IsSuccess());
+                        Assert::AreEqual(results[i].IsSuccess(), results[i].error.empty());
+                        Assert::AreEqual(results[i].IsSuccess(), results[i].document != nullptr);
+                        Assert::IsTrue(results[i].accessors.empty());
+                    }
+
+                    // The results match loading each asset individually
+                    auto expected = Deserializer::Deserialize(ReadLocalJson("Resources\\gltf\\TextureTransformTest.gltf"), KHR::GetKHRExtensionDeserializer());
+
+                    Assert::IsTrue(*expected == *results[4].document);
+                    Assert::IsTrue(std::dynamic_pointer_cast<GLBResourceReader>(results[1].resourceReader) != nullptr);
+                    Assert::IsTrue(std::dynamic_pointer_cast<GLBResourceReader>(results[0].resourceReader) == nullptr);
+
+                    Assert::ExpectException<GLTFException>([&]() { std::rethrow_exception(results[2].exception); });
+
+                    const auto stats = loader.GetStats();
+
+                    Assert::AreEqual(assets.size(), stats.assetCount);
+                    Assert::AreEqual<size_t>(2U, stats.failureCount);
+                    Assert::AreEqual<size_t>(0U, stats.decodedByteCount);
+
+                    size_t manifestByteCount = 0U;
+
+                    for (const auto& result : results)
+                    {
+                        manifestByteCount += result.manifestByteCount;
+                    }
+
+                    Assert::AreEqual(manifestByteCount, stats.manifestByteCount);
+
+                    loader.Load(assets[0]);
+
+                    Assert::AreEqual(assets.size() + 1U, loader.GetStats().assetCount);
+
+                    loader.ResetStats();
+
+                    Assert::AreEqual<size_t>(0U, loader.GetStats().assetCount);
+                }
+
+                GLTFSDK_TEST_METHOD(BatchLoaderTests, Load_DecodeAccessors)
+                {
+                    BatchLoaderOptions options;
+                    options.decodeAccessors = true;
+
+                    BatchLoader loader([](const std::string& root) { return std::make_shared<LocalStreamReader>(root); }, options);
+
+                    const auto results = loader.Load(GetAssets(), ThreadExecutor(2U));
+
+                    for (size_t i : { 0U, 1U })
+                    {
+                        const auto& result = results[i];
+
+                        Assert::IsTrue(result.IsSuccess());
+                        Assert::AreEqual(result.document->accessors.Size(), result.accessors.size());
+
+                        size_t decodedByteCount = 0U;
+
+                        for (size_t j = 0U; j < result.accessors.size(); ++j)
+                        {
+                            const auto& accessor = result.document->accessors[j];
+
+                            Assert::IsTrue(result.accessors[j].accessor == &accessor);
+
+                            if (accessor.componentType == COMPONENT_FLOAT)
+                            {
+                                const auto data = result.accessors[j].GetData<float>();
+                                AreEqual(result.resourceReader->ReadBinaryData<float>(*result.document, accessor), std::vector<float>(data.begin(), data.end()));
+                            }
+
+                            decodedByteCount += result.accessors[j].data.size();
+                        }
+
+                        Assert::IsTrue(decodedByteCount > 0U);
+                        Assert::AreEqual(decodedByteCount, result.decodedByteCount);
+                    }
+
+                    // The external buffer TextureTransformTest.bin isn't in the test resources, so decoding fails
+                    Assert::IsFalse(results[4].IsSuccess());
+                    Assert::IsTrue(results[4].document == nullptr);
+                }
+
+                GLTFSDK_TEST_METHOD(BatchLoaderTests, Load_NoStreamReader)
+                {
+                    Assert::ExpectException<GLTFException>([]() { BatchLoader loader(nullptr); });
+
+                    BatchLoader loader([](const std::string&) { return std::shared_ptr<const IStreamReader>(); });
+
+                    const auto result = loader.Load(BatchAsset{ "Resources\\gltf", "Cube.gltf" });
+
+                    Assert::IsFalse(result.IsSuccess());
+                    Assert::AreEqual(std::string("No stream reader was created for asset root Resources\\gltf"), result.error);
+                }
+            };
+        }
+    }
+}
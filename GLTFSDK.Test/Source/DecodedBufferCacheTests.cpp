@@ -0,0 +1,151 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/DecodedBufferCache.h>
+
+#include "TestUtils.h"
+
+using namespace glTF::UnitTest;
+
+namespace
+{
+    Microsoft::glTF::Buffer MakeBuffer(const std::string& id, const std::string& uri)
+    {
+        Microsoft::glTF::Buffer buffer;
+        buffer.id = id;
+        buffer.uri = uri;
+        return buffer;
+    }
+}
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(DecodedBufferCacheTests)
+            {
+                GLTFSDK_TEST_METHOD(DecodedBufferCacheTests, DecodedBufferCache_GetSet)
+                {
+                    DecodedBufferCache cache;
+
+                    const auto buffer = MakeBuffer("0", "data:application/octet-stream;base64,AAEC");
+
+                    Assert::IsTrue(cache.Get(buffer) == nullptr);
+
+                    auto data = cache.Set(buffer, { 0U, 1U, 2U });
+
+                    Assert::IsTrue(cache.Get(buffer) == data);
+                    Assert::AreEqual<size_t>(1U, cache.Size());
+                    Assert::AreEqual<size_t>(3U, cache.GetByteCount());
+
+                    cache.Set(buffer, { 0U, 1U });
+
+                    Assert::AreEqual<size_t>(1U, cache.Size());
+                    Assert::AreEqual<size_t>(2U, cache.GetByteCount());
+
+                    cache.Clear();
+
+                    Assert::IsTrue(cache.Get(buffer) == nullptr);
+                    Assert::AreEqual<size_t>(0U, cache.GetByteCount());
+                }
+
+                GLTFSDK_TEST_METHOD(DecodedBufferCacheTests, DecodedBufferCache_DifferentUri)
+                {
+                    DecodedBufferCache cache;
+
+                    const auto buffer = MakeBuffer("0", "data:application/octet-stream;base64,AAEC");
+                    const auto bufferCopy = buffer;
+                    const auto bufferOther = MakeBuffer("0", "data:application/octet-stream;base64,AAED");
+
+                    cache.Set(buffer, { 0U, 1U, 2U });
+
+                    // A buffer with the same id from another document is only served the cached data if its uri matches
+                    Assert::IsTrue(cache.Get(bufferCopy) != nullptr);
+                    Assert::IsTrue(cache.Get(bufferOther) == nullptr);
+                }
+
+                GLTFSDK_TEST_METHOD(DecodedBufferCacheTests, DecodedBufferCache_DifferentLongUri)
+                {
+                    DecodedBufferCache cache;
+
+                    const std::string encodedData(4096U, 'A');
+
+                    const auto buffer = MakeBuffer("0", "data:application/octet-stream;base64," + encodedData);
+                    const auto bufferCopy = buffer;
+                    const auto bufferOtherEnd = MakeBuffer("0", "data:application/octet-stream;base64," + encodedData.substr(4U) + "AAED");
+                    const auto bufferOtherLength = MakeBuffer("0", "data:application/octet-stream;base64," + encodedData + "AAAA");
+
+                    cache.Set(buffer, { 0U, 1U, 2U });
+
+                    Assert::IsTrue(cache.Get(bufferCopy) != nullptr);
+                    Assert::IsTrue(cache.Get(bufferOtherEnd) == nullptr);
+                    Assert::IsTrue(cache.Get(bufferOtherLength) == nullptr);
+                }
+
+                GLTFSDK_TEST_METHOD(DecodedBufferCacheTests, DecodedBufferCache_DifferentLongUriMiddle)
+                {
+                    DecodedBufferCache cache;
+
+                    std::string encodedData(4096U, 'A');
+
+                    const auto buffer = MakeBuffer("0", "data:application/octet-stream;base64," + encodedData);
+
+                    // Change a single character away from the start and end of the uri, keeping its length the same
+                    encodedData[2047U] = 'B';
+
+                    const auto bufferOtherMiddle = MakeBuffer("0", "data:application/octet-stream;base64," + encodedData);
+
+                    cache.Set(buffer, { 0U, 1U, 2U });
+
+                    Assert::IsTrue(cache.Get(buffer) != nullptr);
+                    Assert::IsTrue(cache.Get(bufferOtherMiddle) == nullptr);
+                }
+
+                GLTFSDK_TEST_METHOD(DecodedBufferCacheTests, DecodedBufferCache_ByteBudget)
+                {
+                    // Each entry takes the 4 bytes of its data
+                    DecodedBufferCache cache(10U);
+
+                    const auto buffer0 = MakeBuffer("0", "data:,0");
+                    const auto buffer1 = MakeBuffer("1", "data:,1");
+                    const auto buffer2 = MakeBuffer("2", "data:,2");
+                    const auto buffer3 = MakeBuffer("3", "data:,3");
+
+                    cache.Set(buffer0, std::vector<uint8_t>(4U));
+                    cache.Set(buffer1, std::vector<uint8_t>(4U));
+
+                    // Make buffer0 the most recently used so that buffer1 is evicted first
+                    Assert::IsTrue(cache.Get(buffer0) != nullptr);
+
+                    cache.Set(buffer2, std::vector<uint8_t>(4U));
+
+                    Assert::IsTrue(cache.Get(buffer0) != nullptr);
+                    Assert::IsTrue(cache.Get(buffer1) == nullptr);
+                    Assert::IsTrue(cache.Get(buffer2) != nullptr);
+                    Assert::AreEqual<size_t>(8U, cache.GetByteCount());
+
+                    // Data larger than the whole budget is returned but not cached
+                    auto data = cache.Set(buffer3, std::vector<uint8_t>(24U));
+
+                    Assert::AreEqual<size_t>(24U, data->size());
+                    Assert::IsTrue(cache.Get(buffer3) == nullptr);
+                    Assert::AreEqual<size_t>(2U, cache.Size());
+
+                    cache.SetByteBudget(4U);
+
+                    Assert::AreEqual<size_t>(1U, cache.Size());
+                    Assert::IsTrue(cache.Get(buffer2) != nullptr);
+
+                    cache.SetByteBudget(0U);
+
+                    Assert::AreEqual<size_t>(0U, cache.Size());
+                    Assert::AreEqual<size_t>(0U, cache.GetByteCount());
+                }
+            };
+        }
+    }
+}
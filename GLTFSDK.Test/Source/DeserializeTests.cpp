@@ -4,8 +4,13 @@
 #include "stdafx.h"
 
 #include <GLTFSDK/Deserialize.h>
+#include <GLTFSDK/ExtensionsKHR.h>
+#include <GLTFSDK/GLBResourceReader.h>
 #include <GLTFSDK/Validation.h>
 
+#include "TestResources.h"
+#include "TestUtils.h"
+
 using namespace glTF::UnitTest;
 
 namespace
@@ -176,6 +181,79 @@ namespace
     "asset": {"version": "2.0"}
 })";
 
+    // Accessors, meshes and nodes with duplicate keys, unknown members, extensions, extras and both a matrix and TRS
+    const char* c_unusualElements = R"({
+    "accessors": [
+        {
+            "componentType": 5126,
+            "count": 3,
+            "type": "VEC3",
+            "min": [0, 0, 0],
+            "max": [1, 1, 1],
+            "name": "positions",
+            "unknown": {"a": [1, {"b": 2}]},
+            "extras": {"note": [1, 2]}
+        },
+        {
+            "bufferView": 0,
+            "byteOffset": 4,
+            "componentType": 5123,
+            "count": 1,
+            "type": "VEC2",
+            "type": "SCALAR",
+            "normalized": true,
+            "min": [5],
+            "min": [2],
+            "sparse": {
+                "count": 1,
+                "byteOffset": 8,
+                "indices": {"bufferView": 0, "componentType": 5125},
+                "values": {"bufferView": 0}
+            }
+        }
+    ],
+    "meshes": [
+        {
+            "primitives": [
+                {
+                    "attributes": {"POSITION": 0, "NORMAL": 0, "POSITION": 1},
+                    "indices": 1,
+                    "mode": 1,
+                    "targets": [{"POSITION": 0}],
+                    "extras": 7
+                }
+            ],
+            "weights": [0.5],
+            "name": "mesh"
+        },
+        {
+            "primitives": [{"attributes": {"POSITION": 0}}],
+            "primitives": [{"attributes": {"NORMAL": 0}, "extensions": {"EXT_a": {"x": 1}}}, {"attributes": {"POSITION": 1}}],
+            "extras": [1, "two"]
+        }
+    ],
+    "nodes": [
+        {
+            "children": [1, 2],
+            "matrix": [1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 2, 3, 1],
+            "translation": [4, 5, 6],
+            "name": "matrix"
+        },
+        {
+            "translation": [1, 2, 3],
+            "rotation": [0, 0.7071, 0, 0.7071],
+            "scale": [2, 2, 2],
+            "mesh": 0,
+            "weights": [0.25],
+            "extensions": {"EXT_a": {}, "EXT_b": null}
+        },
+        {}
+    ],
+    "bufferViews": [{"buffer": 0, "byteLength": 16}],
+    "buffers": [{"byteLength": 16}],
+    "asset": {"version": "2.0"}
+})";
+
     // When byteOffset property is present an accessor must reference a bufferView
     const char* c_invalidAccessorDependency = R"({
     "accessors": [
@@ -257,6 +335,32 @@ namespace
     "asset": {"version": "2.0"}
 })";
 
+    const char* c_negativeSecondAccessorCount = R"({
+    "accessors": [
+        {
+            "componentType": 5123,
+            "count": 1,
+            "type": "SCALAR"
+        },
+        {
+            "componentType": 5123,
+            "count": -1,
+            "type": "SCALAR"
+        }
+    ],
+    "asset": {"version": "2.0"}
+})";
+
+    const char* c_missingAsset = R"({
+    "accessors": [
+        {
+            "componentType": 5123,
+            "count": 1,
+            "type": "SCALAR"
+        }
+    ]
+})";
+
     const char* c_extraFieldsJson = R"({
     "asset": {"version": "2.0"},
     "assetExtra": {}
@@ -392,6 +496,24 @@ namespace Microsoft
                     Assert::AreEqual(GLTF_VERSION_2_0, doc->asset.version.c_str());
                 }
 
+                GLTFSDK_TEST_METHOD(DeserializeTests, DeserializeSuccess_StringView)
+                {
+                    const std::string json(c_validAccessor);
+
+                    // Trailing data outside of the view must not be parsed
+                    const std::string padded = json + "]]garbage";
+                    const std::string_view view(padded.data(), json.size());
+
+                    const std::span<const uint8_t> bytes(reinterpret_cast<const uint8_t*>(padded.data()), json.size());
+
+                    auto expected = Deserializer::Deserialize(json);
+
+                    Assert::IsTrue(*expected == *Deserializer::Deserialize(view));
+                    Assert::IsTrue(*expected == *Deserializer::Deserialize(bytes));
+                    Assert::IsTrue(*expected == *Deserializer::DeserializeStreaming(view));
+                    Assert::IsTrue(*expected == *Deserializer::DeserializeStreaming(bytes));
+                }
+
                 GLTFSDK_TEST_METHOD(DeserializeTests, DeserializeSuccess_ValidAccessor)
                 {
                     auto doc = Deserializer::Deserialize(c_validAccessor);
@@ -540,6 +662,428 @@ namespace Microsoft
                     Assert::AreEqual(doc->samplers[1].wrapS, Wrap_MIRRORED_REPEAT, L"Sampler wrapS property was not deserialized correctly");
                     Assert::AreEqual(doc->samplers[1].wrapT, Wrap_CLAMP_TO_EDGE, L"Sampler wrapT property was not deserialized correctly");
                 }
+
+                GLTFSDK_TEST_METHOD(DeserializeTests, DeserializeStreaming_MatchesDeserialize)
+                {
+                    for (auto path : { c_cubeJson, c_validMorphTarget, c_riggedSimpleJson, c_simpleSparseAccessor, c_validCameraJson, c_cubeWithLODJson, c_textureTransformTestJson })
+                    {
+                        const auto inputJson = ReadLocalJson(path);
+
+                        auto expected = Deserializer::Deserialize(inputJson);
+                        auto actual = Deserializer::DeserializeStreaming(inputJson);
+
+                        Assert::IsTrue(*expected == *actual, L"Streaming deserialization produced a different document");
+
+                        std::stringstream inputStream(inputJson);
+                        auto actualFromStream = Deserializer::DeserializeStreaming(inputStream);
+
+                        Assert::IsTrue(*expected == *actualFromStream, L"Streaming deserialization produced a different document");
+                    }
+                }
+
+                GLTFSDK_TEST_METHOD(DeserializeTests, DeserializeStreaming_UnvalidatedMatchesDeserialize)
+                {
+                    // Without validation accessors, meshes and nodes are read without a DOM
+                    for (auto path : { c_cubeJson, c_validMorphTarget, c_riggedSimpleJson, c_simpleSparseAccessor, c_validCameraJson, c_cubeWithLODJson, c_textureTransformTestJson })
+                    {
+                        const auto inputJson = ReadLocalJson(path);
+
+                        auto expected = Deserializer::Deserialize(inputJson, SchemaFlags::DisableSchemaRoot);
+                        auto actual = Deserializer::DeserializeStreaming(inputJson, SchemaFlags::DisableSchemaRoot);
+
+                        Assert::IsTrue(*expected == *actual, L"Streaming deserialization produced a different document");
+                    }
+
+                    auto expected = Deserializer::Deserialize(c_unusualElements, SchemaFlags::DisableSchemaRoot);
+                    auto actual = Deserializer::DeserializeStreaming(c_unusualElements, SchemaFlags::DisableSchemaRoot);
+
+                    Assert::IsTrue(*expected == *actual, L"Streaming deserialization produced a different document");
+
+                    Assert::AreEqual(std::string("positions"), actual->accessors[0].name);
+                    Assert::AreEqual(TYPE_SCALAR, actual->accessors[1].type);
+                    Assert::IsTrue(std::vector<float>{ 2.0f } == actual->accessors[1].min);
+                    Assert::AreEqual(size_t(8), actual->accessors[1].sparse.indicesByteOffset);
+                    Assert::AreEqual(size_t(2), actual->meshes[0].primitives[0].attributes.size());
+                    Assert::AreEqual(std::string("1"), actual->meshes[0].primitives[0].attributes.at(ACCESSOR_POSITION));
+                    Assert::AreEqual(size_t(2), actual->meshes[1].primitives.size());
+                    Assert::AreEqual(std::string("[1,\"two\"]"), actual->meshes[1].extras);
+                    Assert::IsTrue(Vector3::ZERO == actual->nodes[0].translation);
+                    Assert::AreEqual(size_t(2), actual->nodes[1].extensions.size());
+                }
+
+                GLTFSDK_TEST_METHOD(DeserializeTests, DeserializeStreamingFail_UnvalidatedElements)
+                {
+                    // Elements read without a DOM fail with the same errors as those converted from one
+                    for (auto json : {
+                        R"({"asset": {"version": "2.0"}, "accessors": [{"componentType": 5126, "type": "SCALAR"}]})",
+                        R"({"asset": {"version": "2.0"}, "accessors": [{"componentType": 5126, "count": "1", "type": "SCALAR"}]})",
+                        R"({"asset": {"version": "2.0"}, "meshes": [{"name": "mesh"}]})",
+                        R"({"asset": {"version": "2.0"}, "meshes": [{"primitives": [{"attributes": {"POSITION": [0]}}]}]})",
+                        R"({"asset": {"version": "2.0"}, "nodes": [{"matrix": [1, 0]}]})",
+                        R"({"asset": {"version": "2.0"}, "nodes": [{"children": [0, "1"]}]})" })
+                    {
+                        std::string expected;
+
+                        try
+                        {
+                            Deserializer::Deserialize(json, SchemaFlags::DisableSchemaRoot);
+                        }
+                        catch (const std::exception& ex)
+                        {
+                            expected = ex.what();
+                        }
+
+                        Assert::IsFalse(expected.empty());
+
+                        Assert::ExpectException<std::exception>([&]()
+                        {
+                            try
+                            {
+                                Deserializer::DeserializeStreaming(json, SchemaFlags::DisableSchemaRoot);
+                            }
+                            catch (const std::exception& ex)
+                            {
+                                Assert::AreEqual(expected.c_str(), ex.what());
+                                throw;
+                            }
+                        });
+                    }
+                }
+
+                GLTFSDK_TEST_METHOD(DeserializeTests, DeserializeStreamingFail_NegativeAccessorCount)
+                {
+                    for (auto json : { c_negativeAccessorCount, c_negativeSecondAccessorCount })
+                    {
+                        std::string expected;
+
+                        try
+                        {
+                            Deserializer::Deserialize(json);
+                        }
+                        catch (const ValidationException& ex)
+                        {
+                            expected = ex.what();
+                        }
+
+                        Assert::IsFalse(expected.empty());
+
+                        // Both engines report the same violation, whether the manifest is validated whole or per element
+                        for (auto schemaEngine : { SchemaValidationEngine::Native, SchemaValidationEngine::Valijson })
+                        {
+                            Assert::ExpectException<ValidationException>([&]()
+                            {
+                                try
+                                {
+                                    Deserializer::DeserializeStreaming(json, nullptr, SchemaFlags::None, schemaEngine);
+                                }
+                                catch (const ValidationException& ex)
+                                {
+                                    Assert::AreEqual(expected.c_str(), ex.what());
+                                    throw;
+                                }
+                            });
+
+                            Assert::ExpectException<ValidationException>([&]()
+                            {
+                                try
+                                {
+                                    Deserializer::Deserialize(json, nullptr, SchemaFlags::None, schemaEngine);
+                                }
+                                catch (const ValidationException& ex)
+                                {
+                                    Assert::AreEqual(expected.c_str(), ex.what());
+                                    throw;
+                                }
+                            });
+                        }
+                    }
+                }
+
+                GLTFSDK_TEST_METHOD(DeserializeTests, DeserializeStreamingFail_MissingAsset)
+                {
+                    Assert::ExpectException<ValidationException>([]()
+                    {
+                        try
+                        {
+                            Deserializer::DeserializeStreaming(c_missingAsset);
+                        }
+                        catch (const ValidationException& ex)
+                        {
+                            Assert::AreEqual("Schema violation at <root> due to Missing required property 'asset'.", ex.what());
+                            throw;
+                        }
+                    });
+
+                    // Disabling the root schema disables all validation, as it does for Deserialize
+                    auto doc = Deserializer::DeserializeStreaming(c_negativeAccessorCount, SchemaFlags::DisableSchemaRoot);
+
+                    Assert::AreEqual(size_t(1), doc->accessors.Size());
+                }
+
+                GLTFSDK_TEST_METHOD(DeserializeTests, DeserializeStreamingFail_BadJson)
+                {
+                    Assert::ExpectException<GLTFException>([]()
+                    {
+                        Deserializer::DeserializeStreaming(R"({"asset": {"version": "2.0"}, "accessors": [{)");
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(DeserializeTests, DeserializeOptions_SkipCollections)
+                {
+                    for (auto path : { c_cubeJson, c_validMorphTarget, c_riggedSimpleJson, c_validCameraJson, c_textureTransformTestJson })
+                    {
+                        const auto inputJson = ReadLocalJson(path);
+
+                        auto expected = Deserializer::Deserialize(inputJson);
+                        expected->animations.Clear();
+                        expected->images.Clear();
+                        expected->skins.Clear();
+
+                        DeserializeOptions options;
+                        options.skipCollections = DocumentCollections::Animations | DocumentCollections::Images | DocumentCollections::Skins;
+
+                        auto actual = Deserializer::Deserialize(inputJson, options);
+
+                        Assert::IsTrue(*expected == *actual, L"Skipping collections produced a different document");
+
+                        // The default scene is skipped along with the scenes
+                        options.skipCollections = DocumentCollections::Scenes;
+
+                        actual = Deserializer::Deserialize(inputJson, options);
+
+                        Assert::AreEqual(size_t(0), actual->scenes.Size());
+                        Assert::IsFalse(actual->HasDefaultScene());
+                    }
+
+                    // Skipped collections aren't parsed
+                    DeserializeOptions options;
+                    options.skipCollections = DocumentCollections::Nodes;
+
+                    auto doc = Deserializer::Deserialize(R"({"asset": {"version": "2.0"}, "nodes": [{"name": }]})", options);
+
+                    Assert::AreEqual(size_t(0), doc->nodes.Size());
+                }
+
+                GLTFSDK_TEST_METHOD(DeserializeTests, DeserializeOptions_LazyCollections)
+                {
+                    const auto extensionDeserializer = KHR::GetKHRExtensionDeserializer();
+
+                    for (auto path : { c_cubeJson, c_validMorphTarget, c_riggedSimpleJson, c_validCameraJson, c_textureTransformTestJson })
+                    {
+                        const auto inputJson = ReadLocalJson(path);
+
+                        auto expected = Deserializer::Deserialize(inputJson, extensionDeserializer);
+
+                        DeserializeOptions options;
+                        options.lazyCollections = DocumentCollections::All;
+
+                        auto actual = Deserializer::Deserialize(inputJson, options, extensionDeserializer);
+
+                        Assert::IsTrue(actual->nodes.IsDeferred());
+
+                        // Copies of a deferred container are loaded independently
+                        const auto nodes = actual->nodes;
+
+                        Assert::IsTrue(*expected == *actual, L"Lazy deserialization produced a different document");
+                        Assert::IsTrue(expected->nodes == nodes);
+                        Assert::IsFalse(actual->nodes.IsDeferred());
+
+                        std::stringstream inputStream(inputJson);
+                        actual = Deserializer::Deserialize(inputStream, options, extensionDeserializer);
+
+                        Assert::IsTrue(*expected == *actual, L"Lazy deserialization produced a different document");
+                    }
+                }
+
+                GLTFSDK_TEST_METHOD(DeserializeTests, DeserializeOptionsFail_LazyCollections)
+                {
+                    std::string expected;
+
+                    try
+                    {
+                        Deserializer::Deserialize(c_negativeSecondAccessorCount);
+                    }
+                    catch (const ValidationException& ex)
+                    {
+                        expected = ex.what();
+                    }
+
+                    DeserializeOptions options;
+                    options.lazyCollections = DocumentCollections::Accessors;
+
+                    auto doc = Deserializer::Deserialize(c_negativeSecondAccessorCount, options);
+
+                    // Errors are thrown by every access until the elements are loaded successfully
+                    for (int i = 0; i < 2; ++i)
+                    {
+                        Assert::ExpectException<ValidationException>([&]()
+                        {
+                            try
+                            {
+                                doc->accessors.Size();
+                            }
+                            catch (const ValidationException& ex)
+                            {
+                                Assert::AreEqual(expected.c_str(), ex.what());
+                                throw;
+                            }
+                        });
+                    }
+
+                    // Clearing the collection discards the deferred elements
+                    doc->accessors.Clear();
+                    Assert::AreEqual(size_t(0), doc->accessors.Size());
+
+                    options.lazyCollections = DocumentCollections::Nodes;
+                    doc = Deserializer::Deserialize(R"({"asset": {"version": "2.0"}, "nodes": [{"name": }]})", options);
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        doc->nodes.Size();
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(DeserializeTests, DeserializeOptions_Executor)
+                {
+                    ThreadExecutor executor(4U);
+
+                    DeserializeOptions options;
+                    options.executor = &executor;
+                    options.validationChunkSize = 1U;
+
+                    for (auto path : { c_cubeJson, c_riggedSimpleJson, c_textureTransformTestJson })
+                    {
+                        const auto inputJson = ReadLocalJson(path);
+
+                        Assert::IsTrue(*Deserializer::Deserialize(inputJson) == *Deserializer::Deserialize(inputJson, options));
+                    }
+
+                    Assert::ExpectException<ValidationException>([&]()
+                    {
+                        Deserializer::Deserialize(c_negativeSecondAccessorCount, options);
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(DeserializeTests, DeserializeOptions_MemoryResource)
+                {
+                    for (auto path : { c_cubeJson, c_riggedSimpleJson, c_textureTransformTestJson })
+                    {
+                        const auto inputJson = ReadLocalJson(path);
+
+                        std::pmr::monotonic_buffer_resource arena;
+
+                        DeserializeOptions options;
+                        options.memoryResource = &arena;
+
+                        const auto document = Deserializer::Deserialize(inputJson, options);
+
+                        Assert::IsTrue(document->GetMemoryResource() == &arena);
+                        Assert::IsTrue(document->nodes.GetMemoryResource() == &arena);
+                        Assert::IsTrue(*Deserializer::Deserialize(inputJson) == *document);
+
+                        // Lazily loaded collections are allocated from the resource too
+                        options.lazyCollections = DocumentCollections::All;
+
+                        const auto lazyDocument = Deserializer::Deserialize(inputJson, options);
+
+                        Assert::IsTrue(lazyDocument->accessors.GetMemoryResource() == &arena);
+                        Assert::IsTrue(*document == *lazyDocument);
+                    }
+                }
+
+                GLTFSDK_TEST_METHOD(DeserializeTests, Peek)
+                {
+                    const auto extensionDeserializer = KHR::GetKHRExtensionDeserializer();
+
+                    for (auto path : { c_cubeJson, c_riggedSimpleJson, c_simpleSparseAccessor, c_textureTransformTestJson, c_cameraWithExtensions })
+                    {
+                        const auto inputJson = ReadLocalJson(path);
+                        const auto document = Deserializer::Deserialize(inputJson, extensionDeserializer);
+
+                        std::stringstream stream(inputJson);
+                        const auto summary = Deserializer::Peek(stream);
+
+                        Assert::IsFalse(summary.isGLB);
+                        Assert::AreEqual(document->asset.version, summary.version);
+                        Assert::AreEqual(document->asset.minVersion, summary.minVersion);
+                        Assert::AreEqual(document->asset.generator, summary.generator);
+                        Assert::AreEqual(document->asset.copyright, summary.copyright);
+
+                        Assert::IsTrue(document->extensionsUsed == std::unordered_set<std::string>(summary.extensionsUsed.begin(), summary.extensionsUsed.end()));
+                        Assert::IsTrue(document->extensionsRequired == std::unordered_set<std::string>(summary.extensionsRequired.begin(), summary.extensionsRequired.end()));
+
+                        Assert::AreEqual(document->accessors.Size(), summary.accessorCount);
+                        Assert::AreEqual(document->animations.Size(), summary.animationCount);
+                        Assert::AreEqual(document->buffers.Size(), summary.bufferCount);
+                        Assert::AreEqual(document->bufferViews.Size(), summary.bufferViewCount);
+                        Assert::AreEqual(document->cameras.Size(), summary.cameraCount);
+                        Assert::AreEqual(document->images.Size(), summary.imageCount);
+                        Assert::AreEqual(document->materials.Size(), summary.materialCount);
+                        Assert::AreEqual(document->meshes.Size(), summary.meshCount);
+                        Assert::AreEqual(document->nodes.Size(), summary.nodeCount);
+                        Assert::AreEqual(document->samplers.Size(), summary.samplerCount);
+                        Assert::AreEqual(document->scenes.Size(), summary.sceneCount);
+                        Assert::AreEqual(document->skins.Size(), summary.skinCount);
+                        Assert::AreEqual(document->textures.Size(), summary.textureCount);
+
+                        uint64_t bufferByteLength = 0U;
+
+                        for (const auto& buffer : document->buffers.Elements())
+                        {
+                            bufferByteLength += buffer.byteLength;
+                        }
+
+                        Assert::AreEqual(bufferByteLength, summary.bufferByteLength);
+                        Assert::AreEqual<uint64_t>(0U, summary.binaryChunkByteLength);
+                    }
+
+                    const auto summary = Deserializer::Peek(R"({"asset": {"version": "2.0", "generator": "A \"quoted\" \u00e9 generator", "extras": {"generator": "no"}},
+                        "extensionsUsed": ["EXT_a", "EXT_b"], "buffers": [{"byteLength": 12}, {"uri": "a.bin", "byteLength": 4.0}], "nodes": [{}, {"children": [0]}, {}]})");
+
+                    Assert::AreEqual(std::string("A \"quoted\" \u00e9 generator"), summary.generator);
+                    Assert::IsTrue(std::vector<std::string>{ "EXT_a", "EXT_b" } == summary.extensionsUsed);
+                    Assert::AreEqual<size_t>(2U, summary.bufferCount);
+                    Assert::AreEqual<uint64_t>(16U, summary.bufferByteLength);
+                    Assert::AreEqual<size_t>(3U, summary.nodeCount);
+                }
+
+                GLTFSDK_TEST_METHOD(DeserializeTests, Peek_GLB)
+                {
+                    const auto glbStream = ReadLocalAsset("Resources\\glb\\BoxInterleaved.glb");
+                    const auto summary = Deserializer::Peek(*glbStream);
+
+                    glbStream->seekg(0);
+
+                    GLBResourceReader reader(std::make_shared<StreamReaderWriter>(), glbStream);
+                    const auto document = Deserializer::Deserialize(reader.GetJsonChunk());
+
+                    Assert::IsTrue(summary.isGLB);
+                    Assert::AreEqual(document->asset.generator, summary.generator);
+                    Assert::AreEqual(document->accessors.Size(), summary.accessorCount);
+                    Assert::AreEqual(document->meshes.Size(), summary.meshCount);
+                    Assert::AreEqual<uint64_t>(document->buffers.Front().byteLength, summary.bufferByteLength);
+                    Assert::IsTrue(summary.binaryChunkByteLength >= summary.bufferByteLength);
+                }
+
+                GLTFSDK_TEST_METHOD(DeserializeTests, PeekFail_GLBJsonChunkLength)
+                {
+                    // Version 2, a file length of 28 and a JSON chunk that claims to be 4GB long
+                    const uint32_t header[5] = { 0x46546C67, 2U, 28U, 0xFFFFFFFFU, 0x4E4F534A };
+
+                    std::stringstream stream;
+                    stream.write(reinterpret_cast<const char*>(header), sizeof(header));
+                    stream.write("{}      ", 8);
+
+                    Assert::ExpectException<InvalidGLTFException>([&stream]() { Deserializer::Peek(stream); });
+                }
+
+                GLTFSDK_TEST_METHOD(DeserializeTests, PeekFail_BadJson)
+                {
+                    for (auto json : { "", "[]", R"({"asset": {"version": "2.0"})", R"({"asset": {"version": 2}})", R"({"buffers": [{"byteLength": "1"}]})" })
+                    {
+                        Assert::ExpectException<GLTFException>([json]() { Deserializer::Peek(json); });
+                    }
+                }
             };
         }
     }
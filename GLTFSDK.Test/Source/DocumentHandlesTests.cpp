@@ -0,0 +1,168 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/Deserialize.h>
+#include <GLTFSDK/DocumentHandles.h>
+#include <GLTFSDK/ExtensionsKHR.h>
+
+#include "TestResources.h"
+#include "TestUtils.h"
+
+using namespace glTF::UnitTest;
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(DocumentHandlesTests)
+            {
+                GLTFSDK_TEST_METHOD(DocumentHandlesTests, DocumentHandles_Resolve)
+                {
+                    const auto document = Deserializer::Deserialize(ReadLocalJson(c_riggedSimpleJson));
+                    const auto handles = DocumentHandles::Resolve(*document);
+
+                    Assert::AreEqual(document->nodes.Size(), handles.nodes.size());
+                    Assert::AreEqual(document->skins.Size(), handles.skins.size());
+
+                    for (size_t i = 0U; i < handles.nodes.size(); ++i)
+                    {
+                        const auto& node = document->nodes[i];
+                        const auto& references = handles.nodes[i];
+
+                        Assert::AreEqual(node.children.size(), references.children.size());
+
+                        for (size_t j = 0U; j < node.children.size(); ++j)
+                        {
+                            Assert::AreEqual(document->nodes.GetIndex(node.children[j]), static_cast<size_t>(references.children[j].index));
+                        }
+
+                        Assert::AreEqual(node.meshId.empty(), !references.mesh.IsValid());
+                        Assert::AreEqual(node.skinId.empty(), !references.skin.IsValid());
+                    }
+
+                    const auto& skin = document->skins.Front();
+
+                    Assert::AreEqual(skin.jointIds.size(), handles.skins.front().joints.size());
+                    Assert::AreEqual(skin.inverseBindMatricesAccessorId, document->accessors.GetId(handles.skins.front().inverseBindMatrices));
+
+                    const auto& primitive = document->meshes.Front().primitives.front();
+                    const auto& primitiveReferences = handles.meshes.front().primitives.front();
+
+                    Assert::AreEqual(primitive.attributes.size(), primitiveReferences.attributes.size());
+
+                    for (const auto& [name, accessor] : primitiveReferences.attributes)
+                    {
+                        Assert::AreEqual(primitive.GetAttributeAccessorId(name), document->accessors.GetId(accessor));
+                    }
+
+                    Assert::AreEqual(document->defaultSceneId, document->scenes.GetId(handles.defaultScene));
+                }
+
+                GLTFSDK_TEST_METHOD(DocumentHandlesTests, DocumentHandles_RoundTrip)
+                {
+                    for (auto path : { c_riggedSimpleJson, c_animatedTriangleJson, c_simpleSparseAccessor, c_validMorphTarget, c_singleTriangleWithTextureJson, c_validCameraJson })
+                    {
+                        const auto json = ReadLocalJson(path);
+                        const auto expected = Deserializer::Deserialize(json);
+                        const auto document = Deserializer::Deserialize(json);
+
+                        DocumentHandles::Resolve(*document).Apply(*document);
+
+                        Assert::IsTrue(*expected == *document);
+                    }
+                }
+
+                GLTFSDK_TEST_METHOD(DocumentHandlesTests, DocumentHandles_Apply)
+                {
+                    const auto document = Deserializer::Deserialize(ReadLocalJson(c_riggedSimpleJson));
+
+                    auto handles = DocumentHandles::Resolve(*document);
+
+                    // Detach the skeleton's root from the scene and remove the mesh from the first node that has one
+                    auto& sceneNodes = handles.scenes.front().nodes;
+                    sceneNodes.erase(sceneNodes.begin());
+
+                    const auto meshNode = std::find_if(handles.nodes.begin(), handles.nodes.end(), [](const auto& node) { return node.mesh.IsValid(); });
+                    meshNode->mesh = MeshHandle();
+
+                    handles.Apply(*document);
+
+                    const auto expected = Deserializer::Deserialize(ReadLocalJson(c_riggedSimpleJson));
+
+                    Assert::AreEqual(expected->scenes.Front().nodes.size() - 1U, document->scenes.Front().nodes.size());
+                    Assert::IsTrue(document->nodes[static_cast<size_t>(meshNode - handles.nodes.begin())].meshId.empty());
+                    Assert::IsTrue(expected->accessors == document->accessors);
+                }
+
+                GLTFSDK_TEST_METHOD(DocumentHandlesTests, DocumentHandles_Extensions)
+                {
+                    const auto extensionDeserializer = KHR::GetKHRExtensionDeserializer();
+
+                    const auto dracoDocument = Deserializer::Deserialize(ReadLocalJson(c_dracoBox), extensionDeserializer);
+
+                    dracoDocument->bufferViews.Append(BufferView(), AppendIdPolicy::GenerateOnEmpty);
+
+                    auto handles = DocumentHandles::Resolve(*dracoDocument);
+
+                    Assert::AreEqual(uint32_t(0U), handles.meshes.front().primitives.front().dracoBufferView.index);
+
+                    // Point the Draco primitive at the bufferView that was appended
+                    handles.meshes.front().primitives.front().dracoBufferView = BufferViewHandle(1U);
+                    handles.Apply(*dracoDocument);
+
+                    const auto& draco = dracoDocument->meshes.Front().primitives.front().GetExtension<KHR::MeshPrimitives::DracoMeshCompression>();
+
+                    Assert::AreEqual(dracoDocument->bufferViews[1].id, draco.bufferViewId);
+
+                    const auto document = Deserializer::Deserialize(ReadLocalJson(c_singleTriangleWithTextureJson), extensionDeserializer);
+
+                    handles = DocumentHandles::Resolve(*document);
+
+                    Assert::AreEqual(uint32_t(1U), handles.materials[1].specularGlossinessDiffuseTexture.index);
+
+                    // Clear the diffuse texture of the second material's KHR_materials_pbrSpecularGlossiness
+                    handles.materials[1].specularGlossinessDiffuseTexture = TextureHandle();
+                    handles.Apply(*document);
+
+                    const auto& specularGlossiness = document->materials[1].GetExtension<KHR::Materials::PBRSpecularGlossiness>();
+
+                    Assert::IsTrue(specularGlossiness.diffuseTexture.textureId.empty());
+                    Assert::AreEqual(std::string("0"), document->materials[0].GetExtension<KHR::Materials::PBRSpecularGlossiness>().diffuseTexture.textureId);
+
+                    // Without changes nothing is replaced, so the round trip is lossless
+                    const auto expected = Deserializer::Deserialize(ReadLocalJson(c_dracoBox), extensionDeserializer);
+                    const auto roundTripped = Deserializer::Deserialize(ReadLocalJson(c_dracoBox), extensionDeserializer);
+
+                    DocumentHandles::Resolve(*roundTripped).Apply(*roundTripped);
+
+                    Assert::IsTrue(*expected == *roundTripped);
+                }
+
+                GLTFSDK_TEST_METHOD(DocumentHandlesTests, DocumentHandles_Apply_Mismatched)
+                {
+                    const auto document = Deserializer::Deserialize(ReadLocalJson(c_riggedSimpleJson));
+
+                    auto handles = DocumentHandles::Resolve(*document);
+                    handles.nodes.pop_back();
+
+                    Assert::ExpectException<DocumentException>([&]()
+                    {
+                        handles.Apply(*document);
+                    });
+
+                    handles = DocumentHandles::Resolve(*document);
+                    handles.scenes.front().nodes.push_back(NodeHandle(static_cast<uint32_t>(document->nodes.Size())));
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        handles.Apply(*document);
+                    });
+                }
+            };
+        }
+    }
+}
@@ -0,0 +1,239 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/Deserialize.h>
+#include <GLTFSDK/DocumentIndex.h>
+#include <GLTFSDK/ExtensionsKHR.h>
+
+#include "TestResources.h"
+#include "TestUtils.h"
+
+#include <algorithm>
+
+using namespace glTF::UnitTest;
+
+namespace
+{
+    using namespace Microsoft::glTF;
+
+    const DocumentCollections c_collections[] = {
+        DocumentCollections::Accessors,
+        DocumentCollections::Animations,
+        DocumentCollections::Buffers,
+        DocumentCollections::BufferViews,
+        DocumentCollections::Cameras,
+        DocumentCollections::Images,
+        DocumentCollections::Materials,
+        DocumentCollections::Meshes,
+        DocumentCollections::Nodes,
+        DocumentCollections::Samplers,
+        DocumentCollections::Scenes,
+        DocumentCollections::Skins,
+        DocumentCollections::Textures
+    };
+
+    std::vector<DocumentElement> Sorted(std::vector<DocumentElement> elements)
+    {
+        std::sort(elements.begin(), elements.end(), [](const DocumentElement& lhs, const DocumentElement& rhs)
+        {
+            return std::make_pair(lhs.collection, lhs.index) < std::make_pair(rhs.collection, rhs.index);
+        });
+
+        return elements;
+    }
+
+    // Whether an incrementally updated index matches one built from scratch, regardless of the order of references
+    bool AreEquivalent(const DocumentIndex& lhs, const DocumentIndex& rhs)
+    {
+        for (const auto collection : c_collections)
+        {
+            if (lhs.GetElementCount(collection) != rhs.GetElementCount(collection))
+            {
+                return false;
+            }
+
+            for (size_t index = 0U; index < lhs.GetElementCount(collection); ++index)
+            {
+                const DocumentElement element = { collection, index };
+
+                if (Sorted(lhs.GetReferences(element)) != Sorted(rhs.GetReferences(element)) ||
+                    Sorted(lhs.GetReferencedBy(element)) != Sorted(rhs.GetReferencedBy(element)))
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+}
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(DocumentIndexTests)
+            {
+                GLTFSDK_TEST_METHOD(DocumentIndexTests, DocumentIndex_Build)
+                {
+                    const auto document = Deserializer::Deserialize(ReadLocalJson(c_riggedSimpleJson));
+                    const DocumentIndex index(*document);
+
+                    // Accessor 13 holds the inverse bind matrices of the only skin
+                    const auto& accessorReferences = index.GetReferencedBy({ DocumentCollections::Accessors, 13U });
+
+                    Assert::AreEqual(size_t(1U), accessorReferences.size());
+                    Assert::IsTrue(accessorReferences.front() == DocumentElement{ DocumentCollections::Skins, 0U });
+
+                    // Node 1 is the only one using mesh 0, and is a child of node 0
+                    Assert::IsTrue(index.GetReferencedBy({ DocumentCollections::Meshes, 0U }) == std::vector<DocumentElement>({ { DocumentCollections::Nodes, 1U } }));
+                    Assert::IsTrue(index.GetReferencedBy({ DocumentCollections::Nodes, 1U }) == std::vector<DocumentElement>({ { DocumentCollections::Nodes, 0U } }));
+
+                    // Node 2 is the skin's skeleton and one of its joints
+                    const auto& nodeReferences = index.GetReferencedBy({ DocumentCollections::Nodes, 2U });
+
+                    Assert::AreEqual(2, static_cast<int>(std::count(nodeReferences.begin(), nodeReferences.end(), DocumentElement{ DocumentCollections::Skins, 0U })));
+                    Assert::IsTrue(std::find(nodeReferences.begin(), nodeReferences.end(), DocumentElement{ DocumentCollections::Animations, 0U }) != nodeReferences.end());
+
+                    Assert::IsFalse(index.IsReferenced({ DocumentCollections::Animations, 0U }));
+                    Assert::IsTrue(index.IsReferenced({ DocumentCollections::Buffers, 0U }));
+
+                    // Every forward reference has a matching reverse one
+                    for (const auto collection : c_collections)
+                    {
+                        for (size_t i = 0U; i < index.GetElementCount(collection); ++i)
+                        {
+                            const DocumentElement element = { collection, i };
+
+                            for (const auto& reference : index.GetReferences(element))
+                            {
+                                const auto& referencedBy = index.GetReferencedBy(reference);
+                                Assert::IsTrue(std::find(referencedBy.begin(), referencedBy.end(), element) != referencedBy.end());
+                            }
+                        }
+                    }
+
+                    Assert::ExpectException<GLTFException>([&index]()
+                    {
+                        index.GetReferencedBy({ DocumentCollections::Meshes, 1U });
+                    });
+
+                    Assert::ExpectException<GLTFException>([&index]()
+                    {
+                        index.GetReferencedBy({ DocumentCollections::Meshes | DocumentCollections::Nodes, 0U });
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(DocumentIndexTests, DocumentIndex_Extensions)
+                {
+                    const auto extensionDeserializer = KHR::GetKHRExtensionDeserializer();
+
+                    // The only reference to bufferView 0 is the mesh primitive's KHR_draco_mesh_compression
+                    const auto dracoDocument = Deserializer::Deserialize(ReadLocalJson(c_dracoBox), extensionDeserializer);
+                    const DocumentIndex dracoIndex(*dracoDocument);
+
+                    Assert::IsTrue(dracoIndex.GetReferencedBy({ DocumentCollections::BufferViews, 0U }) == std::vector<DocumentElement>({ { DocumentCollections::Meshes, 0U } }));
+
+                    // Material 0 uses texture 0 as its base color and as its KHR_materials_pbrSpecularGlossiness diffuse
+                    const auto document = Deserializer::Deserialize(ReadLocalJson(c_singleTriangleWithTextureJson), extensionDeserializer);
+                    const DocumentIndex index(*document);
+
+                    const auto& textureReferences = index.GetReferencedBy({ DocumentCollections::Textures, 0U });
+
+                    Assert::AreEqual(2, static_cast<int>(std::count(textureReferences.begin(), textureReferences.end(), DocumentElement{ DocumentCollections::Materials, 0U })));
+                }
+
+                GLTFSDK_TEST_METHOD(DocumentIndexTests, DocumentIndex_OnAppend)
+                {
+                    auto document = Deserializer::Deserialize(ReadLocalJson(c_riggedSimpleJson));
+                    DocumentIndex index(*document);
+
+                    Node parent;
+                    parent.id = "parent";
+                    parent.children = { "child" };
+
+                    Node child;
+                    child.id = "child";
+                    child.meshId = "0";
+
+                    document->nodes.Append(std::move(parent));
+                    document->nodes.Append(std::move(child));
+
+                    index.OnAppend(*document, DocumentCollections::Nodes);
+
+                    Assert::IsTrue(AreEquivalent(DocumentIndex(*document), index));
+                    Assert::IsTrue(index.GetReferencedBy({ DocumentCollections::Nodes, 6U }) == std::vector<DocumentElement>({ { DocumentCollections::Nodes, 5U } }));
+
+                    // The scene refers to a mesh that isn't indexed yet
+                    Mesh mesh;
+                    mesh.id = "mesh";
+
+                    Node node;
+                    node.id = "node";
+                    node.meshId = "mesh";
+
+                    document->meshes.Append(std::move(mesh));
+                    document->nodes.Append(std::move(node));
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        index.OnAppend(*document, DocumentCollections::Nodes);
+                    });
+
+                    index.OnAppend(*document, DocumentCollections::Meshes);
+                    index.OnAppend(*document, DocumentCollections::Nodes);
+
+                    Assert::IsTrue(AreEquivalent(DocumentIndex(*document), index));
+                }
+
+                GLTFSDK_TEST_METHOD(DocumentIndexTests, DocumentIndex_OnReplace)
+                {
+                    auto document = Deserializer::Deserialize(ReadLocalJson(c_riggedSimpleJson));
+                    DocumentIndex index(*document);
+
+                    auto node = document->nodes["0"];
+                    node.children = { "4" };
+                    document->nodes.Replace(std::move(node));
+
+                    index.OnReplace(*document, { DocumentCollections::Nodes, 0U });
+
+                    Assert::IsFalse(index.IsReferenced({ DocumentCollections::Nodes, 1U }));
+                    Assert::IsTrue(AreEquivalent(DocumentIndex(*document), index));
+                }
+
+                GLTFSDK_TEST_METHOD(DocumentIndexTests, DocumentIndex_OnRemove)
+                {
+                    for (const auto collection : { DocumentCollections::Accessors, DocumentCollections::Nodes, DocumentCollections::Meshes })
+                    {
+                        auto document = Deserializer::Deserialize(ReadLocalJson(c_riggedSimpleJson));
+                        DocumentIndex index(*document);
+
+                        IndexRemap remap;
+
+                        switch (collection)
+                        {
+                        case DocumentCollections::Accessors:
+                            remap = document->accessors.RemoveMany({ "0", "2", "13" });
+                            break;
+                        case DocumentCollections::Nodes:
+                            remap = document->nodes.RemoveMany({ "1", "3" });
+                            break;
+                        default:
+                            remap = document->meshes.RemoveMany({ "0" });
+                            break;
+                        }
+
+                        document->RemapReferences(collection, remap);
+                        index.OnRemove(collection, remap);
+
+                        Assert::IsTrue(AreEquivalent(DocumentIndex(*document), index));
+                    }
+                }
+            };
+        }
+    }
+}
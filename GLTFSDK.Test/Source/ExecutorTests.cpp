@@ -0,0 +1,89 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/Exceptions.h>
+#include <GLTFSDK/Executor.h>
+
+#include <atomic>
+#include <vector>
+
+using namespace glTF::UnitTest;
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(ExecutorTests)
+            {
+                GLTFSDK_TEST_METHOD(ExecutorTests, SequentialExecutor_ParallelFor)
+                {
+                    std::vector<size_t> calls;
+
+                    SequentialExecutor().ParallelFor(5U, [&](size_t i) { calls.push_back(i); });
+
+                    Assert::IsTrue(calls == std::vector<size_t>{ 0U, 1U, 2U, 3U, 4U });
+                }
+
+                GLTFSDK_TEST_METHOD(ExecutorTests, SequentialExecutor_Exception)
+                {
+                    std::vector<size_t> calls;
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        SequentialExecutor().ParallelFor(5U, [&](size_t i)
+                        {
+                            calls.push_back(i);
+
+                            if (i == 1U || i == 3U)
+                            {
+                                throw GLTFException("Task failed");
+                            }
+                        });
+                    });
+
+                    // The remaining tasks still run after one throws
+                    Assert::IsTrue(calls == std::vector<size_t>{ 0U, 1U, 2U, 3U, 4U });
+                }
+
+                GLTFSDK_TEST_METHOD(ExecutorTests, ThreadExecutor_ParallelFor)
+                {
+                    std::vector<std::atomic<size_t>> callCounts(1000U);
+
+                    ThreadExecutor(4U).ParallelFor(callCounts.size(), [&](size_t i) { ++callCounts[i]; });
+
+                    for (const auto& callCount : callCounts)
+                    {
+                        Assert::AreEqual<size_t>(1U, callCount);
+                    }
+
+                    ThreadExecutor(4U).ParallelFor(0U, [](size_t) { throw GLTFException("No tasks should run"); });
+                }
+
+                GLTFSDK_TEST_METHOD(ExecutorTests, ThreadExecutor_Exception)
+                {
+                    std::atomic<size_t> callCount = 0U;
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        ThreadExecutor(3U).ParallelFor(10U, [&](size_t i)
+                        {
+                            ++callCount;
+
+                            if (i == 4U)
+                            {
+                                throw GLTFException("Task failed");
+                            }
+                        });
+                    });
+
+                    // The remaining tasks still run after one throws
+                    Assert::AreEqual<size_t>(10U, callCount);
+                }
+            };
+        }
+    }
+}
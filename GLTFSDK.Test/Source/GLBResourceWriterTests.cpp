@@ -5,7 +5,9 @@
 #include <GLTFSDK/Deserialize.h>
 #include <GLTFSDK/GLBResourceReader.h>
 #include <GLTFSDK/GLBResourceWriter.h>
+#include <GLTFSDK/ExtensionsKHR.h>
 #include <GLTFSDK/Serialize.h>
+#include "TestResources.h"
 #include "TestUtils.h"
 
 using namespace glTF::UnitTest;
@@ -37,6 +39,48 @@ namespace Microsoft
                     Assert::IsFalse(stream->fail());
                     Assert::IsTrue(*doc == *roundTrippedDoc);
                 }
+
+                GLTFSDK_TEST_METHOD(GLBResourceWriterTests, Flush_Document)
+                {
+                    auto streamWriter = std::make_shared<const StreamReaderWriter>();
+
+                    auto doc = Deserializer::Deserialize(ReadLocalJson(c_textureTransformTestJson), KHR::GetKHRExtensionDeserializer());
+
+                    BufferView bufferView;
+                    bufferView.bufferId = GLB_BUFFER_ID;
+                    bufferView.byteLength = 5U; // Not a multiple of the chunk alignment
+
+                    const std::vector<uint8_t> data = { 1U, 2U, 3U, 4U, 5U };
+
+                    for (bool pretty : { false, true })
+                    {
+                        const std::string manifestUri = pretty ? "manifestPretty.glb" : "manifest.glb";
+                        const std::string documentUri = pretty ? "documentPretty.glb" : "document.glb";
+
+                        GLBResourceWriter manifestWriter(streamWriter);
+                        manifestWriter.Write(bufferView, data);
+                        manifestWriter.Flush(Serializer::Serialize(doc, pretty), manifestUri);
+
+                        GLBResourceWriter documentWriter(streamWriter);
+                        documentWriter.Write(bufferView, data);
+                        documentWriter.Flush(*doc, documentUri, pretty);
+
+                        std::stringstream expected;
+                        expected << streamWriter->GetInputStream(manifestUri)->rdbuf();
+
+                        auto stream = streamWriter->GetInputStream(documentUri);
+
+                        std::stringstream actual;
+                        actual << stream->rdbuf();
+
+                        Assert::AreEqual(expected.str(), actual.str());
+
+                        stream->seekg(0);
+                        GLBResourceReader resourceReader(streamWriter, stream);
+
+                        Assert::IsTrue(*doc == *Deserializer::Deserialize(resourceReader.GetJsonChunk(), KHR::GetKHRExtensionDeserializer()));
+                    }
+                }
             };
         }
     }
@@ -5,9 +5,13 @@
 
 #include <GLTFSDK/Deserialize.h>
 #include <GLTFSDK/GLTFResourceReader.h>
+#include <GLTFSDK/MemoryStream.h>
 
 #include "TestUtils.h"
 
+#include <atomic>
+#include <thread>
+
 using namespace glTF::UnitTest;
 
 namespace
@@ -387,6 +391,53 @@ namespace
     ]
 }
 )";
+
+    // Serves a single in-memory buffer and counts the number of reads made via GetRandomAccessReader
+    class CountingStreamReader : public Microsoft::glTF::IStreamReader
+    {
+    public:
+        explicit CountingStreamReader(std::vector<uint8_t> data) : m_data(std::make_shared<const std::vector<uint8_t>>(std::move(data)))
+        {
+        }
+
+        std::shared_ptr<std::istream> GetInputStream(const std::string&) const override
+        {
+            return std::make_shared<Microsoft::glTF::MemoryStream>(*m_data, m_data);
+        }
+
+        std::shared_ptr<const Microsoft::glTF::IRandomAccessReader> GetRandomAccessReader(const std::string&) const override
+        {
+            return std::make_shared<CountingReader>(m_data, m_readCount);
+        }
+
+        size_t GetReadCount() const
+        {
+            return m_readCount;
+        }
+
+    private:
+        class CountingReader : public Microsoft::glTF::MemoryRandomAccessReader
+        {
+        public:
+            CountingReader(const std::shared_ptr<const std::vector<uint8_t>>& data, std::atomic<size_t>& readCount) :
+                MemoryRandomAccessReader(*data, data),
+                m_readCount(readCount)
+            {
+            }
+
+            void ReadAt(uint64_t offset, std::span<uint8_t> data) const override
+            {
+                ++m_readCount;
+                MemoryRandomAccessReader::ReadAt(offset, data);
+            }
+
+        private:
+            std::atomic<size_t>& m_readCount;
+        };
+
+        std::shared_ptr<const std::vector<uint8_t>> m_data;
+        mutable std::atomic<size_t> m_readCount = 0U;
+    };
 }
 
 namespace Microsoft
@@ -432,6 +483,314 @@ namespace Microsoft
                     Assert::IsTrue(img2 == std::vector<uint8_t>{105, 183, 29, 106, 12, 161, 185, 183});
                 }
 
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadBase64_DecodedBufferCache)
+                {
+                    auto stream = std::make_shared<StreamReaderWriter>();
+                    auto gltfDoc = Deserializer::Deserialize(base64_json);
+
+                    GLTFResourceReader cachedReader(stream);
+                    GLTFResourceReader uncachedReader(stream);
+
+                    uncachedReader.GetDecodedBufferCache().SetByteBudget(0U);
+
+                    for (const auto& image : gltfDoc->images.Elements())
+                    {
+                        Assert::IsTrue(cachedReader.ReadBinaryData(*gltfDoc, image) == uncachedReader.ReadBinaryData(*gltfDoc, image));
+                    }
+
+                    // The buffer is decoded once in full and shared by both bufferViews
+                    Assert::AreEqual<size_t>(1U, cachedReader.GetDecodedBufferCache().Size());
+                    Assert::AreEqual<size_t>(18U, cachedReader.GetDecodedBufferCache().GetByteCount());
+                    Assert::AreEqual<size_t>(0U, uncachedReader.GetDecodedBufferCache().Size());
+
+                    BufferView bufferView = gltfDoc->bufferViews.Get("1");
+                    bufferView.byteOffset = 16U;
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        cachedReader.ReadBinaryData<uint8_t>(*gltfDoc, bufferView);
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadBinaryData_Concurrent)
+                {
+                    constexpr size_t accessorCount = 8U;
+                    constexpr size_t vertexCount = 512U;
+
+                    auto stream = std::make_shared<StreamReaderWriter>();
+                    auto streamOutput = stream->GetOutputStream("buffer.bin");
+
+                    std::vector<float> bufferData(accessorCount * vertexCount * 3U);
+
+                    for (size_t i = 0U; i < bufferData.size(); ++i)
+                    {
+                        bufferData[i] = static_cast<float>(i);
+                    }
+
+                    streamOutput->write(reinterpret_cast<const char*>(bufferData.data()), bufferData.size() * sizeof(float));
+
+                    auto doc = Document::create();
+
+                    Buffer buffer;
+                    buffer.id = "0";
+                    buffer.uri = "buffer.bin";
+                    buffer.byteLength = bufferData.size() * sizeof(float);
+                    doc->buffers.Append(std::move(buffer));
+
+                    // Every accessor is interleaved with all the others in a single bufferView
+                    BufferView bufferView;
+                    bufferView.id = "0";
+                    bufferView.bufferId = "0";
+                    bufferView.byteLength = bufferData.size() * sizeof(float);
+                    bufferView.byteStride = accessorCount * 3U * sizeof(float);
+                    doc->bufferViews.Append(std::move(bufferView));
+
+                    for (size_t i = 0U; i < accessorCount; ++i)
+                    {
+                        Accessor accessor;
+                        accessor.id = std::to_string(i);
+                        accessor.bufferViewId = "0";
+                        accessor.byteOffset = i * 3U * sizeof(float);
+                        accessor.componentType = COMPONENT_FLOAT;
+                        accessor.type = TYPE_VEC3;
+                        accessor.count = vertexCount;
+                        doc->accessors.Append(std::move(accessor));
+                    }
+
+                    const GLTFResourceReader reader(stream);
+
+                    std::vector<std::thread> threads;
+                    std::vector<int> results(accessorCount, 0);
+
+                    for (size_t i = 0U; i < accessorCount; ++i)
+                    {
+                        threads.emplace_back([&, i]()
+                        {
+                            bool isEqual = true;
+
+                            for (size_t iteration = 0U; iteration < 50U; ++iteration)
+                            {
+                                const auto data = reader.ReadBinaryData<float>(*doc, doc->accessors[i]);
+
+                                for (size_t j = 0U; j < vertexCount * 3U; ++j)
+                                {
+                                    isEqual = isEqual && data[j] == bufferData[(j / 3U) * accessorCount * 3U + i * 3U + j % 3U];
+                                }
+                            }
+
+                            results[i] = isEqual ? 1 : 0;
+                        });
+                    }
+
+                    for (auto& thread : threads)
+                    {
+                        thread.join();
+                    }
+
+                    Assert::IsTrue(std::all_of(results.begin(), results.end(), [](int result) { return result != 0; }), L"Concurrent reads returned unexpected data");
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestGetBinaryReader_LRU)
+                {
+                    // Exposes the protected GetBinaryReader
+                    class BinaryReaderResourceReader : public GLTFResourceReader
+                    {
+                    public:
+                        using GLTFResourceReader::GLTFResourceReader;
+                        using GLTFResourceReader::GetBinaryReader;
+
+                    protected:
+                        bool HasDefaultBinaryStreams() const override
+                        {
+                            return true;
+                        }
+                    };
+
+                    auto streamReader = std::make_shared<CountingStreamReader>(std::vector<uint8_t>(16U));
+
+                    BinaryReaderResourceReader reader(streamReader);
+
+                    auto MakeBuffer = [](size_t index)
+                    {
+                        Buffer buffer;
+                        buffer.id = std::to_string(index);
+                        buffer.uri = "buffer" + std::to_string(index) + ".bin";
+                        return buffer;
+                    };
+
+                    const auto binaryReader0 = reader.GetBinaryReader(MakeBuffer(0U));
+                    const auto binaryReader1 = reader.GetBinaryReader(MakeBuffer(1U));
+
+                    Assert::IsTrue(binaryReader0 == reader.GetBinaryReader(MakeBuffer(0U)));
+
+                    // Opening 15 more buffers exceeds the 16 readers kept open and releases the least recently used
+                    for (size_t i = 2U; i <= 16U; ++i)
+                    {
+                        reader.GetBinaryReader(MakeBuffer(i));
+                    }
+
+                    Assert::IsTrue(binaryReader0 == reader.GetBinaryReader(MakeBuffer(0U)));
+                    Assert::IsTrue(binaryReader1 != reader.GetBinaryReader(MakeBuffer(1U)));
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestGetBinaryStream_Override)
+                {
+                    // Reads every buffer from its own data rather than the stream reader's
+                    class RedirectingResourceReader : public GLTFResourceReader
+                    {
+                    public:
+                        using GLTFResourceReader::GLTFResourceReader;
+
+                    protected:
+                        std::shared_ptr<std::istream> GetBinaryStream(const Buffer&) const override
+                        {
+                            return std::make_shared<MemoryStream>(m_data);
+                        }
+
+                    private:
+                        const std::vector<uint8_t> m_data = { 8U, 9U, 10U, 11U };
+                    };
+
+                    auto streamReader = std::make_shared<CountingStreamReader>(std::vector<uint8_t>(4U));
+
+                    RedirectingResourceReader reader(streamReader);
+
+                    auto doc = Document::create();
+
+                    Buffer buffer;
+                    buffer.id = "0";
+                    buffer.uri = "buffer.bin";
+                    buffer.byteLength = 4U;
+                    doc->buffers.Append(std::move(buffer));
+
+                    BufferView bufferView;
+                    bufferView.id = "0";
+                    bufferView.bufferId = "0";
+                    bufferView.byteLength = 4U;
+                    doc->bufferViews.Append(std::move(bufferView));
+
+                    const auto data = reader.ReadBinaryData<uint8_t>(*doc, doc->bufferViews.Get("0"));
+
+                    Assert::IsTrue(data == std::vector<uint8_t>({ 8U, 9U, 10U, 11U }));
+                    Assert::AreEqual<size_t>(0U, streamReader->GetReadCount());
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadAccessors_Coalesced)
+                {
+                    // Two adjacent bufferViews, a third a few bytes of padding after them and a fourth far away
+                    std::vector<uint8_t> bufferData(1024U * 1024U + 64U);
+
+                    for (size_t i = 0U; i < bufferData.size(); ++i)
+                    {
+                        bufferData[i] = static_cast<uint8_t>(i * 7U);
+                    }
+
+                    auto streamReader = std::make_shared<CountingStreamReader>(bufferData);
+
+                    auto doc = Document::create();
+
+                    Buffer buffer;
+                    buffer.id = "0";
+                    buffer.uri = "buffer.bin";
+                    buffer.byteLength = bufferData.size();
+                    doc->buffers.Append(std::move(buffer));
+
+                    const std::pair<size_t, size_t> bufferViewRanges[] = { { 0U, 96U }, { 96U, 96U }, { 200U, 32U }, { 1024U * 1024U, 48U } };
+
+                    for (const auto& [byteOffset, byteLength] : bufferViewRanges)
+                    {
+                        BufferView bufferView;
+                        bufferView.bufferId = "0";
+                        bufferView.byteOffset = byteOffset;
+                        bufferView.byteLength = byteLength;
+                        doc->bufferViews.Append(std::move(bufferView), AppendIdPolicy::GenerateOnEmpty);
+                    }
+
+                    const std::tuple<const char*, ComponentType, AccessorType, size_t> accessorLayouts[] = {
+                        { "0", COMPONENT_FLOAT, TYPE_VEC3, 8U },
+                        { "1", COMPONENT_FLOAT, TYPE_VEC3, 8U },
+                        { "2", COMPONENT_UNSIGNED_SHORT, TYPE_SCALAR, 16U },
+                        { "3", COMPONENT_UNSIGNED_BYTE, TYPE_VEC4, 12U }
+                    };
+
+                    for (const auto& [bufferViewId, componentType, type, count] : accessorLayouts)
+                    {
+                        Accessor accessor;
+                        accessor.bufferViewId = bufferViewId;
+                        accessor.componentType = componentType;
+                        accessor.type = type;
+                        accessor.count = count;
+                        doc->accessors.Append(std::move(accessor), AppendIdPolicy::GenerateOnEmpty);
+                    }
+
+                    const GLTFResourceReader reader(streamReader);
+
+                    std::vector<float> normals(8U * 4U);
+
+                    std::vector<AccessorReadRequest> requests;
+                    requests.emplace_back(doc->accessors[3]);
+                    requests.emplace_back(doc->accessors[0]);
+                    requests.emplace_back(doc->accessors[1], std::span<float>(normals), 4U * sizeof(float));
+                    requests.emplace_back(doc->accessors[2]);
+
+                    reader.ReadAccessors(*doc, requests, ThreadExecutor(4U));
+
+                    // The first three bufferViews are read together, the fourth separately
+                    Assert::AreEqual<size_t>(2U, streamReader->GetReadCount());
+
+                    const auto expectedPositions = reader.ReadBinaryData<float>(*doc, doc->accessors[0]);
+                    const auto expectedNormals = reader.ReadBinaryData<float>(*doc, doc->accessors[1]);
+                    const auto expectedIndices = reader.ReadBinaryData<uint16_t>(*doc, doc->accessors[2]);
+                    const auto expectedColors = reader.ReadBinaryData<uint8_t>(*doc, doc->accessors[3]);
+
+                    const auto positions = requests[1].GetData<float>();
+                    const auto indices = requests[3].GetData<uint16_t>();
+                    const auto colors = requests[0].GetData<uint8_t>();
+
+                    Assert::IsTrue(std::equal(expectedPositions.begin(), expectedPositions.end(), positions.begin(), positions.end()));
+                    Assert::IsTrue(std::equal(expectedIndices.begin(), expectedIndices.end(), indices.begin(), indices.end()));
+                    Assert::IsTrue(std::equal(expectedColors.begin(), expectedColors.end(), colors.begin(), colors.end()));
+
+                    for (size_t i = 0U; i < 8U; ++i)
+                    {
+                        Assert::IsTrue(std::equal(expectedNormals.begin() + i * 3U, expectedNormals.begin() + i * 3U + 3U, normals.begin() + i * 4U));
+                    }
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        requests[1].GetData<uint16_t>();
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadAccessors_Sparse)
+                {
+                    auto stream = std::make_shared<StreamReaderWriter>();
+                    auto streamOutput = stream->GetOutputStream("buffer.bin");
+
+                    float valuesBuffer[4] = { 3.0f, 3.0f, 3.0f, 3.0f };
+                    streamOutput->write(reinterpret_cast<char*>(&valuesBuffer), 16);
+
+                    uint32_t indicesBuffer[2] = { 1U, 3U };
+                    streamOutput->write(reinterpret_cast<char*>(&indicesBuffer), 8);
+
+                    float floatInputBuffer[10] = { 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f };
+                    streamOutput->write(reinterpret_cast<char*>(&floatInputBuffer), 40);
+
+                    auto gltfDoc = Deserializer::Deserialize(sparse_json_float);
+
+                    GLTFResourceReader reader(stream);
+
+                    std::vector<AccessorReadRequest> requests;
+                    requests.emplace_back(gltfDoc->accessors.Get("0"));
+
+                    reader.ReadAccessors(*gltfDoc, requests);
+
+                    const std::vector<float> expected = { 1.0f, 1.0f, 3.0f, 3.0f, 1.0f, 1.0f, 3.0f, 3.0f, 1.0f, 1.0f };
+                    const auto actual = requests[0].GetData<float>();
+
+                    Assert::IsTrue(std::equal(expected.begin(), expected.end(), actual.begin(), actual.end()));
+                }
+
                 GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadSparseAccessorUint8)
                 {
                     uint8_t inputBuffer[16] = { 3U, 3U, 3U, 3U, // the sparse values
@@ -577,6 +936,122 @@ namespace Microsoft
                     Assert::IsTrue(output == expectedReadOutput);
                 }
 
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadSparseAccessor_IndexOutOfRange)
+                {
+                    uint8_t inputBuffer[6] = { 3U, 3U, 0U, 1U, // the sparse values
+                                               1U, 5U }; // the sparse indices, the accessor only has 5 elements
+
+                    auto stream = std::make_shared<StreamReaderWriter>();
+                    auto streamOutput = stream->GetOutputStream("buffer.bin");
+
+                    streamOutput->write(reinterpret_cast<char*>(&inputBuffer), 6);
+
+                    auto gltfDoc = Deserializer::Deserialize(sparse_emptybufferview_json);
+
+                    GLTFResourceReader reader(stream);
+
+                    const auto& accessor = gltfDoc->accessors.Get("0");
+
+                    // Reading the dense elements and reading only the substitutions reject the index alike
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        reader.ReadBinaryData<uint8_t>(*gltfDoc, accessor);
+                    });
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        reader.ReadSparseAccessorView<uint8_t>(*gltfDoc, accessor);
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadSparseAccessorView)
+                {
+                    auto stream = std::make_shared<StreamReaderWriter>();
+                    auto streamOutput = stream->GetOutputStream("buffer.bin");
+
+                    float valuesBuffer[4] = { 3.0f, 4.0f, 5.0f, 6.0f };
+                    streamOutput->write(reinterpret_cast<char*>(&valuesBuffer), 16);
+
+                    uint32_t indicesBuffer[2] = { 1U, 3U };
+                    streamOutput->write(reinterpret_cast<char*>(&indicesBuffer), 8);
+
+                    float floatInputBuffer[10] = { 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f };
+                    streamOutput->write(reinterpret_cast<char*>(&floatInputBuffer), 40);
+
+                    auto gltfDoc = Deserializer::Deserialize(sparse_json_float);
+
+                    GLTFResourceReader reader(stream);
+
+                    const auto& accessor = gltfDoc->accessors.Get("0");
+                    const auto view = reader.ReadSparseAccessorView<float>(*gltfDoc, accessor);
+
+                    Assert::IsTrue(view.HasBase());
+                    Assert::AreEqual<size_t>(2U, view.Size());
+
+                    const std::vector<uint32_t> expectedIndices = { 1U, 3U };
+                    const std::vector<float> expectedValues = { 3.0f, 4.0f, 5.0f, 6.0f };
+
+                    Assert::IsTrue(view.GetIndices() == expectedIndices);
+                    Assert::IsTrue(view.GetValues() == expectedValues);
+
+                    size_t position = 0U;
+
+                    for (const auto& element : view)
+                    {
+                        Assert::AreEqual<uint32_t>(expectedIndices[position], element.index);
+                        Assert::AreEqual<size_t>(2U, element.value.size());
+                        Assert::AreEqual<float>(expectedValues[position * 2U], element.value[0]);
+                        Assert::AreEqual<float>(expectedValues[position * 2U + 1U], element.value[1]);
+
+                        ++position;
+                    }
+
+                    Assert::AreEqual<size_t>(2U, position);
+
+                    // Scattering over the base gives the same result as reading the dense accessor
+                    std::vector<float> dense = reader.ReadBinaryData<float>(*gltfDoc, gltfDoc->bufferViews.Get(accessor.bufferViewId));
+                    view.Scatter(dense);
+
+                    Assert::IsTrue(dense == reader.ReadBinaryData<float>(*gltfDoc, accessor));
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        view.Scatter(std::span<float>(dense).first(8U));
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadSparseAccessorView_EmptyBufferView)
+                {
+                    uint8_t inputBuffer[6] = { 3U, 3U, 0U, 1U, // the sparse values
+                                               1U, 3U }; // the sparse indices
+
+                    auto stream = std::make_shared<StreamReaderWriter>();
+                    auto streamOutput = stream->GetOutputStream("buffer.bin");
+
+                    streamOutput->write(reinterpret_cast<char*>(&inputBuffer), 6);
+
+                    auto gltfDoc = Deserializer::Deserialize(sparse_emptybufferview_json);
+
+                    GLTFResourceReader reader(stream);
+
+                    const auto view = reader.ReadSparseAccessorView<uint8_t>(*gltfDoc, gltfDoc->accessors.Get("0"));
+
+                    Assert::IsFalse(view.HasBase());
+
+                    // Elements that aren't substituted are zero
+                    std::vector<uint8_t> dense(10U, 0U);
+                    view.Scatter(dense);
+
+                    const std::vector<uint8_t> expected = { 0U, 0U, 3U, 3U, 0U, 0U, 0U, 1U, 0U, 0U };
+                    Assert::IsTrue(dense == expected);
+
+                    // The component type must match the accessor's
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        reader.ReadSparseAccessorView<uint16_t>(*gltfDoc, gltfDoc->accessors.Get("0"));
+                    });
+                }
+
                 GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadFloatData)
                 {
                     auto readerWriter = std::make_shared<const StreamReaderWriter>();
@@ -798,6 +1273,231 @@ namespace Microsoft
                     Assert::AreEqual<float>(data[5], -1.f);
                 }
 
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadFloatData_Interleaved)
+                {
+                    // Enough vertices that the interleaved data spans several of the blocks that buffers are read in
+                    const size_t vertexCount = 10000U;
+                    const size_t stride = 16U;
+
+                    std::vector<uint8_t> bufferData(vertexCount * stride);
+
+                    for (size_t i = 0U; i < bufferData.size(); ++i)
+                    {
+                        bufferData[i] = static_cast<uint8_t>(i * 31U + 7U);
+                    }
+
+                    auto readerWriter = std::make_shared<StreamReaderWriter>();
+                    readerWriter->GetOutputStream("buffer.bin")->write(reinterpret_cast<const char*>(bufferData.data()), bufferData.size());
+
+                    auto doc = Document::create();
+
+                    Buffer buffer;
+                    buffer.id = "0";
+                    buffer.uri = "buffer.bin";
+                    buffer.byteLength = bufferData.size();
+                    doc->buffers.Append(std::move(buffer));
+
+                    BufferView bufferView;
+                    bufferView.id = "0";
+                    bufferView.bufferId = "0";
+                    bufferView.byteLength = bufferData.size();
+                    bufferView.byteStride = stride;
+                    doc->bufferViews.Append(std::move(bufferView));
+
+                    // A normalized VEC3 of shorts at the start of each vertex and a VEC4 of signed bytes after it
+                    Accessor positions;
+                    positions.id = "0";
+                    positions.bufferViewId = "0";
+                    positions.componentType = COMPONENT_UNSIGNED_SHORT;
+                    positions.normalized = true;
+                    positions.type = TYPE_VEC3;
+                    positions.count = vertexCount;
+                    doc->accessors.Append(std::move(positions));
+
+                    Accessor tangents;
+                    tangents.id = "1";
+                    tangents.bufferViewId = "0";
+                    tangents.byteOffset = 8U;
+                    tangents.componentType = COMPONENT_BYTE;
+                    tangents.normalized = true;
+                    tangents.type = TYPE_VEC4;
+                    tangents.count = vertexCount;
+                    doc->accessors.Append(std::move(tangents));
+
+                    GLTFResourceReader reader(readerWriter);
+
+                    auto positionData = reader.ReadFloatData(*doc, doc->accessors.Get("0"));
+                    auto tangentData = reader.ReadFloatData(*doc, doc->accessors.Get("1"));
+
+                    Assert::AreEqual<size_t>(vertexCount * 3U, positionData.size());
+                    Assert::AreEqual<size_t>(vertexCount * 4U, tangentData.size());
+
+                    // The positions are also read into 4 float slots, leaving the last float of each untouched
+                    std::vector<float> paddedPositionData(vertexCount * 4U, 5.f);
+                    reader.ReadFloatData(*doc, doc->accessors.Get("0"), paddedPositionData, 4U * sizeof(float));
+
+                    for (size_t i = 0U; i < vertexCount; ++i)
+                    {
+                        const uint8_t* vertex = bufferData.data() + i * stride;
+
+                        for (size_t j = 0U; j < 3U; ++j)
+                        {
+                            uint16_t component;
+                            std::memcpy(&component, vertex + j * sizeof(uint16_t), sizeof(uint16_t));
+
+                            Assert::AreEqual<float>(ComponentToFloat(component), positionData[i * 3U + j]);
+                            Assert::AreEqual<float>(ComponentToFloat(component), paddedPositionData[i * 4U + j]);
+                        }
+
+                        Assert::AreEqual<float>(5.f, paddedPositionData[i * 4U + 3U]);
+
+                        for (size_t j = 0U; j < 4U; ++j)
+                        {
+                            Assert::AreEqual<float>(ComponentToFloat(static_cast<int8_t>(vertex[8U + j])), tangentData[i * 4U + j]);
+                        }
+                    }
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadCachedBinaryData)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+
+                    std::vector<uint16_t> values = { 0U, 1U, 65535U };
+                    auto accessor = bufferBuilder.AddAccessor(values, { TYPE_SCALAR, COMPONENT_UNSIGNED_SHORT, true });
+
+                    auto doc = Document::create();
+                    bufferBuilder.Output(*doc);
+
+                    GLTFResourceReader reader(readerWriter);
+
+                    // Without a cache every read decodes the accessor again
+                    Assert::IsTrue(reader.ReadCachedBinaryData<uint16_t>(*doc, accessor) != reader.ReadCachedBinaryData<uint16_t>(*doc, accessor));
+
+                    auto accessorCache = std::make_shared<AccessorCache>();
+                    reader.SetAccessorCache(accessorCache);
+
+                    auto data = reader.ReadCachedBinaryData<uint16_t>(*doc, accessor);
+                    auto floatData = reader.ReadCachedFloatData(*doc, accessor);
+
+                    Assert::IsTrue(*data == values);
+                    Assert::AreEqual<size_t>(3U, floatData->size());
+                    Assert::AreEqual<float>(1.0f, (*floatData)[2]);
+
+                    Assert::IsTrue(reader.ReadCachedBinaryData<uint16_t>(*doc, accessor) == data);
+                    Assert::IsTrue(reader.ReadCachedFloatData(*doc, accessor) == floatData);
+
+                    Assert::AreEqual<size_t>(2U, accessorCache->GetHitCount());
+                    Assert::AreEqual<size_t>(2U, accessorCache->GetMissCount());
+
+                    // Another reader sharing the cache could be reading other resources, so it decodes its own copy
+                    {
+                        GLTFResourceReader otherReader(readerWriter);
+                        otherReader.SetAccessorCache(accessorCache);
+
+                        Assert::IsTrue(otherReader.ReadCachedBinaryData<uint16_t>(*doc, accessor) != data);
+                        Assert::AreEqual<size_t>(3U, accessorCache->Size());
+                    }
+
+                    // Destroying a reader removes its entries
+                    Assert::AreEqual<size_t>(2U, accessorCache->Size());
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadBinaryDataAccessor_Output)
+                {
+                    float f1 = 1.0f, f2 = 10.0f;
+
+                    auto stream = std::make_shared<StreamReaderWriter>();
+                    auto streamOutput = stream->GetOutputStream("buffer.bin");
+
+                    streamOutput->write(reinterpret_cast<char*>(&f1), sizeof(f1));
+                    streamOutput->write(reinterpret_cast<char*>(&f2), sizeof(f2));
+
+                    auto gltfDoc = Deserializer::Deserialize(test_json);
+
+                    auto gltfResourceReader = std::make_unique<GLTFResourceReader>(stream);
+
+                    auto accessor = gltfDoc->accessors.Get("0");
+
+                    float output[2] = {};
+                    gltfResourceReader->ReadBinaryData<float>(*gltfDoc, accessor, std::span<float>(output));
+
+                    Assert::AreEqual<float>(f1, output[0]);
+                    Assert::AreEqual<float>(f2, output[1]);
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        gltfResourceReader->ReadBinaryData<float>(*gltfDoc, accessor, std::span<float>(output, 1U));
+                    });
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        gltfResourceReader->ReadBinaryData<float>(*gltfDoc, accessor, output, sizeof(output), sizeof(float));
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadSparseAccessor_OutputStride)
+                {
+                    uint8_t inputBuffer[16] = { 3U, 3U, 3U, 3U, // the sparse values
+                                                1U, 3U, // the sparse indices
+                                                1U, 1U, 1U, 1U, 1U, 1U, 1U, 1U, 1U, 1U }; // base bufferview
+
+                    // expected sparse replacement output, every element is followed by 2 untouched padding bytes
+                    std::vector<uint8_t> expectedReadOutput = { 1U, 1U, 9U, 9U, 3U, 3U, 9U, 9U, 1U, 1U, 9U, 9U, 3U, 3U, 9U, 9U, 1U, 1U };
+
+                    auto stream = std::make_shared<StreamReaderWriter>();
+                    auto streamOutput = stream->GetOutputStream("buffer.bin");
+
+                    streamOutput->write(reinterpret_cast<char*>(&inputBuffer), 16);
+
+                    auto gltfDoc = Deserializer::Deserialize(sparse_json_uint8);
+
+                    auto gltfResourceReader = std::make_unique<GLTFResourceReader>(stream);
+
+                    auto accessor = gltfDoc->accessors.Get("0");
+
+                    std::vector<uint8_t> output(expectedReadOutput.size(), 9U);
+                    gltfResourceReader->ReadBinaryData<uint8_t>(*gltfDoc, accessor, output, 4U);
+
+                    Assert::IsTrue(output == expectedReadOutput);
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadFloatData_S16N_OutputStride)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+
+                    std::vector<int16_t> values = { 0, 32767, -32767, 1 };
+                    auto accessor = bufferBuilder.AddAccessor(values, { TYPE_VEC2, COMPONENT_SHORT, true });
+
+                    auto doc = Document::create();
+                    bufferBuilder.Output(*doc);
+
+                    GLTFResourceReader reader(readerWriter);
+
+                    // Each VEC2 is written into a 3 float slot, the last float of each slot must be left untouched
+                    std::vector<float> data(6U, 5.f);
+                    reader.ReadFloatData(*doc, accessor, data, 3U * sizeof(float));
+
+                    Assert::AreEqual<float>(data[0], 0.f);
+                    Assert::AreEqual<float>(data[1], 1.f);
+                    Assert::AreEqual<float>(data[2], 5.f);
+                    Assert::AreEqual<float>(data[3], -1.f);
+                    Assert::AreEqual<float>(data[4], 1.f / 32767.f);
+                    Assert::AreEqual<float>(data[5], 5.f);
+
+                    // The last slot only needs room for a VEC2
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        reader.ReadFloatData(*doc, accessor, std::span<float>(data).first(4U), 3U * sizeof(float));
+                    });
+                }
             };
         }
     }
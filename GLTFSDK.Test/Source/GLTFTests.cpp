@@ -629,6 +629,134 @@ namespace Microsoft
                     Assert::IsTrue(document->nodes.Size() == 1U);
                     Assert::IsTrue(document->nodes.Front().children.empty()); // Assert that the node has no children
                 }
+                GLTFSDK_TEST_METHOD(GLTFTests, GLTF_RemapReferences_Nodes)
+                {
+                    auto document = Deserializer::Deserialize(ReadLocalJson(c_riggedSimpleJson));
+
+                    // Node 1 holds the skinned mesh and is a child of node 0
+                    const auto remap = document->nodes.RemoveMany({ "1" });
+                    document->RemapReferences(DocumentCollections::Nodes, remap);
+
+                    Assert::AreEqual(size_t(4U), document->nodes.Size());
+
+                    for (size_t i = 0U; i < document->nodes.Size(); ++i)
+                    {
+                        Assert::AreEqual(std::to_string(i), document->nodes[i].id);
+                    }
+
+                    Assert::IsTrue(document->nodes["0"].children == std::vector<std::string>({ "3" }));
+                    Assert::IsTrue(document->nodes["1"].children == std::vector<std::string>({ "2" }));
+                    Assert::IsTrue(document->nodes["3"].children == std::vector<std::string>({ "1" }));
+                    Assert::AreEqual(std::string("1"), document->skins.Front().skeletonId);
+                    Assert::IsTrue(document->skins.Front().jointIds == std::vector<std::string>({ "1", "2" }));
+                    Assert::AreEqual(std::string("1"), document->animations.Front().channels.Front().target.nodeId);
+                    Assert::IsTrue(document->scenes.Front().nodes == std::vector<std::string>({ "0" }));
+
+                    // The ids are indices again, so the document round-trips
+                    const auto roundTripped = Deserializer::Deserialize(Serializer::Serialize(document));
+
+                    Assert::IsTrue(*document == *roundTripped);
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFTests, GLTF_RemapReferences_Accessors)
+                {
+                    auto document = Deserializer::Deserialize(ReadLocalJson(c_riggedSimpleJson));
+
+                    // Accessor 2 holds the normals of the only mesh primitive
+                    const auto remap = document->accessors.RemoveIf([](const Accessor& accessor) { return accessor.id == "2"; });
+                    document->RemapReferences(DocumentCollections::Accessors, remap);
+
+                    const auto& primitive = document->meshes.Front().primitives.front();
+
+                    Assert::IsFalse(primitive.HasAttribute(ACCESSOR_NORMAL));
+                    Assert::AreEqual(std::string("2"), primitive.GetAttributeAccessorId(ACCESSOR_POSITION));
+                    Assert::AreEqual(std::string("12"), document->skins.Front().inverseBindMatricesAccessorId);
+                    Assert::AreEqual(std::string("4"), document->animations.Front().samplers.Front().inputAccessorId);
+                    Assert::AreEqual(std::string("12"), document->accessors.Back().id);
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFTests, GLTF_RemapReferences_Extensions)
+                {
+                    auto document = Document::create();
+
+                    for (size_t i = 0U; i < 3U; ++i)
+                    {
+                        document->bufferViews.Append(BufferView(), AppendIdPolicy::GenerateOnEmpty);
+                        document->textures.Append(Texture(), AppendIdPolicy::GenerateOnEmpty);
+                    }
+
+                    KHR::MeshPrimitives::DracoMeshCompression draco;
+                    draco.bufferViewId = "2";
+
+                    MeshPrimitive primitive;
+                    primitive.SetExtension<KHR::MeshPrimitives::DracoMeshCompression>(draco);
+
+                    Mesh mesh;
+                    mesh.primitives.push_back(std::move(primitive));
+                    document->meshes.Append(std::move(mesh), AppendIdPolicy::GenerateOnEmpty);
+
+                    KHR::Materials::PBRSpecularGlossiness specularGlossiness;
+                    specularGlossiness.diffuseTexture.textureId = "1";
+                    specularGlossiness.specularGlossinessTexture.textureId = "2";
+
+                    Material material;
+                    material.SetExtension<KHR::Materials::PBRSpecularGlossiness>(specularGlossiness);
+                    document->materials.Append(std::move(material), AppendIdPolicy::GenerateOnEmpty);
+
+                    // Removing a bufferView before the Draco primitive's renumbers the one it refers to
+                    document->RemapReferences(DocumentCollections::BufferViews, document->bufferViews.RemoveMany({ "0" }));
+
+                    const auto& primitiveDraco = document->meshes.Front().primitives.front().GetExtension<KHR::MeshPrimitives::DracoMeshCompression>();
+
+                    Assert::AreEqual(std::string("1"), primitiveDraco.bufferViewId);
+
+                    document->RemapReferences(DocumentCollections::Textures, document->textures.RemoveMany({ "1" }));
+
+                    const auto& materialSpecularGlossiness = document->materials.Front().GetExtension<KHR::Materials::PBRSpecularGlossiness>();
+
+                    Assert::IsTrue(materialSpecularGlossiness.diffuseTexture.textureId.empty());
+                    Assert::AreEqual(std::string("1"), materialSpecularGlossiness.specularGlossinessTexture.textureId);
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFTests, GLTF_RemapReferences_IdClash)
+                {
+                    auto document = Document::create();
+
+                    // Renumbering would rename node "3" to "1", which is the id of the last node
+                    for (const char* id : { "a", "b", "2", "3", "1" })
+                    {
+                        Node node;
+                        node.id = id;
+                        document->nodes.Append(std::move(node));
+                    }
+
+                    const auto remap = document->nodes.RemoveMany({ "a", "b" });
+
+                    Assert::ExpectException<GLTFException>([&document, &remap]()
+                    {
+                        document->RemapReferences(DocumentCollections::Nodes, remap);
+                    });
+
+                    // No node was renamed
+                    Assert::AreEqual(std::string("2"), document->nodes[0].id);
+                    Assert::AreEqual(std::string("3"), document->nodes[1].id);
+                    Assert::AreEqual(std::string("1"), document->nodes[2].id);
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFTests, GLTF_RemapReferences_Invalid)
+                {
+                    auto document = Deserializer::Deserialize(ReadLocalJson(c_riggedSimpleJson));
+
+                    Assert::ExpectException<GLTFException>([&document]()
+                    {
+                        document->RemapReferences(DocumentCollections::Nodes | DocumentCollections::Skins, IndexRemap());
+                    });
+
+                    Assert::ExpectException<GLTFException>([&document]()
+                    {
+                        document->RemapReferences(DocumentCollections::Nodes, IndexRemap({ 0U, 1U }));
+                    });
+                }
             };
         }
     }
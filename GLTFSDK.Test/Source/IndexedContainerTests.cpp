@@ -120,6 +120,42 @@ namespace Microsoft
                     });
                 }
 
+                GLTFSDK_TEST_METHOD(IndexedContainerTests, IndexedContainer_Test_AppendRange)
+                {
+                    auto container = GetSampleContainer();
+
+                    std::vector<Uint8WithId> elements = { { "foo12", 12 }, { "", 14 }, { "foo16", 16 } };
+
+                    container.AppendRange(elements, AppendIdPolicy::GenerateOnEmpty);
+
+                    Assert::AreEqual<size_t>(9U, container.Size());
+                    Assert::IsTrue(container["foo12"].value == 12);
+                    Assert::IsTrue(container["7"].value == 14);
+                    Assert::IsTrue(container[8].value == 16);
+
+                    // The elements were moved in
+                    Assert::IsTrue(elements[0].id.empty());
+
+                    IndexedContainer<const Uint8WithId> constContainer;
+                    constContainer.AppendRange(std::vector<Uint8WithId>{ { "foo0", 0 }, { "foo2", 2 } });
+
+                    Assert::IsTrue(constContainer.Elements().capacity() >= 2U);
+                    Assert::IsTrue(constContainer["foo2"].value == 2);
+
+                    Assert::ExpectException<GLTFException>([&constContainer]()
+                    {
+                        constContainer.AppendRange(std::vector<Uint8WithId>{ { "foo4", 4 }, { "foo0", 0 } });
+                    });
+
+                    // Elements before the duplicate are kept
+                    Assert::AreEqual<size_t>(3U, constContainer.Size());
+
+                    Assert::ExpectException<GLTFException>([&constContainer]()
+                    {
+                        constContainer.AppendRange(std::vector<Uint8WithId>(1U));
+                    });
+                }
+
                 GLTFSDK_TEST_METHOD(IndexedContainerTests, IndexedContainer_Test_Clear)
                 {
                     auto container = GetSampleContainer();
@@ -181,6 +217,37 @@ namespace Microsoft
                     });
                 }
 
+                GLTFSDK_TEST_METHOD(IndexedContainerTests, IndexedContainer_Test_GetHandle)
+                {
+                    auto container = GetSampleContainer();
+
+                    const auto handle = container.GetHandle("foo4");
+
+                    Assert::IsTrue(handle.IsValid());
+                    Assert::AreEqual<uint32_t>(2U, handle.index);
+                    Assert::IsTrue(container[handle].value == 4);
+                    Assert::AreEqual(std::string("foo4"), container.GetId(handle));
+
+                    // An empty id maps to an invalid handle and back
+                    Assert::IsFalse(container.GetHandle("").IsValid());
+                    Assert::IsTrue(container.GetId(Handle<Uint8WithId>()).empty());
+
+                    Assert::ExpectException<GLTFException>([&container]()
+                    {
+                        container.GetHandle("foo100");
+                    });
+
+                    Assert::ExpectException<GLTFException>([&container]()
+                    {
+                        container[Handle<Uint8WithId>()];
+                    });
+
+                    Assert::ExpectException<GLTFException>([&container]()
+                    {
+                        container[Handle<Uint8WithId>(10U)];
+                    });
+                }
+
                 GLTFSDK_TEST_METHOD(IndexedContainerTests, IndexedContainer_Test_Has)
                 {
                     auto container = GetSampleContainer();
@@ -221,6 +288,71 @@ namespace Microsoft
                     Assert::IsTrue(container[4].value == 10);
                 }
 
+                GLTFSDK_TEST_METHOD(IndexedContainerTests, IndexedContainer_Test_RemoveIf)
+                {
+                    auto container = GetSampleContainer();
+
+                    const auto remap = container.RemoveIf([](const Uint8WithId& element) { return element.value % 4 == 0; });
+
+                    Assert::IsTrue(remap == IndexRemap({ RemovedIndex, 0U, RemovedIndex, 1U, RemovedIndex, 2U }));
+
+                    Assert::AreEqual(size_t(3U), container.Size());
+                    Assert::IsTrue(container[0].value == 2);
+                    Assert::IsTrue(container[1].value == 6);
+                    Assert::IsTrue(container[2].value == 10);
+
+                    Assert::AreEqual(size_t(2U), container.GetIndex("foo10"));
+                    Assert::IsFalse(container.Has("foo4"));
+
+                    container.Append({ "foo4", 4 });
+
+                    Assert::AreEqual(size_t(3U), container.GetIndex("foo4"));
+                }
+
+                GLTFSDK_TEST_METHOD(IndexedContainerTests, IndexedContainer_Test_RemoveMany)
+                {
+                    auto container = GetSampleContainer();
+
+                    Assert::ExpectException<GLTFException>([&container]()
+                    {
+                        container.RemoveMany({ "foo0", "foo100" });
+                    });
+
+                    Assert::AreEqual(size_t(6U), container.Size());
+
+                    const auto remap = container.RemoveMany({ "foo8", "foo0", "foo8" });
+
+                    Assert::IsTrue(remap == IndexRemap({ RemovedIndex, 0U, 1U, 2U, RemovedIndex, 3U }));
+
+                    Assert::AreEqual(size_t(4U), container.Size());
+                    Assert::AreEqual(size_t(0U), container.GetIndex("foo2"));
+                    Assert::AreEqual(size_t(3U), container.GetIndex("foo10"));
+                    Assert::IsTrue(container["foo6"].value == 6);
+                }
+
+                GLTFSDK_TEST_METHOD(IndexedContainerTests, IndexedContainer_Test_Rename)
+                {
+                    auto container = GetSampleContainer();
+
+                    container.Rename("foo4", "bar4");
+
+                    Assert::IsFalse(container.Has("foo4"));
+                    Assert::AreEqual(size_t(2U), container.GetIndex("bar4"));
+                    Assert::AreEqual(std::string("bar4"), container[2].id);
+
+                    Assert::ExpectException<GLTFException>([&container]()
+                    {
+                        container.Rename("bar4", "foo6");
+                    });
+
+                    Assert::ExpectException<GLTFException>([&container]()
+                    {
+                        container.Rename("foo4", "foo5");
+                    });
+
+                    Assert::AreEqual(size_t(2U), container.GetIndex("bar4"));
+                }
+
                 GLTFSDK_TEST_METHOD(IndexedContainerTests, IndexedContainer_Test_Replace)
                 {
                     auto container = GetSampleContainer();
@@ -266,6 +398,26 @@ namespace Microsoft
                     Assert::IsTrue(container.Elements().capacity() > capacity);
                 }
 
+                GLTFSDK_TEST_METHOD(IndexedContainerTests, IndexedContainer_Test_MemoryResource)
+                {
+                    std::pmr::monotonic_buffer_resource arena;
+
+                    IndexedContainer<Uint8WithId> container(&arena);
+                    container.Append({ "foo0", 0 });
+                    container.Append({ "foo2", 2 });
+
+                    Assert::IsTrue(container.GetMemoryResource() == &arena);
+                    Assert::IsTrue(container["foo2"].value == 2);
+
+                    // Copies don't share the resource, so that they can outlive it
+                    const auto copy = container;
+
+                    Assert::IsTrue(copy.GetMemoryResource() == std::pmr::get_default_resource());
+                    Assert::IsTrue(copy == container);
+
+                    Assert::IsTrue(GetSampleContainer().GetMemoryResource() == std::pmr::get_default_resource());
+                }
+
                 GLTFSDK_TEST_METHOD(IndexedContainerTests, IndexedContainer_Test_Size)
                 {
                     auto container = GetSampleContainer();
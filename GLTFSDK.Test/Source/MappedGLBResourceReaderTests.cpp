@@ -0,0 +1,125 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/Deserialize.h>
+#include <GLTFSDK/GLBResourceReader.h>
+#include <GLTFSDK/MappedGLBResourceReader.h>
+#include <GLTFSDK/MeshPrimitiveUtils.h>
+
+#include "TestResources.h"
+#include "TestUtils.h"
+
+using namespace glTF::UnitTest;
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(MappedGLBResourceReaderTests)
+            {
+                GLTFSDK_TEST_METHOD(MappedGLBResourceReaderTests, MappedGLBResourceReader_GetJson)
+                {
+                    auto readerWriter = std::make_shared<StreamReaderWriter>();
+
+                    GLBResourceReader streamReader(readerWriter, ReadLocalAsset(c_glbSampleBoxInterleaved));
+                    MappedGLBResourceReader mappedReader(readerWriter, GetAbsolutePath(c_glbSampleBoxInterleaved));
+
+                    Assert::AreEqual(streamReader.GetJson(), mappedReader.GetJson());
+                    Assert::AreEqual<size_t>(648U, mappedReader.GetBinaryChunk().size());
+                }
+
+                GLTFSDK_TEST_METHOD(MappedGLBResourceReaderTests, MappedGLBResourceReader_GetJsonChunk)
+                {
+                    auto readerWriter = std::make_shared<StreamReaderWriter>();
+
+                    GLBResourceReader streamReader(readerWriter, ReadLocalAsset(c_glbSampleBoxInterleaved));
+                    MappedGLBResourceReader mappedReader(readerWriter, GetAbsolutePath(c_glbSampleBoxInterleaved));
+
+                    const auto jsonChunk = mappedReader.GetJsonChunk();
+
+                    Assert::AreEqual(streamReader.GetJson(), std::string(streamReader.GetJsonChunk()));
+                    Assert::AreEqual(streamReader.GetJson(), std::string(jsonChunk));
+
+                    // The manifest must be viewed directly within the mapped file rather than a copy
+                    const auto fileData = mappedReader.GetMappedFile().GetData();
+                    Assert::IsTrue(reinterpret_cast<const uint8_t*>(jsonChunk.data()) >= fileData.data());
+                    Assert::IsTrue(reinterpret_cast<const uint8_t*>(jsonChunk.data() + jsonChunk.size()) <= fileData.data() + fileData.size());
+
+                    auto expected = Deserializer::Deserialize(streamReader.GetJson());
+                    auto actual = Deserializer::Deserialize(jsonChunk);
+
+                    Assert::IsTrue(*expected == *actual);
+                    Assert::AreEqual<size_t>(648U, mappedReader.GetBinaryChunk().size());
+                }
+
+                GLTFSDK_TEST_METHOD(MappedGLBResourceReaderTests, MappedGLBResourceReader_ReadBinaryData_Interleaved)
+                {
+                    auto readerWriter = std::make_shared<StreamReaderWriter>();
+
+                    GLBResourceReader streamReader(readerWriter, ReadLocalAsset(c_glbSampleBoxInterleaved));
+                    MappedGLBResourceReader mappedReader(readerWriter, GetAbsolutePath(c_glbSampleBoxInterleaved));
+
+                    auto doc = Deserializer::Deserialize(mappedReader.GetJson());
+
+                    const auto expected = MeshPrimitiveUtils::GetPositions(*doc, streamReader, doc->accessors.Get("2"));
+                    const auto actual = MeshPrimitiveUtils::GetPositions(*doc, mappedReader, doc->accessors.Get("2"));
+
+                    AreEqual(expected, actual);
+                }
+
+                GLTFSDK_TEST_METHOD(MappedGLBResourceReaderTests, MappedGLBResourceReader_GetBinaryDataView_Accessor)
+                {
+                    auto readerWriter = std::make_shared<StreamReaderWriter>();
+
+                    MappedGLBResourceReader mappedReader(readerWriter, GetAbsolutePath(c_glbSampleBoxInterleaved));
+
+                    auto doc = Deserializer::Deserialize(mappedReader.GetJson());
+                    const auto& accessor = doc->accessors.Get("0");
+
+                    const auto expected = mappedReader.ReadBinaryData<uint16_t>(*doc, accessor);
+                    const auto actual = mappedReader.GetBinaryDataView<uint16_t>(*doc, accessor);
+
+                    Assert::AreEqual<size_t>(36U, actual.size());
+                    Assert::IsTrue(std::equal(expected.begin(), expected.end(), actual.begin(), actual.end()));
+
+                    // The view must point directly into the mapped file rather than a copy
+                    const auto fileData = mappedReader.GetMappedFile().GetData();
+                    Assert::IsTrue(reinterpret_cast<const uint8_t*>(actual.data()) >= fileData.data());
+                    Assert::IsTrue(reinterpret_cast<const uint8_t*>(actual.data() + actual.size()) <= fileData.data() + fileData.size());
+                }
+
+                GLTFSDK_TEST_METHOD(MappedGLBResourceReaderTests, MappedGLBResourceReader_GetBinaryDataView_Interleaved)
+                {
+                    auto readerWriter = std::make_shared<StreamReaderWriter>();
+
+                    MappedGLBResourceReader mappedReader(readerWriter, GetAbsolutePath(c_glbSampleBoxInterleaved));
+
+                    auto doc = Deserializer::Deserialize(mappedReader.GetJson());
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        mappedReader.GetBinaryDataView<float>(*doc, doc->accessors.Get("2"));
+                    });
+
+                    // The whole interleaved bufferView can still be viewed in place
+                    const auto bufferViewData = mappedReader.GetBinaryDataView(*doc, doc->bufferViews.Get("1"));
+                    Assert::AreEqual<size_t>(576U, bufferViewData.size());
+                }
+
+                GLTFSDK_TEST_METHOD(MappedGLBResourceReaderTests, MappedGLBResourceReader_InvalidPath)
+                {
+                    auto readerWriter = std::make_shared<StreamReaderWriter>();
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        MappedGLBResourceReader mappedReader(readerWriter, GetAbsolutePath("Resources\\glb\\DoesNotExist.glb"));
+                    });
+                }
+            };
+        }
+    }
+}
@@ -148,6 +148,34 @@ namespace Microsoft
                     AreEqual(expected, output);
                 }
 
+                GLTFSDK_TEST_METHOD(MeshPrimitiveUtilsTests, MeshPrimitiveUtils_Test_GetIndices32Into_UnsignedByte)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+
+                    std::vector<uint8_t> indices = { 0, 1, 2, 3, 4, 5, 6, UINT8_MAX };
+                    auto accessor = bufferBuilder.AddAccessor(indices, { TYPE_SCALAR, COMPONENT_UNSIGNED_BYTE });
+
+                    auto doc = Document::create();
+                    bufferBuilder.Output(*doc);
+
+                    GLTFResourceReader reader(readerWriter);
+
+                    std::vector<uint32_t> output(indices.size(), UINT32_MAX);
+                    MeshPrimitiveUtils::GetIndices32Into(*doc, reader, accessor, output);
+
+                    std::vector<uint32_t> expected = { 0, 1, 2, 3, 4, 5, 6, UINT8_MAX };
+                    AreEqual(expected, output);
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        MeshPrimitiveUtils::GetIndices32Into(*doc, reader, accessor, std::span<uint32_t>(output).first(indices.size() - 1U));
+                    });
+                }
+
                 GLTFSDK_TEST_METHOD(MeshPrimitiveUtilsTests, MeshPrimitiveUtils_Test_GetPositions_Vec3_Float)
                 {
                     auto readerWriter = std::make_shared<const StreamReaderWriter>();
@@ -168,6 +196,30 @@ namespace Microsoft
                     AreEqual(positions, output);
                 }
 
+                GLTFSDK_TEST_METHOD(MeshPrimitiveUtilsTests, MeshPrimitiveUtils_Test_GetPositionsInto_Interleaved)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+
+                    std::vector<float> positions = { 0.1f, 0.2f, 0.3f, 0.4f, 0.5f, 0.6f, 0.7f, 0.8f, 0.9f };
+                    auto accessor = bufferBuilder.AddAccessor(positions, { TYPE_VEC3, COMPONENT_FLOAT });
+
+                    auto doc = Document::create();
+                    bufferBuilder.Output(*doc);
+
+                    GLTFResourceReader reader(readerWriter);
+
+                    // Write each position into a vertex with a trailing float that must be left untouched
+                    std::vector<float> vertices(12U, -1.0f);
+                    MeshPrimitiveUtils::GetPositionsInto(*doc, reader, accessor, vertices, 4U * sizeof(float));
+
+                    std::vector<float> expected = { 0.1f, 0.2f, 0.3f, -1.0f, 0.4f, 0.5f, 0.6f, -1.0f, 0.7f, 0.8f, 0.9f, -1.0f };
+                    AreEqual(expected, vertices);
+                }
+
                 GLTFSDK_TEST_METHOD(MeshPrimitiveUtilsTests, MeshPrimitiveUtils_Test_GetMorphPositions_Vec3_Float)
                 {
                     auto readerWriter = std::make_shared<const StreamReaderWriter>();
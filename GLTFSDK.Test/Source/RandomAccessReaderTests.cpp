@@ -0,0 +1,137 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/MemoryMappedFile.h>
+#include <GLTFSDK/RandomAccessReader.h>
+
+#include "TestResources.h"
+#include "TestUtils.h"
+
+#include <thread>
+
+using namespace glTF::UnitTest;
+
+namespace
+{
+    // Reads every 7 byte range of the reader's data from several threads at once and compares the
+    // results against the expected data
+    void ReadConcurrently(const Microsoft::glTF::IRandomAccessReader& reader, std::span<const uint8_t> expected)
+    {
+        std::vector<std::thread> threads;
+        std::vector<int> results(4U, 0);
+
+        for (size_t i = 0U; i < results.size(); ++i)
+        {
+            threads.emplace_back([&reader, &expected, &results, i]()
+            {
+                bool isEqual = true;
+
+                for (size_t offset = i; offset + 7U <= expected.size(); offset += 7U)
+                {
+                    uint8_t data[7U];
+                    reader.ReadAt(offset, data);
+
+                    isEqual = isEqual && std::equal(std::begin(data), std::end(data), expected.begin() + offset);
+                }
+
+                results[i] = isEqual ? 1 : 0;
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        Assert::IsTrue(std::all_of(results.begin(), results.end(), [](int result) { return result != 0; }), L"Concurrent reads returned unexpected data");
+    }
+}
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(RandomAccessReaderTests)
+            {
+                GLTFSDK_TEST_METHOD(RandomAccessReaderTests, MemoryRandomAccessReader_ReadAt)
+                {
+                    auto data = std::make_shared<std::vector<uint8_t>>(std::initializer_list<uint8_t>{ 0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U });
+
+                    MemoryRandomAccessReader reader(*data, data);
+
+                    Assert::AreEqual<uint64_t>(8U, reader.GetSize());
+
+                    std::vector<uint8_t> output(3U);
+                    reader.ReadAt(5U, output);
+
+                    Assert::IsTrue(output == std::vector<uint8_t>{ 5U, 6U, 7U });
+
+                    reader.ReadAt(8U, std::span<uint8_t>());
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        reader.ReadAt(6U, output);
+                    });
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        reader.ReadAt(9U, std::span<uint8_t>());
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(RandomAccessReaderTests, FileRandomAccessReader_ReadAt)
+                {
+                    const auto path = GetAbsolutePath(c_glbSampleBoxInterleaved);
+
+                    MemoryMappedFile file(path);
+                    FileRandomAccessReader reader(path);
+
+                    Assert::AreEqual<uint64_t>(file.GetSize(), reader.GetSize());
+
+                    std::vector<uint8_t> output(file.GetSize());
+                    reader.ReadAt(0U, output);
+
+                    Assert::IsTrue(std::equal(output.begin(), output.end(), file.GetData().begin(), file.GetData().end()));
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        reader.ReadAt(1U, output);
+                    });
+
+                    ReadConcurrently(reader, file.GetData());
+                }
+
+                GLTFSDK_TEST_METHOD(RandomAccessReaderTests, FileRandomAccessReader_InvalidPath)
+                {
+                    Assert::ExpectException<GLTFException>([]()
+                    {
+                        FileRandomAccessReader reader(GetAbsolutePath("Resources\\glb\\DoesNotExist.glb"));
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(RandomAccessReaderTests, StreamRandomAccessReader_ReadAt)
+                {
+                    std::vector<uint8_t> data(1000U);
+
+                    for (size_t i = 0U; i < data.size(); ++i)
+                    {
+                        data[i] = static_cast<uint8_t>(i * 13U);
+                    }
+
+                    auto stream = std::make_shared<std::stringstream>(std::string(data.begin(), data.end()));
+
+                    // Offsets are relative to the specified stream position
+                    StreamRandomAccessReader reader(stream, 100);
+
+                    Assert::AreEqual<uint64_t>(900U, reader.GetSize());
+
+                    ReadConcurrently(reader, std::span<const uint8_t>(data).subspan(100U));
+                }
+            };
+        }
+    }
+}
@@ -9,11 +9,103 @@
 
 #include "TestUtils.h"
 
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <string>
 
 using namespace glTF::UnitTest;
 
+namespace
+{
+    // The original per-character decoder, used as a reference for the vectorized Base64Decode implementation
+    std::vector<uint8_t> Base64DecodeReference(const std::string& encodedData, size_t bytesToSkip)
+    {
+        const auto decodeTable = Microsoft::glTF::GetDecodeTable();
+
+        std::vector<uint8_t> decodedData;
+
+        uint32_t block = 0U;
+        uint32_t blockBits = 0U;
+
+        for (const auto encodedChar : Microsoft::glTF::Base64StringView(encodedData))
+        {
+            block = (block << 6U) | decodeTable.at(static_cast<uint8_t>(encodedChar));
+            blockBits += 6U;
+
+            if (blockBits >= 8U)
+            {
+                blockBits -= 8U;
+
+                if (bytesToSkip > 0U)
+                {
+                    bytesToSkip--;
+                }
+                else
+                {
+                    decodedData.push_back(static_cast<uint8_t>(block >> blockBits));
+                }
+
+                block &= (1U << blockBits) - 1U;
+            }
+        }
+
+        return decodedData;
+    }
+
+    std::string GenerateBase64String(size_t charCount, uint32_t seed)
+    {
+        std::string encodedData(charCount, '\0');
+
+        for (auto& encodedChar : encodedData)
+        {
+            seed = seed * 1664525U + 1013904223U;
+            encodedChar = Microsoft::glTF::characterSet[(seed >> 16U) % 64U];
+        }
+
+        return encodedData;
+    }
+
+    // Converts every value of T, starting at unaligned addresses, and checks that ComponentsToFloats gives exactly the
+    // same results as the scalar conversions
+    template<typename T>
+    bool ComponentsToFloatsMatchesScalar(bool normalized)
+    {
+        const size_t componentCount = static_cast<size_t>(std::numeric_limits<T>::max()) - static_cast<size_t>(std::numeric_limits<T>::min()) + 1U;
+
+        std::vector<uint8_t> source(1U + componentCount * sizeof(T));
+
+        for (size_t i = 0U; i < componentCount; ++i)
+        {
+            const T component = static_cast<T>(std::numeric_limits<T>::min() + static_cast<int64_t>(i));
+            std::memcpy(source.data() + 1U + i * sizeof(T), &component, sizeof(T));
+        }
+
+        // Odd counts leave a tail that isn't a whole vector
+        for (size_t count : { componentCount, componentCount - 3U, size_t(5U) })
+        {
+            std::vector<uint8_t> destination(1U + count * sizeof(float));
+
+            Microsoft::glTF::ComponentsToFloats<T>(source.data() + 1U, destination.data() + 1U, count, normalized);
+
+            for (size_t i = 0U; i < count; ++i)
+            {
+                T component;
+                std::memcpy(&component, source.data() + 1U + i * sizeof(T), sizeof(T));
+
+                const float expected = normalized ? Microsoft::glTF::ComponentToFloat(component) : static_cast<float>(component);
+
+                if (std::memcmp(&expected, destination.data() + 1U + i * sizeof(float), sizeof(float)) != 0)
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+}
+
 namespace Microsoft
 {
     namespace glTF
@@ -320,6 +412,61 @@ namespace Microsoft
                     }
                 }
 
+                GLTFSDK_TEST_METHOD(ResourceReaderUtilsTest, TestBase64Decode_MatchesReference)
+                {
+                    // Lengths cover inputs shorter than, equal to and longer than each vector kernel's block size
+                    // with every possible partial trailing group, with and without padding and skipped bytes
+                    for (size_t charCount = 0U; charCount <= 300U; ++charCount)
+                    {
+                        for (const char* padding : { "", "=", "==" })
+                        {
+                            const std::string encodedData = GenerateBase64String(charCount, static_cast<uint32_t>(charCount)) + padding;
+                            const size_t byteCount = Base64StringView(encodedData).GetByteCount();
+
+                            for (size_t bytesToSkip : { 0U, 1U, 2U, 3U, 4U, 7U, 40U })
+                            {
+                                if (bytesToSkip > byteCount)
+                                {
+                                    continue;
+                                }
+
+                                const auto expected = Base64DecodeReference(encodedData, bytesToSkip);
+
+                                std::vector<uint8_t> actual(byteCount - bytesToSkip);
+                                Base64Decode(Base64StringView(encodedData), Base64BufferView(actual), bytesToSkip);
+
+                                Assert::IsTrue(expected == actual, L"Unexpected result decoding base64 data");
+                            }
+                        }
+                    }
+                }
+
+                GLTFSDK_TEST_METHOD(ResourceReaderUtilsTest, TestBase64Decode_InvalidCharPositions)
+                {
+                    // An invalid character must be detected wherever it falls within a vector block or the scalar tail
+                    const std::string validData = GenerateBase64String(203U, 1U);
+
+                    for (size_t position = 0U; position < validData.size(); ++position)
+                    {
+                        for (char invalidChar : { '\t', '=', '-', '.', '@', '[', '`', '{', static_cast<char>(0x80), static_cast<char>(0xFF) })
+                        {
+                            std::string encodedData = validData;
+                            encodedData[position] = invalidChar;
+
+                            // A trailing '=' is padding rather than an invalid character
+                            if (invalidChar == '=' && position == validData.size() - 1U)
+                            {
+                                continue;
+                            }
+
+                            Assert::ExpectException<GLTFException>([&encodedData]()
+                            {
+                                Base64Decode(encodedData);
+                            });
+                        }
+                    }
+                }
+
                 GLTFSDK_TEST_METHOD(ResourceReaderUtilsTest, TestIsUriBase64)
                 {
                     std::string::const_iterator itBegin;
@@ -327,6 +474,52 @@ namespace Microsoft
 
                     Assert::IsTrue(IsUriBase64("data:image/png;base64,/+==", itBegin, itEnd));
                 }
+
+                GLTFSDK_TEST_METHOD(ResourceReaderUtilsTest, TestCopyStrided)
+                {
+                    // Cover the scalar fallback as well as each vector kernel's element sizes, with both tightly
+                    // packed and strided destinations and element counts that leave a scalar tail
+                    for (size_t elementSize : { 1U, 2U, 3U, 4U, 8U, 12U, 16U, 20U, 24U, 32U, 36U })
+                    {
+                        for (size_t sourceStride : { elementSize, elementSize + 4U, elementSize + 12U, size_t(252U) })
+                        {
+                            for (size_t destinationStride : { elementSize, elementSize + 8U })
+                            {
+                                const size_t elementCount = 37U;
+
+                                std::vector<uint8_t> source((elementCount - 1U) * sourceStride + elementSize);
+
+                                for (size_t i = 0U; i < source.size(); ++i)
+                                {
+                                    source[i] = static_cast<uint8_t>(i * 7U + 1U);
+                                }
+
+                                std::vector<uint8_t> expected((elementCount - 1U) * destinationStride + elementSize, 0xFFU);
+                                std::vector<uint8_t> actual(expected.size(), 0xFFU);
+
+                                for (size_t i = 0U; i < elementCount; ++i)
+                                {
+                                    std::copy_n(source.begin() + i * sourceStride, elementSize, expected.begin() + i * destinationStride);
+                                }
+
+                                CopyStrided(source.data(), sourceStride, actual.data(), destinationStride, elementSize, elementCount);
+
+                                Assert::IsTrue(expected == actual, L"Unexpected result copying strided elements");
+                            }
+                        }
+                    }
+                }
+
+                GLTFSDK_TEST_METHOD(ResourceReaderUtilsTest, TestComponentsToFloats)
+                {
+                    for (bool normalized : { false, true })
+                    {
+                        Assert::IsTrue(ComponentsToFloatsMatchesScalar<int8_t>(normalized), L"Unexpected result converting int8_t components");
+                        Assert::IsTrue(ComponentsToFloatsMatchesScalar<uint8_t>(normalized), L"Unexpected result converting uint8_t components");
+                        Assert::IsTrue(ComponentsToFloatsMatchesScalar<int16_t>(normalized), L"Unexpected result converting int16_t components");
+                        Assert::IsTrue(ComponentsToFloatsMatchesScalar<uint16_t>(normalized), L"Unexpected result converting uint16_t components");
+                    }
+                }
             };
         }
     }
@@ -0,0 +1,320 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/Schema.h>
+#include <GLTFSDK/SchemaValidation.h>
+
+#include "TestUtils.h"
+
+#include <functional>
+#include <thread>
+
+using namespace glTF::UnitTest;
+
+namespace
+{
+    class MapSchemaLocator : public Microsoft::glTF::ISchemaLocator
+    {
+    public:
+        MapSchemaLocator(std::unordered_map<std::string, std::string> schemaUriMap) : schemaUriMap(std::move(schemaUriMap))
+        {
+        }
+
+        const char* GetSchemaContent(const std::string& uri) const override
+        {
+            ++requestCount;
+            return schemaUriMap.at(uri).c_str();
+        }
+
+        mutable size_t requestCount = 0U;
+
+    private:
+        std::unordered_map<std::string, std::string> schemaUriMap;
+    };
+
+    const char* c_testSchemaUri = "test.schema.json";
+    const char* c_testSchema = R"({ "type": "object", "required": [ "value" ] })";
+
+    // Documents exercising each kind of constraint used by the glTF schemas
+    const char* c_schemaTestDocuments[] = {
+        R"({ "asset": { "version": "2.0" } })",
+        R"({ })",
+        R"({ "asset": { "version": "2" } })",
+        R"({ "asset": { "version": "2.0" }, "accessors": [ { "componentType": 1, "count": 1, "type": "SCALAR" } ] })",
+        R"({ "asset": { "version": "2.0" }, "accessors": [ { "componentType": 5126, "count": 1, "type": "SCALAR", "byteOffset": 4 } ] })",
+        R"({ "asset": { "version": "2.0" }, "bufferViews": [ { "buffer": 0, "byteLength": 4, "byteStride": 6 } ] })",
+        R"({ "asset": { "version": "2.0" }, "bufferViews": [ { "buffer": 0, "byteLength": 4, "byteStride": 256 } ] })",
+        R"({ "asset": { "version": "2.0" }, "cameras": [ { "type": "perspective", "perspective": { "yfov": 0, "znear": 1 }, "orthographic": { "xmag": 1, "ymag": 1, "zfar": 2, "znear": 1 } } ] })",
+        R"({ "asset": { "version": "2.0" }, "cameras": [ { "type": "perspective", "perspective": { "yfov": 0, "znear": 1 } } ] })",
+        R"({ "asset": { "version": "2.0" }, "images": [ { } ] })",
+        R"({ "asset": { "version": "2.0" }, "images": [ { "uri": "a.png", "bufferView": 0, "mimeType": "image/png" } ] })",
+        R"({ "asset": { "version": "2.0" }, "nodes": [ { "children": [ 1, 1 ] } ] })",
+        R"({ "asset": { "version": "2.0" }, "nodes": [ { "matrix": [ 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 ], "scale": [ 1, 1, 1 ] } ] })",
+        R"({ "asset": { "version": "2.0" }, "nodes": [ { "rotation": [ 0, 0, 0, 2 ] } ] })",
+        R"({ "asset": { "version": "2.0" }, "meshes": [ { "primitives": [ { "attributes": { } } ] } ] })",
+        R"({ "asset": { "version": "2.0" }, "meshes": [ { "primitives": [ { "attributes": { "POSITION": -1 } } ] } ] })",
+        R"({ "asset": { "version": "2.0" }, "extensionsUsed": [ "KHR_a", "KHR_a" ] })",
+        R"({ "asset": { "version": "2.0" }, "materials": [ { "alphaCutoff": 0.5 } ] })",
+        R"({ "asset": { "version": "2.0" }, "materials": [ { "pbrMetallicRoughness": { "baseColorFactor": [ 1, 1, 1, 1.5 ] } } ] })",
+        R"({ "asset": { "version": "2.0" }, "samplers": [ { "magFilter": 9728, "wrapS": 1 } ] })",
+        R"({ "asset": { "version": "2.0" }, "extensions": { "KHR_a": 1 } })"
+    };
+
+    // A manifest with enough nodes and accessors to be split into several chunks
+    nlohmann::json CreateLargeManifest()
+    {
+        auto manifest = nlohmann::json::parse(R"({ "asset": { "version": "2.0" }, "scenes": [ { "nodes": [ 0 ] } ], "scene": 0 })");
+
+        for (size_t i = 0U; i < 40U; ++i)
+        {
+            manifest["nodes"].push_back({ { "name", "node" + std::to_string(i) }, { "translation", { 1.0, 2.0, 3.0 } } });
+            manifest["accessors"].push_back({ { "componentType", 5126 }, { "count", 1 }, { "type", "SCALAR" } });
+        }
+
+        return manifest;
+    }
+
+    std::string GetViolation(const std::function<void()>& validate)
+    {
+        try
+        {
+            validate();
+        }
+        catch (const Microsoft::glTF::ValidationException& ex)
+        {
+            return ex.what();
+        }
+
+        return {};
+    }
+
+    std::string GetViolation(const Microsoft::glTF::SchemaValidator& validator, const nlohmann::json& json, const std::string& rootContext = {})
+    {
+        try
+        {
+            validator.Validate(json, rootContext);
+        }
+        catch (const Microsoft::glTF::ValidationException& ex)
+        {
+            return ex.what();
+        }
+
+        return {};
+    }
+}
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(SchemaValidationTests)
+            {
+                GLTFSDK_TEST_METHOD(SchemaValidationTests, GetSchemaValidator_SchemaFlags)
+                {
+                    auto validator = GetSchemaValidator(SCHEMA_URI_ACCESSOR, SchemaFlags::None);
+
+                    Assert::IsTrue(validator == GetSchemaValidator(SCHEMA_URI_ACCESSOR, SchemaFlags::None), L"The compiled schema wasn't cached");
+                    Assert::IsTrue(validator != GetSchemaValidator(SCHEMA_URI_ACCESSOR, SchemaFlags::DisableSchemaAccessor), L"Schemas for different flags were shared");
+                    Assert::IsTrue(validator != GetSchemaValidator(SCHEMA_URI_BUFFER, SchemaFlags::None), L"Schemas for different uris were shared");
+
+                    const auto invalidAccessor = nlohmann::json::parse(R"({ "componentType": 5126, "count": 0, "type": "SCALAR" })");
+
+                    Assert::ExpectException<ValidationException>([&]()
+                    {
+                        validator->Validate(invalidAccessor);
+                    });
+
+                    // The accessor schema is disabled, any JSON is accepted
+                    GetSchemaValidator(SCHEMA_URI_ACCESSOR, SchemaFlags::DisableSchemaAccessor)->Validate(invalidAccessor);
+                }
+
+                GLTFSDK_TEST_METHOD(SchemaValidationTests, GetSchemaValidator_Concurrent)
+                {
+                    const auto schemaFlags = SchemaFlags::DisableSchemaExtras | SchemaFlags::DisableSchemaExtension;
+
+                    std::vector<std::shared_ptr<const SchemaValidator>> validators(8U);
+                    std::vector<std::thread> threads;
+
+                    for (size_t i = 0U; i < validators.size(); ++i)
+                    {
+                        threads.emplace_back([&validators, schemaFlags, i]()
+                        {
+                            validators[i] = GetSchemaValidator(SCHEMA_URI_GLTF, schemaFlags);
+                        });
+                    }
+
+                    for (auto& thread : threads)
+                    {
+                        thread.join();
+                    }
+
+                    for (const auto& validator : validators)
+                    {
+                        Assert::IsTrue(validator && validator == validators.front(), L"Concurrent requests compiled the schema more than once");
+                    }
+                }
+
+                GLTFSDK_TEST_METHOD(SchemaValidationTests, SchemaValidationEngine_SameViolations)
+                {
+                    for (auto schemaFlags : { SchemaFlags::None, SchemaFlags::DisableSchemaId | SchemaFlags::DisableSchemaNode })
+                    {
+                        auto nativeValidator = GetSchemaValidator(SCHEMA_URI_GLTF, schemaFlags, SchemaValidationEngine::Native);
+                        auto valijsonValidator = GetSchemaValidator(SCHEMA_URI_GLTF, schemaFlags, SchemaValidationEngine::Valijson);
+
+                        Assert::IsFalse(valijsonValidator->IsNative());
+                        Assert::IsTrue(nativeValidator != valijsonValidator, L"Validators for different engines were shared");
+
+                        for (const auto document : c_schemaTestDocuments)
+                        {
+                            const auto json = nlohmann::json::parse(document);
+
+                            Assert::AreEqual(GetViolation(*valijsonValidator, json), GetViolation(*nativeValidator, json));
+                        }
+                    }
+
+                    const auto accessor = nlohmann::json::parse(R"({ "componentType": 5126, "count": 1, "type": "VEC5" })");
+
+                    Assert::AreEqual(
+                        GetViolation(*GetSchemaValidator(SCHEMA_URI_ACCESSOR, SchemaFlags::None, SchemaValidationEngine::Valijson), accessor, "<root>[accessors][2]"),
+                        GetViolation(*GetSchemaValidator(SCHEMA_URI_ACCESSOR, SchemaFlags::None, SchemaValidationEngine::Native), accessor, "<root>[accessors][2]"));
+                }
+
+                GLTFSDK_TEST_METHOD(SchemaValidationTests, SchemaValidationEngine_Native)
+                {
+                    // The native engine is opt-in, valijson remains the default
+                    Assert::IsFalse(GetSchemaValidator(SCHEMA_URI_GLTF, SchemaFlags::None)->IsNative());
+
+                    auto validator = GetSchemaValidator(SCHEMA_URI_GLTF, SchemaFlags::None, SchemaValidationEngine::Native);
+
+                    if (!validator->IsNative())
+                    {
+                        return; // Built without GLTFSDK_NATIVE_SCHEMA_VALIDATION
+                    }
+
+                    Assert::AreEqual("Schema violation at <root>[nodes][0][children] due to Elements at indexes #0 and #1 violate uniqueness constraint.",
+                        GetViolation(*validator, nlohmann::json::parse(R"({ "asset": { "version": "2.0" }, "nodes": [ { "children": [ 1, 1 ] } ] })")).c_str());
+
+                    // Disabling the node schema skips the node's constraints, the root schema still applies
+                    const auto nodeDocument = nlohmann::json::parse(R"({ "asset": { "version": "2.0" }, "nodes": [ { "children": [ 1, 1 ] } ], "scene": -1, "scenes": [ { } ] })");
+
+                    Assert::AreEqual("Schema violation at <root>[scene] due to Expected number greater than or equal to 0.000000",
+                        GetViolation(*GetSchemaValidator(SCHEMA_URI_GLTF, SchemaFlags::DisableSchemaNode, SchemaValidationEngine::Native), nodeDocument).c_str());
+                    Assert::IsTrue(GetViolation(*GetSchemaValidator(SCHEMA_URI_GLTF, SchemaFlags::DisableSchemaNode | SchemaFlags::DisableSchemaId, SchemaValidationEngine::Native), nodeDocument).empty());
+                    Assert::IsTrue(GetViolation(*GetSchemaValidator(SCHEMA_URI_GLTF, SchemaFlags::DisableSchemaRoot, SchemaValidationEngine::Native), nlohmann::json::parse("[]")).empty());
+
+                    Assert::ExpectException<GLTFException>([]()
+                    {
+                        SchemaValidator(c_testSchemaUri, SchemaFlags::None);
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(SchemaValidationTests, ValidateDocumentAgainstSchema_Executor)
+                {
+                    const std::vector<std::pair<std::function<void(nlohmann::json&)>, std::string>> cases = {
+                        { [](nlohmann::json&) {}, "" },
+                        { [](nlohmann::json& manifest)
+                            {
+                                manifest["nodes"][30]["scale"] = { 1.0 };
+                                manifest["nodes"][21]["mesh"] = -1;
+                            }, "Schema violation at <root>[nodes][21][mesh] due to Expected number greater than or equal to 0.000000" },
+                        { [](nlohmann::json& manifest)
+                            {
+                                manifest["nodes"][1]["mesh"] = -1;
+                                manifest["accessors"][35]["count"] = 0;
+                            }, "Schema violation at <root>[accessors][35][count] due to Expected number greater than or equal to 1.000000" },
+                        { [](nlohmann::json& manifest)
+                            {
+                                manifest["accessors"][0]["count"] = 0;
+                                manifest.erase("scenes");
+                            }, "Schema violation at <root> due to Missing dependency 'scenes'." },
+                        { [](nlohmann::json& manifest)
+                            {
+                                manifest["nodes"][39]["mesh"] = -1;
+                                manifest["asset"]["version"] = "2";
+                            }, "Schema violation at <root>[asset][version] due to Failed to match regex specified by 'pattern' constraint." },
+                        { [](nlohmann::json& manifest)
+                            {
+                                manifest["accessors"][0]["count"] = 0;
+                                manifest["asset"]["version"] = "2";
+                            }, "Schema violation at <root>[accessors][0][count] due to Expected number greater than or equal to 1.000000" },
+                        { [](nlohmann::json& manifest)
+                            {
+                                manifest["nodes"][5]["mesh"] = -1;
+                                manifest.erase("asset");
+                            }, "Schema violation at <root>[nodes][5][mesh] due to Expected number greater than or equal to 0.000000" },
+                        { [](nlohmann::json& manifest)
+                            {
+                                manifest["nodes"] = nlohmann::json::array();
+                            }, "Schema violation at <root>[nodes] due to Array should contain no fewer than 1 elements." }
+                    };
+
+                    ThreadExecutor executor(4U);
+
+                    for (const auto& testCase : cases)
+                    {
+                        auto manifest = CreateLargeManifest();
+                        testCase.first(manifest);
+
+                        for (auto schemaEngine : { SchemaValidationEngine::Native, SchemaValidationEngine::Valijson })
+                        {
+                            Assert::AreEqual(testCase.second, GetViolation([&]() { ValidateDocumentAgainstSchema(manifest, SCHEMA_URI_GLTF, SchemaFlags::None, schemaEngine); }));
+
+                            for (size_t chunkSize : { size_t(1U), size_t(7U), DefaultValidationChunkSize })
+                            {
+                                Assert::AreEqual(testCase.second, GetViolation([&]() { ValidateDocumentAgainstSchema(manifest, SchemaFlags::None, executor, chunkSize, schemaEngine); }));
+                            }
+                        }
+                    }
+
+                    // Disabled element schemas aren't validated
+                    auto manifest = CreateLargeManifest();
+                    manifest["nodes"][3]["mesh"] = -1;
+
+                    ValidateDocumentAgainstSchema(manifest, SchemaFlags::DisableSchemaNode, executor, 4U);
+                    ValidateDocumentAgainstSchema(manifest, SchemaFlags::DisableSchemaRoot, executor, 4U);
+                }
+
+                GLTFSDK_TEST_METHOD(SchemaValidationTests, GetSchemaValidator_SchemaLocator)
+                {
+                    auto schemaLocator = std::make_shared<MapSchemaLocator>(std::unordered_map<std::string, std::string>{ { c_testSchemaUri, c_testSchema } });
+
+                    auto validator = GetSchemaValidator(c_testSchemaUri, schemaLocator);
+                    const size_t requestCount = schemaLocator->requestCount;
+
+                    Assert::IsTrue(validator == GetSchemaValidator(c_testSchemaUri, schemaLocator), L"The compiled schema wasn't cached");
+                    Assert::AreEqual(requestCount, schemaLocator->requestCount, L"The schema was located again");
+
+                    validator->Validate(nlohmann::json::parse(R"({ "value": 1 })"));
+
+                    Assert::ExpectException<ValidationException>([&]()
+                    {
+                        try
+                        {
+                            validator->Validate(nlohmann::json::parse(R"({ "other": 1 })"), "<root>[test]");
+                        }
+                        catch (const ValidationException& ex)
+                        {
+                            Assert::AreEqual("Schema violation at <root>[test] due to Missing required property 'value'.", ex.what());
+                            throw;
+                        }
+                    });
+
+                    // A different locator instance, even one serving the same content, compiles its own schema
+                    auto otherSchemaLocator = std::make_shared<MapSchemaLocator>(std::unordered_map<std::string, std::string>{ { c_testSchemaUri, c_testSchema } });
+
+                    Assert::IsTrue(validator != GetSchemaValidator(c_testSchemaUri, otherSchemaLocator));
+                    Assert::AreEqual(size_t(1U), otherSchemaLocator->requestCount);
+
+                    Assert::ExpectException<GLTFException>([]()
+                    {
+                        GetSchemaValidator(c_testSchemaUri, std::shared_ptr<const ISchemaLocator>());
+                    });
+                }
+            };
+        }
+    }
+}
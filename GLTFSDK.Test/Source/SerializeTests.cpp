@@ -4,9 +4,14 @@
 #include "stdafx.h"
 
 #include <GLTFSDK/GLTF.h>
+#include <GLTFSDK/Executor.h>
+#include <GLTFSDK/ExtensionsKHR.h>
 #include <GLTFSDK/Serialize.h>
 #include <GLTFSDK/Deserialize.h>
 
+#include "TestResources.h"
+#include "TestUtils.h"
+
 using namespace glTF::UnitTest;
 
 namespace
@@ -212,6 +217,243 @@ namespace Microsoft
                     Assert::AreEqual(output.c_str(), c_expectedDefaultDocumentAndNonDefaultSceneAsDefault);
                 }
 
+                GLTFSDK_TEST_METHOD(SerializeTests, SerializeStream_MatchesSerialize)
+                {
+                    const auto extensionDeserializer = KHR::GetKHRExtensionDeserializer();
+
+                    for (auto path : { c_cubeJson, c_validMorphTarget, c_riggedSimpleJson, c_simpleSparseAccessor, c_validCameraJson, c_cameraWithExtensions, c_textureTransformTestJson, c_dracoBox })
+                    {
+                        auto doc = Deserializer::Deserialize(ReadLocalJson(path), extensionDeserializer);
+                        doc->extras = R"({"name": "value", "array": [1, 2.5, "\u00e9"]})";
+
+                        for (bool pretty : { false, true })
+                        {
+                            std::stringstream stream;
+                            Serializer::Serialize(*doc, stream, pretty);
+
+                            Assert::AreEqual(Serializer::Serialize(doc, pretty), stream.str());
+                        }
+                    }
+
+                    auto doc = Document::create();
+
+                    std::stringstream stream;
+                    Serializer::Serialize(*doc, stream, true);
+
+                    Assert::AreEqual(std::string(c_expectedDefaultDocument), stream.str());
+                }
+
+                GLTFSDK_TEST_METHOD(SerializeTests, SerializeStream_DirectlyWrittenElements)
+                {
+                    // Exercises every member of the accessors, bufferViews, meshes and nodes that are written without a DOM
+                    auto doc = Document::create();
+                    doc->extensionsUsed.insert("EXT_test");
+
+                    Buffer buffer;
+                    buffer.id = "buffer";
+                    buffer.byteLength = 1024U;
+                    doc->buffers.Append(std::move(buffer));
+
+                    BufferView bufferView;
+                    bufferView.id = "bufferView0";
+                    bufferView.bufferId = "buffer";
+                    bufferView.byteLength = 512U;
+                    doc->bufferViews.Append(std::move(bufferView));
+
+                    bufferView = {};
+                    bufferView.id = "bufferView1";
+                    bufferView.name = "Quote \" backslash \\ tab \t é";
+                    bufferView.bufferId = "buffer";
+                    bufferView.byteOffset = 512U;
+                    bufferView.byteLength = 512U;
+                    bufferView.byteStride = 12U;
+                    bufferView.target = ARRAY_BUFFER;
+                    bufferView.extras = R"({"b": [1, 2.5], "a": {"nested": null}})";
+                    bufferView.extensions.emplace("EXT_test", nlohmann::json::parse(R"({"value": [1, {"x": true}]})"));
+                    doc->bufferViews.Append(std::move(bufferView));
+
+                    Accessor accessor;
+                    accessor.id = "accessor0";
+                    accessor.componentType = COMPONENT_FLOAT;
+                    accessor.type = TYPE_VEC3;
+                    accessor.count = 3U;
+                    doc->accessors.Append(std::move(accessor));
+
+                    accessor = {};
+                    accessor.id = "accessor1";
+                    accessor.name = "Accessor";
+                    accessor.bufferViewId = "bufferView1";
+                    accessor.byteOffset = 4U;
+                    accessor.componentType = COMPONENT_UNSIGNED_BYTE;
+                    accessor.normalized = true;
+                    accessor.type = TYPE_VEC4;
+                    accessor.count = 8U;
+                    accessor.min = { -0.0f, 0.1f, 1e-7f, -3.4e38f };
+                    accessor.max = { 1.0f, 255.0f, 1e20f, std::numeric_limits<float>::infinity() };
+                    accessor.sparse.count = 2U;
+                    accessor.sparse.indicesBufferViewId = "bufferView0";
+                    accessor.sparse.indicesComponentType = COMPONENT_UNSIGNED_SHORT;
+                    accessor.sparse.indicesByteOffset = 16U;
+                    accessor.sparse.valuesBufferViewId = "bufferView1";
+                    accessor.extras = "[true]";
+                    doc->accessors.Append(std::move(accessor));
+
+                    accessor = {};
+                    accessor.id = "accessor2";
+                    accessor.componentType = COMPONENT_FLOAT;
+                    accessor.type = TYPE_SCALAR;
+                    accessor.count = 1U;
+                    accessor.sparse.count = 1U;
+                    accessor.sparse.indicesBufferViewId = "bufferView1";
+                    accessor.sparse.indicesComponentType = COMPONENT_UNSIGNED_BYTE;
+                    accessor.sparse.valuesBufferViewId = "bufferView0";
+                    accessor.sparse.valuesByteOffset = 8U;
+                    doc->accessors.Append(std::move(accessor));
+
+                    Material material;
+                    material.id = "material";
+                    doc->materials.Append(std::move(material));
+
+                    MeshPrimitive primitive;
+                    primitive.attributes = { { ACCESSOR_POSITION, "accessor0" }, { "COLOR_0", "accessor1" }, { "_custom", "accessor2" }, { "TEXCOORD_0", "accessor0" } };
+                    primitive.indicesAccessorId = "accessor2";
+                    primitive.materialId = "material";
+                    primitive.mode = MESH_POINTS;
+                    primitive.targets.resize(3U);
+                    primitive.targets[0].positionsAccessorId = "accessor0";
+                    primitive.targets[0].normalsAccessorId = "accessor1";
+                    primitive.targets[0].tangentsAccessorId = "accessor2";
+                    primitive.targets[2].normalsAccessorId = "accessor0";
+                    primitive.extras = R"({"primitive": 1})";
+
+                    Mesh mesh;
+                    mesh.id = "mesh0";
+                    mesh.name = "Mesh";
+                    mesh.primitives.push_back(std::move(primitive));
+                    mesh.primitives.emplace_back();
+                    mesh.weights = { 0.25f, 0.75f };
+                    mesh.extensions.emplace("EXT_test", nlohmann::json::object());
+                    doc->meshes.Append(std::move(mesh));
+
+                    mesh = {};
+                    mesh.id = "mesh1";
+                    doc->meshes.Append(std::move(mesh));
+
+                    Camera camera("camera", "", std::make_unique<Perspective>(0.1f, 1.0f));
+                    doc->cameras.Append(std::move(camera));
+
+                    Skin skin;
+                    skin.id = "skin";
+                    doc->skins.Append(std::move(skin));
+
+                    // An empty node, one with a matrix, one with every TRS property and one with morph target weights
+                    Node node;
+                    node.id = "node0";
+                    doc->nodes.Append(std::move(node));
+
+                    node = {};
+                    node.id = "node1";
+                    node.matrix.values[12] = 2.0f;
+                    node.children = { "node0", "node3" };
+                    node.cameraId = "camera";
+                    doc->nodes.Append(std::move(node));
+
+                    node = {};
+                    node.id = "node2";
+                    node.name = "TRS";
+                    node.meshId = "mesh0";
+                    node.skinId = "skin";
+                    node.translation = { 1.0f, 2.0f, 3.0f };
+                    node.rotation = { 0.0f, 0.7071068f, 0.0f, 0.7071068f };
+                    node.scale = { 2.0f, 2.0f, 2.0f };
+                    node.extensions.emplace("EXT_test", 1);
+                    doc->nodes.Append(std::move(node));
+
+                    node = {};
+                    node.id = "node3";
+                    node.translation = { 0.0f, 0.5f, 0.0f };
+                    node.weights = { 0.5f, 0.5f };
+                    doc->nodes.Append(std::move(node));
+
+                    const ThreadExecutor executor(2U);
+
+                    for (bool pretty : { false, true })
+                    {
+                        const auto expected = Serializer::Serialize(doc, pretty);
+
+                        std::stringstream stream;
+                        Serializer::Serialize(*doc, stream, pretty);
+
+                        Assert::AreEqual(expected, stream.str());
+
+                        std::stringstream parallelStream;
+                        Serializer::Serialize(*doc, parallelStream, executor, pretty, 1U);
+
+                        Assert::AreEqual(expected, parallelStream.str());
+                    }
+
+                    // Nodes with both a matrix and TRS properties can't be serialized either way
+                    node = {};
+                    node.id = "invalid";
+                    node.matrix.values[12] = 2.0f;
+                    node.scale = { 2.0f, 2.0f, 2.0f };
+                    doc->nodes.Append(std::move(node));
+
+                    Assert::ExpectException<DocumentException>([&doc]
+                    {
+                        std::stringstream stream;
+                        Serializer::Serialize(*doc, stream, true);
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(SerializeTests, SerializeStream_Executor)
+                {
+                    const auto extensionDeserializer = KHR::GetKHRExtensionDeserializer();
+                    const ThreadExecutor executor(4U);
+
+                    for (auto path : { c_cubeJson, c_riggedSimpleJson, c_textureTransformTestJson })
+                    {
+                        auto doc = Deserializer::Deserialize(ReadLocalJson(path), extensionDeserializer);
+
+                        for (size_t i = 0; i < 100; ++i)
+                        {
+                            Node node;
+                            node.id = "extraNode" + std::to_string(i);
+                            node.name = "Node " + std::to_string(i);
+                            doc->nodes.Append(std::move(node));
+                        }
+
+                        for (bool pretty : { false, true })
+                        {
+                            const auto expected = Serializer::Serialize(doc, pretty);
+
+                            for (size_t chunkSize : { 1U, 7U, 64U, 4096U })
+                            {
+                                std::stringstream stream;
+                                Serializer::Serialize(*doc, stream, executor, pretty, chunkSize);
+
+                                Assert::AreEqual(expected, stream.str());
+                            }
+
+                            std::stringstream stream;
+                            Serializer::Serialize(*doc, stream, SequentialExecutor(), pretty);
+
+                            Assert::AreEqual(expected, stream.str());
+                        }
+                    }
+
+                    std::stringstream stream;
+                    Serializer::Serialize(*Document::create(), stream, executor, true);
+
+                    Assert::AreEqual(std::string(c_expectedDefaultDocument), stream.str());
+
+                    Assert::ExpectException<GLTFException>([&executor]
+                    {
+                        std::stringstream stream;
+                        Serializer::Serialize(*Document::create(), stream, executor, false, 0U);
+                    });
+                }
+
                 GLTFSDK_TEST_METHOD(SerializeTests, InvalidDefaultScene)
                 {
                     Scene scene;
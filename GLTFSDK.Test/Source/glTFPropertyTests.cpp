@@ -81,6 +81,33 @@ namespace Microsoft
 
                     Assert::IsFalse(node1 == node3);
                 }
+
+                GLTFSDK_TEST_METHOD(glTFPropertyTests, RegisteredExtensionMoved)
+                {
+                    Node node1;
+                    node1.SetExtension<TestExtension<0>>();
+                    node1.extensions.emplace("EXT_unregistered", nlohmann::json::object());
+
+                    const auto* extension = &node1.GetExtension<TestExtension<0>>();
+
+                    // Moving a property transfers its extensions rather than cloning them
+                    Node node2(std::move(node1));
+
+                    Assert::IsTrue(extension == &node2.GetExtension<TestExtension<0>>());
+                    Assert::IsTrue(node2.HasUnregisteredExtension("EXT_unregistered"));
+
+                    Node node3;
+                    node3 = std::move(node2);
+
+                    Assert::IsTrue(extension == &node3.GetExtension<TestExtension<0>>());
+                    Assert::IsTrue(node3.HasUnregisteredExtension("EXT_unregistered"));
+
+                    // Copies still clone them
+                    Node node4(node3);
+
+                    Assert::IsTrue(extension != &node4.GetExtension<TestExtension<0>>());
+                    Assert::IsTrue(node3 == node4);
+                }
             };
         }
     }
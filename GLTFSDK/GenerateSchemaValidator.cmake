@@ -0,0 +1,527 @@
+# Copyright (c) Microsoft Corporation. All rights reserved.
+# Licensed under the MIT License.
+
+# Auto-generates the C++ header implementing native validation of the glTF schemas as a pre-build step.
+# Refer to https://github.com/KhronosGroup/glTF/tree/2.0/specification/2.0/schema
+#
+# Usage: cmake -DSCHEMA_DIR=<schema directory> -DOUTPUT_PATH=<output directory> -P GenerateSchemaValidator.cmake
+# Both paths must be absolute.
+#
+# Each schema becomes a function that checks a JSON value against it, evaluating the constraints in the order valijson
+# applies them so that the first violation found, and the way it is described, match what valijson reports for the same
+# document. The generated code relies on the NativeSchemaValidation::Context class defined by SchemaValidation.cpp,
+# the only translation unit that includes the header. Unsupported schema keywords are reported as errors rather than
+# ignored so that schema updates can't silently weaken validation.
+
+cmake_minimum_required(VERSION 3.19) # string(JSON)
+
+if(NOT IS_ABSOLUTE "${SCHEMA_DIR}" OR NOT IS_ABSOLUTE "${OUTPUT_PATH}")
+    message(FATAL_ERROR "Usage: cmake -DSCHEMA_DIR=<schema directory> -DOUTPUT_PATH=<output directory> -P GenerateSchemaValidator.cmake")
+endif()
+
+set(HEADER_FILE "${OUTPUT_PATH}/SchemaValidatorNative.h")
+
+# Keywords that describe a schema without constraining the values it accepts
+set(ANNOTATION_KEYWORDS "$schema" "title" "description" "default" "gltf_detailedDescription" "gltf_sectionDescription" "gltf_uriType" "gltf_webgl")
+
+set(SUPPORTED_KEYWORDS
+    "$ref" "type" "allOf" "anyOf" "dependencies" "enum" "format" "items" "maximum" "exclusiveMaximum" "maxItems" "maxProperties"
+    "minimum" "exclusiveMinimum" "minItems" "minProperties" "multipleOf" "not" "oneOf" "pattern" "properties" "additionalProperties"
+    "required" "uniqueItems")
+
+set_property(GLOBAL PROPERTY SCHEMA_DECLARATIONS "")
+set_property(GLOBAL PROPERTY SCHEMA_DEFINITIONS "")
+
+# Escapes value as a C++ string literal
+function(cpp_string value out)
+    string(REPLACE "\\" "\\\\" value "${value}")
+    string(REPLACE "\"" "\\\"" value "${value}")
+    set(${out} "\"${value}\"" PARENT_SCOPE)
+endfunction()
+
+function(schema_function_name uri out)
+    string(MAKE_C_IDENTIFIER "${uri}" name)
+    set(${out} "${name}" PARENT_SCOPE)
+endfunction()
+
+# Returns the members of a JSON object, sorted as valijson's std::map and std::set based containers order them
+function(json_members json out)
+    set(members "")
+    string(JSON count LENGTH "${json}")
+    if(count GREATER 0)
+        math(EXPR last "${count} - 1")
+        foreach(i RANGE ${last})
+            string(JSON member MEMBER "${json}" ${i})
+            list(APPEND members "${member}")
+        endforeach()
+    endif()
+    list(SORT members)
+    set(${out} "${members}" PARENT_SCOPE)
+endfunction()
+
+# Returns the elements of a JSON array of strings
+function(json_strings json out)
+    set(values "")
+    string(JSON count LENGTH "${json}")
+    if(count GREATER 0)
+        math(EXPR last "${count} - 1")
+        foreach(i RANGE ${last})
+            string(JSON value GET "${json}" ${i})
+            list(APPEND values "${value}")
+        endforeach()
+    endif()
+    set(${out} "${values}" PARENT_SCOPE)
+endfunction()
+
+function(json_optional json key out)
+    string(JSON value ERROR_VARIABLE error GET "${json}" "${key}")
+    if(error)
+        set(value "")
+    endif()
+    set(${out} "${value}" PARENT_SCOPE)
+endfunction()
+
+# Returns the C++ expression comparing the value being validated with an enum value, the same way valijson's strict
+# equalTo does: numbers are compared as doubles regardless of whether they are integers
+function(enum_condition json index out)
+    string(JSON type TYPE "${json}" ${index})
+    string(JSON value GET "${json}" ${index})
+    if(type STREQUAL "STRING")
+        cpp_string("${value}" literal)
+        set(condition "(value.is_string() && value.get_ref<const std::string&>() == ${literal})")
+    elseif(type STREQUAL "NUMBER")
+        set(condition "(value.is_number() && value.get<double>() == static_cast<double>(${value}))")
+    elseif(type STREQUAL "BOOLEAN")
+        if(value)
+            set(condition "(value.is_boolean() && value.get<bool>())")
+        else()
+            set(condition "(value.is_boolean() && !value.get<bool>())")
+        endif()
+    elseif(type STREQUAL "NULL")
+        set(condition "value.is_null()")
+    else()
+        message(FATAL_ERROR "${CURRENT_SCHEMA_URI}: ${type} enum values are not supported")
+    endif()
+    set(${out} "${condition}" PARENT_SCOPE)
+endfunction()
+
+# Returns the C++ expression testing whether the value being validated has the JSON schema type
+function(type_condition type out)
+    if(type STREQUAL "array")
+        set(condition "value.is_array()")
+    elseif(type STREQUAL "boolean")
+        set(condition "value.is_boolean()")
+    elseif(type STREQUAL "integer")
+        set(condition "value.is_number_integer()")
+    elseif(type STREQUAL "null")
+        set(condition "value.is_null()")
+    elseif(type STREQUAL "number")
+        set(condition "value.is_number()")
+    elseif(type STREQUAL "object")
+        set(condition "value.is_object()")
+    elseif(type STREQUAL "string")
+        set(condition "value.is_string()")
+    else()
+        message(FATAL_ERROR "${CURRENT_SCHEMA_URI}: unsupported type '${type}'")
+    endif()
+    set(${out} "${condition}" PARENT_SCOPE)
+endfunction()
+
+# As generate_schema, returning the runtime function accepting any value for schemas without constraints. Used by
+# keywords whose outcome depends on the result of a subschema rather than just its errors.
+function(generate_subschema schema out)
+    generate_schema("${schema}" "" "" name)
+    if(name STREQUAL "")
+        set(name "AcceptAny")
+    endif()
+    set(${out} "${name}" PARENT_SCOPE)
+endfunction()
+
+# Emits the function validating a value against schema and returns its name. Subschema functions are named after
+# the schema file they belong to, schemas without any constraints return an empty name as there is nothing to call.
+# If name is given the function is always emitted under that name and its body starts with prologue.
+function(generate_schema schema name prologue out)
+    string(JSON schemaType TYPE "${schema}")
+    if(NOT schemaType STREQUAL "OBJECT")
+        message(FATAL_ERROR "${CURRENT_SCHEMA_URI}: schemas must be objects")
+    endif()
+
+    json_members("${schema}" keywords)
+
+    foreach(keyword IN LISTS keywords)
+        if(NOT keyword IN_LIST SUPPORTED_KEYWORDS AND NOT keyword IN_LIST ANNOTATION_KEYWORDS)
+            message(FATAL_ERROR "${CURRENT_SCHEMA_URI}: unsupported keyword '${keyword}'")
+        endif()
+    endforeach()
+
+    set(body "")
+
+    # A draft 4 $ref replaces the schema it appears in, any other keywords alongside it are ignored
+    if("$ref" IN_LIST keywords)
+        string(JSON ref GET "${schema}" "$ref")
+        if(ref MATCHES "#")
+            message(FATAL_ERROR "${CURRENT_SCHEMA_URI}: only references to whole schema files are supported")
+        endif()
+        schema_function_name("${ref}" refName)
+        if(name STREQUAL "")
+            set(${out} "${refName}" PARENT_SCOPE)
+            return()
+        endif()
+        string(APPEND body "    return ${refName}(value, context);\n")
+    else()
+        # The constraints are generated in the order valijson's SchemaParser adds them to a schema
+        if("type" IN_LIST keywords)
+            string(JSON type GET "${schema}" "type")
+            if(type STREQUAL "any")
+                # Accepts any value
+            else()
+                type_condition("${type}" condition)
+                string(APPEND body "    if (!${condition}) return context.Fail(\"Value type not permitted by 'type' constraint.\");\n")
+            endif()
+        endif()
+
+        if("allOf" IN_LIST keywords)
+            string(JSON count LENGTH "${schema}" "allOf")
+            math(EXPR last "${count} - 1")
+            foreach(i RANGE ${last})
+                string(JSON child GET "${schema}" "allOf" ${i})
+                generate_schema("${child}" "" "" childName)
+                if(NOT childName STREQUAL "")
+                    string(APPEND body "    if (!${childName}(value, context)) return false;\n")
+                endif()
+            endforeach()
+        endif()
+
+        if("anyOf" IN_LIST keywords)
+            set(children "")
+            string(JSON count LENGTH "${schema}" "anyOf")
+            math(EXPR last "${count} - 1")
+            foreach(i RANGE ${last})
+                string(JSON child GET "${schema}" "anyOf" ${i})
+                generate_subschema("${child}" childName)
+                list(APPEND children "&${childName}")
+            endforeach()
+            list(JOIN children ", " children)
+            string(APPEND body "    if (!context.AnyOf(value, { ${children} })) return false;\n")
+        endif()
+
+        if("dependencies" IN_LIST keywords)
+            string(JSON dependencies GET "${schema}" "dependencies")
+            json_members("${dependencies}" names)
+            # valijson checks all the property dependencies before any of the schema dependencies
+            foreach(name IN LISTS names)
+                string(JSON dependencyType TYPE "${dependencies}" "${name}")
+                if(dependencyType STREQUAL "ARRAY")
+                    string(JSON dependency GET "${dependencies}" "${name}")
+                    json_strings("${dependency}" dependencyNames)
+                    list(SORT dependencyNames)
+                    list(REMOVE_DUPLICATES dependencyNames)
+                    cpp_string("${name}" nameLiteral)
+                    string(APPEND body "    if (value.is_object() && value.contains(${nameLiteral}))\n    {\n")
+                    foreach(dependencyName IN LISTS dependencyNames)
+                        cpp_string("${dependencyName}" dependencyLiteral)
+                        cpp_string("Missing dependency '${dependencyName}'." message)
+                        string(APPEND body "        if (!value.contains(${dependencyLiteral})) return context.Fail(${message});\n")
+                    endforeach()
+                    string(APPEND body "    }\n")
+                elseif(NOT dependencyType STREQUAL "OBJECT")
+                    message(FATAL_ERROR "${CURRENT_SCHEMA_URI}: dependencies must be arrays or schemas")
+                endif()
+            endforeach()
+            foreach(name IN LISTS names)
+                string(JSON dependencyType TYPE "${dependencies}" "${name}")
+                if(dependencyType STREQUAL "OBJECT")
+                    string(JSON dependency GET "${dependencies}" "${name}")
+                    generate_schema("${dependency}" "" "" childName)
+                    if(NOT childName STREQUAL "")
+                        cpp_string("${name}" nameLiteral)
+                        string(APPEND body "    if (value.is_object() && value.contains(${nameLiteral}) && !${childName}(value, context)) return false;\n")
+                    endif()
+                endif()
+            endforeach()
+        endif()
+
+        if("enum" IN_LIST keywords)
+            set(conditions "")
+            string(JSON enum GET "${schema}" "enum")
+            string(JSON count LENGTH "${enum}")
+            math(EXPR last "${count} - 1")
+            foreach(i RANGE ${last})
+                enum_condition("${enum}" ${i} condition)
+                list(APPEND conditions "${condition}")
+            endforeach()
+            list(JOIN conditions " || " conditions)
+            string(APPEND body "    if (!(${conditions})) return context.Fail(\"Failed to match against any enum values.\");\n")
+        endif()
+
+        if("format" IN_LIST keywords)
+            # valijson only checks the date and time formats, the glTF schemas use none of them
+            string(JSON format GET "${schema}" "format")
+            if(format STREQUAL "date" OR format STREQUAL "time" OR format STREQUAL "date-time")
+                message(FATAL_ERROR "${CURRENT_SCHEMA_URI}: format '${format}' is not supported")
+            endif()
+        endif()
+
+        if("items" IN_LIST keywords)
+            string(JSON itemsType TYPE "${schema}" "items")
+            if(NOT itemsType STREQUAL "OBJECT")
+                message(FATAL_ERROR "${CURRENT_SCHEMA_URI}: only a single items schema is supported")
+            endif()
+            string(JSON items GET "${schema}" "items")
+            generate_schema("${items}" "" "" childName)
+            if(NOT childName STREQUAL "")
+                string(APPEND body "    if (value.is_array())\n    {\n")
+                string(APPEND body "        for (size_t i = 0U; i < value.size(); ++i)\n        {\n")
+                string(APPEND body "            Context::Scope scope(context, i);\n")
+                string(APPEND body "            if (!${childName}(value[i], context)) return false;\n")
+                string(APPEND body "        }\n    }\n")
+            endif()
+        endif()
+
+        if("maximum" IN_LIST keywords)
+            string(JSON maximum GET "${schema}" "maximum")
+            json_optional("${schema}" "exclusiveMaximum" exclusive)
+            if(exclusive)
+                string(APPEND body "    if (value.is_number() && value.get<double>() >= ${maximum}) return context.Fail(\"Expected number less than \", ${maximum});\n")
+            else()
+                string(APPEND body "    if (value.is_number() && value.get<double>() > ${maximum}) return context.Fail(\"Expected number less than or equal to \", ${maximum});\n")
+            endif()
+        endif()
+
+        if("maxItems" IN_LIST keywords)
+            string(JSON maxItems GET "${schema}" "maxItems")
+            string(APPEND body "    if (value.is_array() && value.size() > ${maxItems}U) return context.Fail(\"Array should contain no more than ${maxItems} elements.\");\n")
+        endif()
+
+        if("maxProperties" IN_LIST keywords)
+            string(JSON maxProperties GET "${schema}" "maxProperties")
+            string(APPEND body "    if (value.is_object() && value.size() > ${maxProperties}U) return context.Fail(\"Object should have no more than ${maxProperties} properties.\");\n")
+        endif()
+
+        if("minimum" IN_LIST keywords)
+            string(JSON minimum GET "${schema}" "minimum")
+            json_optional("${schema}" "exclusiveMinimum" exclusive)
+            if(exclusive)
+                string(APPEND body "    if (value.is_number() && value.get<double>() <= ${minimum}) return context.Fail(\"Expected number greater than \", ${minimum});\n")
+            else()
+                string(APPEND body "    if (value.is_number() && value.get<double>() < ${minimum}) return context.Fail(\"Expected number greater than or equal to \", ${minimum});\n")
+            endif()
+        endif()
+
+        if("minItems" IN_LIST keywords)
+            string(JSON minItems GET "${schema}" "minItems")
+            string(APPEND body "    if (value.is_array() && value.size() < ${minItems}U) return context.Fail(\"Array should contain no fewer than ${minItems} elements.\");\n")
+        endif()
+
+        if("minProperties" IN_LIST keywords)
+            string(JSON minProperties GET "${schema}" "minProperties")
+            string(APPEND body "    if (value.is_object() && value.size() < ${minProperties}U) return context.Fail(\"Object should have no fewer than ${minProperties} properties.\");\n")
+        endif()
+
+        if("multipleOf" IN_LIST keywords)
+            string(JSON divisor GET "${schema}" "multipleOf")
+            if(divisor MATCHES "^[0-9]+$")
+                string(APPEND body "    if (!Context::IsMultipleOf(value, INT64_C(${divisor}))) return context.Fail(\"Value should be a multiple of ${divisor}\");\n")
+            else()
+                string(APPEND body "    if (!Context::IsMultipleOf(value, ${divisor})) return context.Fail(\"Value should be a multiple of \", ${divisor});\n")
+            endif()
+        endif()
+
+        if("not" IN_LIST keywords)
+            string(JSON child GET "${schema}" "not")
+            generate_subschema("${child}" childName)
+            string(APPEND body "    if (!context.Not(value, &${childName})) return false;\n")
+        endif()
+
+        if("oneOf" IN_LIST keywords)
+            set(children "")
+            string(JSON count LENGTH "${schema}" "oneOf")
+            math(EXPR last "${count} - 1")
+            foreach(i RANGE ${last})
+                string(JSON child GET "${schema}" "oneOf" ${i})
+                generate_subschema("${child}" childName)
+                list(APPEND children "&${childName}")
+            endforeach()
+            list(JOIN children ", " children)
+            string(APPEND body "    if (!context.OneOf(value, { ${children} })) return false;\n")
+        endif()
+
+        if("pattern" IN_LIST keywords)
+            string(JSON pattern GET "${schema}" "pattern")
+            string(APPEND body "    if (value.is_string())\n    {\n")
+            string(APPEND body "        static const std::regex pattern(R\"pattern(${pattern})pattern\");\n")
+            string(APPEND body "        if (!std::regex_search(value.get_ref<const std::string&>(), pattern)) return context.Fail(\"Failed to match regex specified by 'pattern' constraint.\");\n")
+            string(APPEND body "    }\n")
+        endif()
+
+        if("properties" IN_LIST keywords OR "additionalProperties" IN_LIST keywords)
+            set(propertiesBody "")
+            set(propertyNames "")
+
+            if("properties" IN_LIST keywords)
+                string(JSON properties GET "${schema}" "properties")
+                json_members("${properties}" propertyNames)
+                foreach(propertyName IN LISTS propertyNames)
+                    string(JSON property GET "${properties}" "${propertyName}")
+                    generate_schema("${property}" "" "" childName)
+                    if(NOT childName STREQUAL "")
+                        cpp_string("${propertyName}" nameLiteral)
+                        string(APPEND propertiesBody "        if (auto it = value.find(${nameLiteral}); it != value.end())\n        {\n")
+                        string(APPEND propertiesBody "            Context::Scope scope(context, it.key());\n")
+                        string(APPEND propertiesBody "            if (!${childName}(*it, context)) return false;\n")
+                        string(APPEND propertiesBody "        }\n")
+                    endif()
+                endforeach()
+            endif()
+
+            json_optional("${schema}" "additionalProperties" additionalProperties)
+            string(JSON additionalType ERROR_VARIABLE error TYPE "${schema}" "additionalProperties")
+            set(additionalName "")
+            if(additionalType STREQUAL "OBJECT")
+                generate_schema("${additionalProperties}" "" "" additionalName)
+            endif()
+
+            if(additionalType STREQUAL "BOOLEAN" AND NOT additionalProperties OR NOT additionalName STREQUAL "")
+                set(conditions "")
+                foreach(propertyName IN LISTS propertyNames)
+                    cpp_string("${propertyName}" nameLiteral)
+                    list(APPEND conditions "it.key() != ${nameLiteral}")
+                endforeach()
+                if(conditions STREQUAL "")
+                    set(conditions "true")
+                endif()
+                list(JOIN conditions " && " conditions)
+                string(APPEND propertiesBody "        for (auto it = value.begin(); it != value.end(); ++it)\n        {\n")
+                string(APPEND propertiesBody "            if (${conditions})\n            {\n")
+                if(additionalName STREQUAL "")
+                    string(APPEND propertiesBody "                return context.Fail(\"Object contains a property that could not be validated using 'properties' or 'additionalProperties' constraints: '\" + it.key() + \"'.\");\n")
+                else()
+                    string(APPEND propertiesBody "                Context::Scope scope(context, it.key());\n")
+                    string(APPEND propertiesBody "                if (!${additionalName}(*it, context)) return false;\n")
+                endif()
+                string(APPEND propertiesBody "            }\n        }\n")
+            endif()
+
+            if(NOT propertiesBody STREQUAL "")
+                string(APPEND body "    if (value.is_object())\n    {\n${propertiesBody}    }\n")
+            endif()
+        endif()
+
+        if("required" IN_LIST keywords)
+            string(JSON required GET "${schema}" "required")
+            json_strings("${required}" requiredNames)
+            list(SORT requiredNames)
+            list(REMOVE_DUPLICATES requiredNames)
+            if(requiredNames)
+                string(APPEND body "    if (value.is_object())\n    {\n")
+                foreach(requiredName IN LISTS requiredNames)
+                    cpp_string("${requiredName}" nameLiteral)
+                    cpp_string("Missing required property '${requiredName}'." message)
+                    string(APPEND body "        if (!value.contains(${nameLiteral})) return context.Fail(${message});\n")
+                endforeach()
+                string(APPEND body "    }\n")
+            endif()
+        endif()
+
+        if("uniqueItems" IN_LIST keywords)
+            string(JSON uniqueItems GET "${schema}" "uniqueItems")
+            if(uniqueItems)
+                string(APPEND body "    if (!context.UniqueItems(value)) return false;\n")
+            endif()
+        endif()
+    endif()
+
+    if(body STREQUAL "" AND prologue STREQUAL "" AND name STREQUAL "")
+        set(${out} "" PARENT_SCOPE)
+        return()
+    endif()
+
+    # Parameters that the function doesn't use are left unnamed so that it compiles without warnings, e.g. the value
+    # of a schema that only has the prologue checking whether it is disabled
+    set(valueParameter "const nlohmann::json&")
+    set(contextParameter "Context&")
+    string(FIND "${prologue}${body}" "value" valueUsed)
+    string(FIND "${prologue}${body}" "context" contextUsed)
+    if(NOT valueUsed EQUAL -1)
+        set(valueParameter "const nlohmann::json& value")
+    endif()
+    if(NOT contextUsed EQUAL -1)
+        set(contextParameter "Context& context")
+    endif()
+    set(parameters "${valueParameter}, ${contextParameter}")
+
+    if(name STREQUAL "")
+        get_property(index GLOBAL PROPERTY SCHEMA_FUNCTION_INDEX_${CURRENT_SCHEMA_NAME})
+        if(NOT index)
+            set(index 0)
+        endif()
+        math(EXPR index "${index} + 1")
+        set_property(GLOBAL PROPERTY SCHEMA_FUNCTION_INDEX_${CURRENT_SCHEMA_NAME} ${index})
+        set(name "${CURRENT_SCHEMA_NAME}_${index}")
+    endif()
+
+    set_property(GLOBAL APPEND_STRING PROPERTY SCHEMA_DECLARATIONS "static bool ${name}(const nlohmann::json& value, Context& context);\n")
+    set_property(GLOBAL APPEND_STRING PROPERTY SCHEMA_DEFINITIONS "\nstatic bool ${name}(${parameters})\n{\n${prologue}${body}    return true;\n}\n")
+
+    set(${out} "${name}" PARENT_SCOPE)
+endfunction()
+
+file(GLOB schema_files RELATIVE "${SCHEMA_DIR}" "${SCHEMA_DIR}/*.schema.json")
+list(SORT schema_files)
+
+set(validator_map "")
+
+foreach(schema_file IN LISTS schema_files)
+    file(READ "${SCHEMA_DIR}/${schema_file}" schema)
+
+    set(CURRENT_SCHEMA_URI "${schema_file}")
+    schema_function_name("${schema_file}" CURRENT_SCHEMA_NAME)
+
+    cpp_string("${schema_file}" uriLiteral)
+    set(prologue "    static const SchemaFlags schemaFlag = GetSchemaFlag(${uriLiteral});\n    if (context.IsDisabled(schemaFlag)) return true;\n")
+
+    generate_schema("${schema}" "${CURRENT_SCHEMA_NAME}" "${prologue}" name)
+
+    string(APPEND validator_map "    { ${uriLiteral}, &${CURRENT_SCHEMA_NAME} },\n")
+endforeach()
+
+get_property(declarations GLOBAL PROPERTY SCHEMA_DECLARATIONS)
+get_property(definitions GLOBAL PROPERTY SCHEMA_DEFINITIONS)
+
+set(header "// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+// WARNING: This header file was automatically generated
+// by GenerateSchemaValidator.cmake.
+// Modifying this code by hand is not recommended.
+
+#pragma once
+
+#include <cstdint>
+#include <regex>
+#include <string>
+#include <unordered_map>
+
+namespace Microsoft
+{
+namespace glTF
+{
+namespace NativeSchemaValidation
+{
+${declarations}${definitions}
+const std::unordered_map<std::string, ValidateFn> SCHEMA_VALIDATOR_MAP = {
+${validator_map}};
+}
+}
+}
+")
+
+# Only touch the header when its content changes to avoid needless rebuilds
+if(EXISTS "${HEADER_FILE}")
+    file(READ "${HEADER_FILE}" existing_header)
+    if(existing_header STREQUAL header)
+        return()
+    endif()
+endif()
+
+file(WRITE "${HEADER_FILE}" "${header}")
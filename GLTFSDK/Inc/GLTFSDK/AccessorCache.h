@@ -0,0 +1,146 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/GLTF.h>
+
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        class Document;
+
+        // Holds decoded accessor data so that repeated reads of the same accessor, e.g. an index buffer shared by
+        // several primitives or keyframe times shared by several animation samplers, are only decoded once. Entries
+        // are keyed by the reader that decoded them, the Document, accessor id and the type the data was requested
+        // as. Each entry keeps a copy of the accessor it was read from and is only returned for an identical accessor.
+        // Entries should be cleared with Clear(document) when a document is modified or destroyed, a reader's entries
+        // are cleared when it is destroyed. Entries are evicted in 'Least Recently Used' (LRU) order once the data
+        // would exceed the byte budget, entries larger than the whole budget are never cached. Used by
+        // GLTFResourceReader::ReadCachedBinaryData and ReadCachedFloatData.
+        class AccessorCache
+        {
+        public:
+            // The type accessor data converted to floats by GLTFResourceReader::ReadFloatData is cached as, so that it
+            // is kept separate from the same accessor's float components read by ReadBinaryData<float>
+            struct FloatData {};
+
+            // Identifies the reader that decoded an entry's data. Readers over different resources can decode different
+            // data for the same Document and accessor, so each reader's entries are kept separate. Ids are unique for
+            // the lifetime of the process, unlike the address of a reader.
+            typedef uint64_t ReaderId;
+
+            static constexpr size_t DefaultByteBudget = 64U * 1024U * 1024U;
+
+            static ReaderId CreateReaderId();
+
+            explicit AccessorCache(size_t byteBudget = DefaultByteBudget);
+
+            AccessorCache(const AccessorCache&) = delete;
+            AccessorCache& operator=(const AccessorCache&) = delete;
+
+            // Returns the cached data for the accessor requested as type Key, or nullptr if there is none. Counts a hit or a miss.
+            template<typename T, typename Key = T>
+            std::shared_ptr<const std::vector<T>> Get(ReaderId readerId, const Document& document, const Accessor& accessor)
+            {
+                return std::static_pointer_cast<const std::vector<T>>(Get(readerId, document, accessor, typeid(Key)));
+            }
+
+            // Caches the accessor's data requested as type Key, replacing any existing entry. The data is returned
+            // whether or not it fits in the byte budget.
+            template<typename T, typename Key = T>
+            std::shared_ptr<const std::vector<T>> Set(ReaderId readerId, const Document& document, const Accessor& accessor, std::vector<T> data)
+            {
+                const size_t byteCount = data.size() * sizeof(T);
+
+                auto sharedData = std::make_shared<const std::vector<T>>(std::move(data));
+                Set(readerId, document, accessor, typeid(Key), sharedData, byteCount);
+                return sharedData;
+            }
+
+            void Clear();
+
+            // Removes all the entries read from the document
+            void Clear(const Document& document);
+
+            // Removes all the entries decoded by the reader
+            void Clear(ReaderId readerId);
+
+            // Changing the budget evicts entries as necessary to fit within the new one, zero disables caching
+            void SetByteBudget(size_t byteBudget);
+
+            size_t GetByteBudget() const;
+            size_t GetByteCount() const;
+            size_t Size() const;
+
+            size_t GetHitCount() const;
+            size_t GetMissCount() const;
+
+            void ResetCounters();
+
+        private:
+            struct Key
+            {
+                ReaderId readerId;
+                const Document* document;
+                std::string accessorId;
+                std::type_index type;
+
+                bool operator==(const Key& other) const
+                {
+                    return readerId == other.readerId && document == other.document && accessorId == other.accessorId && type == other.type;
+                }
+            };
+
+            struct KeyHash
+            {
+                size_t operator()(const Key& key) const
+                {
+                    size_t hash = std::hash<ReaderId>()(key.readerId);
+                    hash ^= std::hash<const Document*>()(key.document) + 0x9E3779B9U + (hash << 6) + (hash >> 2);
+                    hash ^= std::hash<std::string>()(key.accessorId) + 0x9E3779B9U + (hash << 6) + (hash >> 2);
+                    hash ^= key.type.hash_code() + 0x9E3779B9U + (hash << 6) + (hash >> 2);
+                    return hash;
+                }
+            };
+
+            struct Entry
+            {
+                Key key;
+                Accessor accessor;
+                std::shared_ptr<const void> data;
+                size_t byteCount;
+            };
+
+            typedef std::list<Entry> EntryList;
+
+            std::shared_ptr<const void> Get(ReaderId readerId, const Document& document, const Accessor& accessor, std::type_index type);
+            void Set(ReaderId readerId, const Document& document, const Accessor& accessor, std::type_index type, std::shared_ptr<const void> data, size_t byteCount);
+
+            void Erase(EntryList::iterator it);
+            void Evict(size_t byteBudget);
+
+            mutable std::mutex m_mutex;
+
+            size_t m_byteBudget;
+            size_t m_byteCount;
+
+            size_t m_hitCount;
+            size_t m_missCount;
+
+            EntryList m_entries;
+            std::unordered_map<Key, EntryList::iterator, KeyHash> m_entryMap;
+        };
+    }
+}
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <span>
 #include <vector>
 
 namespace Microsoft
@@ -34,6 +35,25 @@ namespace Microsoft
 
             std::vector<float> GetMorphWeights(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor);
             std::vector<float> GetMorphWeights(const Document& doc, const GLTFResourceReader& reader, const AnimationSampler& accessor);
+
+            // Variants that decode into caller-provided memory rather than allocating a new vector
+            void GetKeyframeTimesInto(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, std::span<float> output);
+            void GetKeyframeTimesInto(const Document& doc, const GLTFResourceReader& reader, const AnimationSampler& sampler, std::span<float> output);
+
+            void GetInverseBindMatricesInto(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, std::span<float> output);
+            void GetInverseBindMatricesInto(const Document& doc, const GLTFResourceReader& reader, const Skin& skin, std::span<float> output);
+
+            void GetTranslationsInto(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, std::span<float> output);
+            void GetTranslationsInto(const Document& doc, const GLTFResourceReader& reader, const AnimationSampler& sampler, std::span<float> output);
+
+            void GetRotationsInto(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, std::span<float> output);
+            void GetRotationsInto(const Document& doc, const GLTFResourceReader& reader, const AnimationSampler& sampler, std::span<float> output);
+
+            void GetScalesInto(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, std::span<float> output);
+            void GetScalesInto(const Document& doc, const GLTFResourceReader& reader, const AnimationSampler& sampler, std::span<float> output);
+
+            void GetMorphWeightsInto(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, std::span<float> output);
+            void GetMorphWeightsInto(const Document& doc, const GLTFResourceReader& reader, const AnimationSampler& sampler, std::span<float> output);
         };
     }
 }
@@ -0,0 +1,125 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/Deserialize.h>
+#include <GLTFSDK/Document.h>
+#include <GLTFSDK/Executor.h>
+#include <GLTFSDK/GLTFResourceReader.h>
+#include <GLTFSDK/IStreamReader.h>
+
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        class ExtensionDeserializer;
+
+        // An asset to be loaded by BatchLoader. The manifest, either a .gltf or a .glb file, is read from the
+        // IStreamReader created for the asset's root, as are any external buffers and images it references.
+        struct BatchAsset
+        {
+            std::string root;
+            std::string manifest;
+        };
+
+        struct BatchLoaderOptions
+        {
+            // Used to deserialize every asset. Assets are already loaded concurrently so there is usually no benefit in
+            // also setting deserializeOptions.executor.
+            DeserializeOptions deserializeOptions;
+
+            // Shared by every asset, may be null
+            std::shared_ptr<ExtensionDeserializer> extensionDeserializer;
+
+            // Whether every accessor's data is also read, see BatchLoadResult::accessors
+            bool decodeAccessors = false;
+
+            // The maximum number of assets loaded at once by Load, zero uses std::thread::hardware_concurrency
+            size_t threadCount = 0U;
+        };
+
+        // The outcome of loading a single asset. Either exception is set or document and resourceReader are.
+        struct BatchLoadResult
+        {
+            BatchAsset asset;
+
+            std::shared_ptr<Document>           document;
+            std::shared_ptr<GLTFResourceReader> resourceReader; // A GLBResourceReader for .glb assets
+
+            // Every accessor's components if BatchLoaderOptions::decodeAccessors was set, in the same order as the
+            // document's accessors. The requests point into the document so it must not be modified while they're used.
+            std::vector<AccessorReadRequest> accessors;
+
+            std::exception_ptr exception;
+            std::string        error; // The exception's message
+
+            size_t manifestByteCount = 0U;
+            size_t decodedByteCount = 0U;
+            double milliseconds = 0.0;
+
+            bool IsSuccess() const { return !exception; }
+        };
+
+        // Totals over every asset loaded by a BatchLoader since it was created or its stats were last reset.
+        // milliseconds is the wall clock time spent in Load, not the sum of the time spent on each asset.
+        struct BatchLoadStats
+        {
+            size_t assetCount = 0U;
+            size_t failureCount = 0U;
+            size_t manifestByteCount = 0U;
+            size_t decodedByteCount = 0U;
+            double milliseconds = 0.0;
+
+            double GetAssetsPerSecond() const;
+            double GetManifestMegabytesPerSecond() const;
+        };
+
+        // Loads many assets at once, each one parsed, validated and optionally decoded on a bounded pool of threads.
+        // Idle threads claim the next unloaded asset so that a few large assets don't hold up the small ones. Every
+        // asset gets its own IStreamReader and resource reader while the extension deserializer, and the schemas the
+        // assets are validated against, are shared (schemas are compiled once per process, see SchemaValidation.h).
+        // A failure to load one asset is reported in its result and doesn't affect the others.
+        class BatchLoader
+        {
+        public:
+            // Creates the IStreamReader used to read an asset's files from the asset's root
+            typedef std::function<std::shared_ptr<const IStreamReader>(const std::string& root)> StreamReaderFactory;
+
+            explicit BatchLoader(StreamReaderFactory streamReaderFactory, BatchLoaderOptions options = {});
+
+            BatchLoader(const BatchLoader&) = delete;
+            BatchLoader& operator=(const BatchLoader&) = delete;
+
+            // Returns a result for every asset, in the same order as the assets
+            std::vector<BatchLoadResult> Load(const std::vector<BatchAsset>& assets) const;
+
+            // As above but the assets are loaded using the executor rather than on options.threadCount threads
+            std::vector<BatchLoadResult> Load(const std::vector<BatchAsset>& assets, const IExecutor& executor) const;
+
+            // Loads a single asset on the calling thread
+            BatchLoadResult Load(const BatchAsset& asset) const;
+
+            BatchLoadStats GetStats() const;
+            void ResetStats();
+
+            const BatchLoaderOptions& GetOptions() const { return m_options; }
+
+        private:
+            void LoadAsset(BatchLoadResult& result) const;
+
+            StreamReaderFactory m_streamReaderFactory;
+            BatchLoaderOptions  m_options;
+
+            mutable std::mutex     m_statsMutex;
+            mutable BatchLoadStats m_stats;
+        };
+    }
+}
@@ -81,25 +81,13 @@ namespace Microsoft
             // So only 1 version of std::unordered_map binary code is generated.
             void Output(Document& gltfDocument)
             {
-                for (auto& buffer : m_buffers.Elements())
-                {
-                    gltfDocument.buffers.Append(std::move(buffer), AppendIdPolicy::ThrowOnEmpty);
-                }
-
+                gltfDocument.buffers.AppendRange(m_buffers.Elements(), AppendIdPolicy::ThrowOnEmpty);
                 m_buffers.Clear();
 
-                for (auto& bufferView : m_bufferViews.Elements())
-                {
-                    gltfDocument.bufferViews.Append(std::move(bufferView), AppendIdPolicy::ThrowOnEmpty);
-                }
-
+                gltfDocument.bufferViews.AppendRange(m_bufferViews.Elements(), AppendIdPolicy::ThrowOnEmpty);
                 m_bufferViews.Clear();
 
-                for (auto& accessor : m_accessors.Elements())
-                {
-                    gltfDocument.accessors.Append(std::move(accessor), AppendIdPolicy::ThrowOnEmpty);
-                }
-
+                gltfDocument.accessors.AppendRange(m_accessors.Elements(), AppendIdPolicy::ThrowOnEmpty);
                 m_accessors.Clear();
             }
 
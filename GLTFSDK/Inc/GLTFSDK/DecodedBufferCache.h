@@ -0,0 +1,88 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/GLTF.h>
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // Holds the decoded bytes of data URI buffers so that each is decoded only once, keyed by Buffer id. Entries
+        // record a fingerprint of the uri they were decoded from, its length and a hash of all of its characters, and
+        // are only returned for a Buffer with a matching fingerprint, so a Buffer with the same id but a different uri
+        // (e.g. from another document) is treated as a miss without keeping a copy of every uri. Entries are evicted in
+        // 'Least Recently Used' (LRU) order once the decoded data would exceed the byte budget, entries larger than the
+        // whole budget are never cached.
+        class DecodedBufferCache
+        {
+        public:
+            typedef std::shared_ptr<const std::vector<uint8_t>> Data;
+
+            static constexpr size_t DefaultByteBudget = 128U * 1024U * 1024U;
+
+            explicit DecodedBufferCache(size_t byteBudget = DefaultByteBudget);
+
+            DecodedBufferCache(const DecodedBufferCache&) = delete;
+            DecodedBufferCache& operator=(const DecodedBufferCache&) = delete;
+
+            // Returns the cached data for the buffer, or nullptr if there is none or it was decoded from a different uri
+            Data Get(const Buffer& buffer);
+
+            // Caches the decoded data of the buffer, replacing any existing entry for the same Buffer id. The data
+            // is returned whether or not it fits in the byte budget.
+            Data Set(const Buffer& buffer, std::vector<uint8_t> data);
+
+            void Clear();
+
+            // Changing the budget evicts entries as necessary to fit within the new one, zero disables caching
+            void SetByteBudget(size_t byteBudget);
+
+            size_t GetByteBudget() const;
+            size_t GetByteCount() const;
+            size_t Size() const;
+
+        private:
+            struct UriFingerprint
+            {
+                size_t length;
+                size_t hash;
+
+                bool operator==(const UriFingerprint& other) const { return length == other.length && hash == other.hash; }
+            };
+
+            struct Entry
+            {
+                std::string    bufferId;
+                UriFingerprint fingerprint;
+                Data           data;
+
+                size_t GetByteCount() const { return data->size(); }
+            };
+
+            static UriFingerprint GetFingerprint(std::string_view uri);
+
+            typedef std::list<Entry> EntryList;
+
+            void Evict(size_t byteBudget);
+
+            mutable std::mutex m_mutex;
+
+            size_t m_byteBudget;
+            size_t m_byteCount;
+
+            EntryList m_entries;
+            std::unordered_map<std::string, EntryList::iterator> m_entryMap;
+        };
+    }
+}
@@ -3,27 +3,137 @@
 
 #pragma once
 
+#include <cstdint>
 #include <iostream>
+#include <memory_resource>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
 #include <GLTFSDK/Document.h>
+#include <GLTFSDK/Executor.h>
 #include <GLTFSDK/Schema.h>
+#include <GLTFSDK/SchemaValidation.h>
 
 namespace Microsoft::glTF {
 class ExtensionDeserializer;
+
+struct DeserializeOptions {
+    SchemaFlags schemaFlags = SchemaFlags::None;
+    SchemaValidationEngine schemaEngine = SchemaValidationEngine::Valijson;
+
+    // Collections that are left empty, their JSON is skipped over without being parsed or validated. The default
+    // scene is dropped along with the scenes.
+    DocumentCollections skipCollections = DocumentCollections::None;
+
+    // Collections whose JSON is kept unparsed and only parsed, validated against the schema and converted when the
+    // IndexedContainer is first accessed. Any error in a collection's JSON is thrown by that first access, including
+    // const access, rather than by Deserialize.
+    DocumentCollections lazyCollections = DocumentCollections::None;
+
+    // If set, the elements of the top-level arrays are validated concurrently on the executor, see
+    // ValidateDocumentAgainstSchema
+    const IExecutor* executor = nullptr;
+    size_t validationChunkSize = DefaultValidationChunkSize;
+
+    // If set, the indices of the ids in the document's top-level arrays are allocated from it, see Document::create.
+    // The elements themselves still use the global heap.
+    std::pmr::memory_resource* memoryResource = nullptr;
+};
+
+// The metadata read by Deserializer::Peek
+struct DocumentSummary {
+    bool isGLB = false;
+
+    // The properties of the asset
+    std::string version;
+    std::string minVersion;
+    std::string generator;
+    std::string copyright;
+
+    std::vector<std::string> extensionsUsed;
+    std::vector<std::string> extensionsRequired;
+
+    // The number of elements in each of the top-level arrays
+    size_t accessorCount = 0U;
+    size_t animationCount = 0U;
+    size_t bufferCount = 0U;
+    size_t bufferViewCount = 0U;
+    size_t cameraCount = 0U;
+    size_t imageCount = 0U;
+    size_t materialCount = 0U;
+    size_t meshCount = 0U;
+    size_t nodeCount = 0U;
+    size_t samplerCount = 0U;
+    size_t sceneCount = 0U;
+    size_t skinCount = 0U;
+    size_t textureCount = 0U;
+
+    uint64_t bufferByteLength = 0U;      // The sum of every buffer's byteLength
+    uint64_t binaryChunkByteLength = 0U; // The length of a GLB's binary chunk, zero if it has none
+};
+
 class Deserializer {
 public:
-    static std::shared_ptr<Document> Deserialize(const std::string& json, const std::shared_ptr<ExtensionDeserializer>& extensionDeserializer, SchemaFlags schemaFlags = SchemaFlags::None);
-    static std::shared_ptr<Document> Deserialize(const std::string& json, SchemaFlags schemaFlags = SchemaFlags::None) {
+    // Reads a summary of the manifest without deserializing it. The JSON is scanned without being parsed into a DOM
+    // and only the handful of values in the summary are read, everything else is skipped over. Neither the JSON's
+    // syntax, beyond its brackets and strings, nor the schema is validated. The stream may hold either a glTF manifest
+    // or a GLB, in which case only the GLB's header and JSON chunk are read.
+    static DocumentSummary Peek(std::istream& stream);
+    static DocumentSummary Peek(std::string_view json);
+
+    // The manifest is parsed in place, without copying it, so a std::string, a JSON chunk returned by
+    // GLBResourceReader::GetJsonChunk or the contents of a MemoryMappedFile can be passed directly
+    static std::shared_ptr<Document> Deserialize(std::string_view json, const std::shared_ptr<ExtensionDeserializer>& extensionDeserializer, SchemaFlags schemaFlags = SchemaFlags::None, SchemaValidationEngine schemaEngine = SchemaValidationEngine::Valijson);
+    static std::shared_ptr<Document> Deserialize(std::string_view json, SchemaFlags schemaFlags = SchemaFlags::None) {
         return Deserialize(json, nullptr, schemaFlags);
     }
 
-    static std::shared_ptr<Document> Deserialize(std::istream& jsonStream, const std::shared_ptr<ExtensionDeserializer>& extensionDeserializer, SchemaFlags schemaFlags = SchemaFlags::None);
+    static std::shared_ptr<Document> Deserialize(std::span<const uint8_t> json, const std::shared_ptr<ExtensionDeserializer>& extensionDeserializer, SchemaFlags schemaFlags = SchemaFlags::None, SchemaValidationEngine schemaEngine = SchemaValidationEngine::Valijson) {
+        return Deserialize(ToStringView(json), extensionDeserializer, schemaFlags, schemaEngine);
+    }
+    static std::shared_ptr<Document> Deserialize(std::span<const uint8_t> json, SchemaFlags schemaFlags = SchemaFlags::None) {
+        return Deserialize(ToStringView(json), nullptr, schemaFlags);
+    }
+
+    static std::shared_ptr<Document> Deserialize(std::istream& jsonStream, const std::shared_ptr<ExtensionDeserializer>& extensionDeserializer, SchemaFlags schemaFlags = SchemaFlags::None, SchemaValidationEngine schemaEngine = SchemaValidationEngine::Valijson);
     static std::shared_ptr<Document> Deserialize(std::istream& jsonStream, SchemaFlags schemaFlags = SchemaFlags::None) {
         return Deserialize(jsonStream, nullptr, schemaFlags);
     }
 
+    // Deserialize with only some of the collections converted up front, or with validation on an executor
+    static std::shared_ptr<Document> Deserialize(std::string_view json, const DeserializeOptions& options, const std::shared_ptr<ExtensionDeserializer>& extensionDeserializer = nullptr);
+    static std::shared_ptr<Document> Deserialize(std::istream& jsonStream, const DeserializeOptions& options, const std::shared_ptr<ExtensionDeserializer>& extensionDeserializer = nullptr);
+
+    // Parse the manifest with a SAX handler that appends each element of the top-level arrays to the document as soon
+    // as it has been read, rather than building a DOM of the whole manifest. With DisableSchemaRoot, accessors, meshes
+    // and nodes are read straight from the parser's events without any DOM. Other elements, and every element when
+    // the schema is validated, go through a DOM of their own that is discarded once converted, so only one element's
+    // DOM is held at a time. Schema validation is applied per element and reports the same locations as Deserialize,
+    // which remains the reference implementation.
+    static std::shared_ptr<Document> DeserializeStreaming(std::string_view json, const std::shared_ptr<ExtensionDeserializer>& extensionDeserializer, SchemaFlags schemaFlags = SchemaFlags::None, SchemaValidationEngine schemaEngine = SchemaValidationEngine::Valijson);
+    static std::shared_ptr<Document> DeserializeStreaming(std::string_view json, SchemaFlags schemaFlags = SchemaFlags::None) {
+        return DeserializeStreaming(json, nullptr, schemaFlags);
+    }
+
+    static std::shared_ptr<Document> DeserializeStreaming(std::span<const uint8_t> json, const std::shared_ptr<ExtensionDeserializer>& extensionDeserializer, SchemaFlags schemaFlags = SchemaFlags::None, SchemaValidationEngine schemaEngine = SchemaValidationEngine::Valijson) {
+        return DeserializeStreaming(ToStringView(json), extensionDeserializer, schemaFlags, schemaEngine);
+    }
+    static std::shared_ptr<Document> DeserializeStreaming(std::span<const uint8_t> json, SchemaFlags schemaFlags = SchemaFlags::None) {
+        return DeserializeStreaming(ToStringView(json), nullptr, schemaFlags);
+    }
+
+    static std::shared_ptr<Document> DeserializeStreaming(std::istream& jsonStream, const std::shared_ptr<ExtensionDeserializer>& extensionDeserializer, SchemaFlags schemaFlags = SchemaFlags::None, SchemaValidationEngine schemaEngine = SchemaValidationEngine::Valijson);
+    static std::shared_ptr<Document> DeserializeStreaming(std::istream& jsonStream, SchemaFlags schemaFlags = SchemaFlags::None) {
+        return DeserializeStreaming(jsonStream, nullptr, schemaFlags);
+    }
 
 private:
-    static std::shared_ptr<Document> DeserializeInternal(const nlohmann::json& document, const std::shared_ptr<ExtensionDeserializer>& extensionDeserializer, SchemaFlags schemaFlags);
+    static std::string_view ToStringView(std::span<const uint8_t> json) {
+        return { reinterpret_cast<const char*>(json.data()), json.size() };
+    }
+
+    static std::shared_ptr<Document> DeserializeInternal(const nlohmann::json& document, const std::shared_ptr<ExtensionDeserializer>& extensionDeserializer, const DeserializeOptions& options);
 
 };
 }
@@ -6,12 +6,39 @@
 #include <GLTFSDK/GLTF.h>
 #include <GLTFSDK/IndexedContainer.h>
 
+#include <functional>
+#include <memory_resource>
 #include <unordered_set>
 
 namespace Microsoft
 {
     namespace glTF
     {
+        // The top-level arrays of a glTF manifest, combined as flags e.g. to select which of them are deserialized
+        enum class DocumentCollections : uint32_t
+        {
+            None = 0x0,
+            Accessors = 0x1,
+            Animations = 0x2,
+            Buffers = 0x4,
+            BufferViews = 0x8,
+            Cameras = 0x10,
+            Images = 0x20,
+            Materials = 0x40,
+            Meshes = 0x80,
+            Nodes = 0x100,
+            Samplers = 0x200,
+            Scenes = 0x400,
+            Skins = 0x800,
+            Textures = 0x1000,
+            All = 0x1FFF
+        };
+
+        DocumentCollections  operator| (DocumentCollections lhs,  DocumentCollections rhs);
+        DocumentCollections& operator|=(DocumentCollections& lhs, DocumentCollections rhs);
+        DocumentCollections  operator& (DocumentCollections lhs,  DocumentCollections rhs);
+        DocumentCollections& operator&=(DocumentCollections& lhs, DocumentCollections rhs);
+
         class Document : public glTFProperty
         {
         public:
@@ -40,11 +67,16 @@ namespace Microsoft
         protected:
             Document();
             Document(Asset&& asset);
+            explicit Document(std::pmr::memory_resource* resource);
         public:
 
-            static std::shared_ptr<Document> create() {
+            // The indices of the top-level arrays' ids are allocated from resource, e.g. a
+            // std::pmr::monotonic_buffer_resource, which must outlive the document. A null resource is the default one.
+            // The element vectors and the strings and containers inside each element still use the global heap, see
+            // IndexedContainer.
+            static std::shared_ptr<Document> create(std::pmr::memory_resource* resource = nullptr) {
 
-                auto ptr =  std::shared_ptr<Document>(new Document());
+                auto ptr =  std::shared_ptr<Document>(new Document(resource));
 
                 ptr->asset.setGltfDocument(ptr.get());
                 ptr->accessors.setGltfDocument(ptr.get());
@@ -64,6 +96,8 @@ namespace Microsoft
                 return ptr;
             }
 
+            std::pmr::memory_resource* GetMemoryResource() const { return accessors.GetMemoryResource(); }
+
             bool operator==(const Document& rhs) const;
 
             bool IsExtensionUsed(const std::string& extension) const;
@@ -74,8 +108,30 @@ namespace Microsoft
             const Scene& SetDefaultScene(Scene&& scene, AppendIdPolicy policy = AppendIdPolicy::ThrowOnEmpty);
 
 
+            // Brings the document up to date after elements were removed from one of its top-level arrays with
+            // RemoveIf or RemoveMany, given the remap they returned. The remaining elements whose id was their old
+            // index, e.g. those of a deserialized document, are renamed to their new index and every reference to
+            // them is rewritten, including those of the KHR_draco_mesh_compression and
+            // KHR_materials_pbrSpecularGlossiness extensions. References to removed elements are cleared, or erased
+            // from lists such as node children. Throws a GLTFException, without renaming any element, if collection
+            // isn't a single array, remap doesn't match it or the new ids would clash with ids that aren't indices.
+            void RemapReferences(DocumentCollections collection, const IndexRemap& remap);
+
+            // The number of elements of a single top-level array, throws a GLTFException if collection isn't one
+            size_t GetElementCount(DocumentCollections collection) const;
+
+            // Calls fn with the array and the index of every element that the element at index of collection refers
+            // to, once per reference, including the references of the KHR_draco_mesh_compression and
+            // KHR_materials_pbrSpecularGlossiness extensions. Throws a GLTFException if a reference isn't in the array
+            // it refers to.
+            void ForEachReference(DocumentCollections collection, size_t index, const std::function<void(DocumentCollections, size_t)>& fn) const;
+
             void serialize(nlohmann::json& json) const;
 
+            // Serializes everything but the top-level arrays (accessors, nodes, etc.), which Serializer::Serialize
+            // writes to a stream one element at a time
+            void serializeProperties(nlohmann::json& json) const;
+
             void deserialize(const nlohmann::json& json);
 
             friend void to_json(nlohmann::json& json, const std::shared_ptr<Document>& type) {
@@ -86,33 +142,7 @@ namespace Microsoft
             friend void from_json(const nlohmann::json& json, std::shared_ptr<Document>& pType) {
 
                 pType = create();
-                nlohmann::from_json(json, static_cast<glTFProperty&>(*pType));
-                if (auto iter = json.find("asset"); iter != json.end()) {
-                    iter.value().get_to(pType->asset);
-                }
-                if (auto iter = json.find("accessors"); iter != json.end()) iter.value().get_to(pType->accessors);
-                if (auto iter = json.find("animations"); iter != json.end()) iter.value().get_to(pType->animations);
-                if (auto iter = json.find("buffers"); iter != json.end()) iter.value().get_to(pType->buffers);
-                if (auto iter = json.find("bufferViews"); iter != json.end()) iter.value().get_to(pType->bufferViews);
-                if (auto iter = json.find("cameras"); iter != json.end()) iter.value().get_to(pType->cameras);
-                if (auto iter = json.find("images"); iter != json.end()) iter.value().get_to(pType->images);
-                if (auto iter = json.find("materials"); iter != json.end()) iter.value().get_to(pType->materials);
-                if (auto iter = json.find("meshes"); iter != json.end()) iter.value().get_to(pType->meshes);
-                if (auto iter = json.find("nodes"); iter != json.end()) iter.value().get_to(pType->nodes);
-                if (auto iter = json.find("samplers"); iter != json.end()) iter.value().get_to(pType->samplers);
-                if (auto iter = json.find("scenes"); iter != json.end()) iter.value().get_to(pType->scenes);
-                if (auto iter = json.find("skins"); iter != json.end()) iter.value().get_to(pType->skins);
-                if (auto iter = json.find("textures"); iter != json.end()) iter.value().get_to(pType->textures);
-
-                if (auto iter = json.find("scene"); iter != json.end()) {
-                    pType->defaultSceneId = std::to_string(iter.value().get<unsigned int>());
-                }
-
-                if (auto iter = json.find("extensionsUsed"); iter != json.end())
-                    iter.value().get_to(pType->extensionsUsed);
-
-                if (auto iter = json.find("extensionsRequired"); iter != json.end())
-                    iter.value().get_to(pType->extensionsRequired);
+                pType->deserialize(json);
             }
 
             void deserializeExtensions(const std::shared_ptr<ExtensionDeserializer> &pDeserializer) override {
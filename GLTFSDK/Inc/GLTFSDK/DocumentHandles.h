@@ -0,0 +1,159 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/Document.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        using AccessorHandle = Handle<Accessor>;
+        using AnimationHandle = Handle<Animation>;
+        using AnimationSamplerHandle = Handle<AnimationSampler>;
+        using BufferHandle = Handle<Buffer>;
+        using BufferViewHandle = Handle<BufferView>;
+        using CameraHandle = Handle<Camera>;
+        using ImageHandle = Handle<Image>;
+        using MaterialHandle = Handle<Material>;
+        using MeshHandle = Handle<Mesh>;
+        using NodeHandle = Handle<Node>;
+        using SamplerHandle = Handle<Sampler>;
+        using SceneHandle = Handle<Scene>;
+        using SkinHandle = Handle<Skin>;
+        using TextureHandle = Handle<Texture>;
+
+        // Every cross-reference of a Document as a Handle rather than a string id. The tables are indexed by the
+        // position of the referencing element in its container, e.g. nodes[i].children holds the children of
+        // document.nodes[i], so traversals index vectors directly instead of hashing ids. Resolve builds the tables
+        // from a document's string ids in a single pass and Apply writes them back, so the two representations
+        // round-trip losslessly. The tables are a snapshot: they aren't updated when the document is modified.
+        struct DocumentHandles
+        {
+            struct AccessorReferences
+            {
+                BufferViewHandle bufferView;
+                BufferViewHandle sparseIndicesBufferView;
+                BufferViewHandle sparseValuesBufferView;
+            };
+
+            struct AnimationReferences
+            {
+                struct Channel
+                {
+                    AnimationSamplerHandle sampler; // Indexes the samplers of the same animation
+                    NodeHandle targetNode;
+                };
+
+                struct Sampler
+                {
+                    AccessorHandle input;
+                    AccessorHandle output;
+                };
+
+                std::vector<Channel> channels;
+                std::vector<Sampler> samplers;
+            };
+
+            struct BufferViewReferences
+            {
+                BufferHandle buffer;
+            };
+
+            struct ImageReferences
+            {
+                BufferViewHandle bufferView;
+            };
+
+            struct MaterialReferences
+            {
+                TextureHandle baseColorTexture;
+                TextureHandle metallicRoughnessTexture;
+                TextureHandle normalTexture;
+                TextureHandle occlusionTexture;
+                TextureHandle emissiveTexture;
+
+                // KHR_materials_pbrSpecularGlossiness, invalid if the material doesn't have the extension
+                TextureHandle specularGlossinessDiffuseTexture;
+                TextureHandle specularGlossinessTexture;
+            };
+
+            struct MeshReferences
+            {
+                struct MorphTarget
+                {
+                    AccessorHandle positions;
+                    AccessorHandle normals;
+                    AccessorHandle tangents;
+                };
+
+                struct Primitive
+                {
+                    std::vector<std::pair<std::string, AccessorHandle>> attributes; // Sorted by attribute name
+                    AccessorHandle indices;
+                    MaterialHandle material;
+                    std::vector<MorphTarget> targets;
+
+                    // KHR_draco_mesh_compression, invalid if the primitive doesn't have the extension
+                    BufferViewHandle dracoBufferView;
+                };
+
+                std::vector<Primitive> primitives;
+            };
+
+            struct NodeReferences
+            {
+                CameraHandle camera;
+                std::vector<NodeHandle> children;
+                MeshHandle mesh;
+                SkinHandle skin;
+            };
+
+            struct SceneReferences
+            {
+                std::vector<NodeHandle> nodes;
+            };
+
+            struct SkinReferences
+            {
+                AccessorHandle inverseBindMatrices;
+                NodeHandle skeleton;
+                std::vector<NodeHandle> joints;
+            };
+
+            struct TextureReferences
+            {
+                SamplerHandle sampler;
+                ImageHandle image;
+            };
+
+            // Throws a GLTFException if any non-empty id isn't in the container it refers to
+            static DocumentHandles Resolve(const Document& document);
+
+            // Replaces the string ids of the document's elements with the ids of the elements the handles refer to.
+            // Each element is compared with its handles first, so only the elements whose references changed are
+            // copied and replaced. The extension handles are only applied to elements that have the extension. Throws
+            // a DocumentException if the tables don't match the document's containers and a GLTFException if a handle
+            // is out of range.
+            void Apply(Document& document) const;
+
+            std::vector<AccessorReferences> accessors;
+            std::vector<AnimationReferences> animations;
+            std::vector<BufferViewReferences> bufferViews;
+            std::vector<ImageReferences> images;
+            std::vector<MaterialReferences> materials;
+            std::vector<MeshReferences> meshes;
+            std::vector<NodeReferences> nodes;
+            std::vector<SceneReferences> scenes;
+            std::vector<SkinReferences> skins;
+            std::vector<TextureReferences> textures;
+
+            SceneHandle defaultScene;
+        };
+    }
+}
@@ -0,0 +1,91 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/Document.h>
+
+#include <array>
+#include <bit>
+#include <type_traits>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // An element of one of a Document's top-level arrays, e.g. { DocumentCollections::Meshes, 7 } for the 8th mesh
+        struct DocumentElement
+        {
+            DocumentCollections collection = DocumentCollections::None;
+            size_t index = 0U;
+
+            bool operator==(const DocumentElement& rhs) const { return collection == rhs.collection && index == rhs.index; }
+            bool operator!=(const DocumentElement& rhs) const { return !(*this == rhs); }
+        };
+
+        // Forward and reverse tables of every reference between the elements of a Document's top-level arrays, so
+        // that questions like "which nodes use mesh 7?" are answered by a lookup rather than by scanning the document.
+        // The references are those of Document::ForEachReference, which include the KHR_draco_mesh_compression and
+        // KHR_materials_pbrSpecularGlossiness extensions. Both tables are built in a single pass over the document. An
+        // element is listed once per reference, e.g. a skin whose skeleton is also one of its joints is listed twice by
+        // that node.
+        //
+        // The index is a snapshot of the document and isn't notified when the document changes. After each edit the
+        // caller has to update it with OnAppend, OnReplace or OnRemove, otherwise lookups describe the document as it
+        // was. IndexedContainer::Remove has no counterpart as it doesn't return a remap, elements removed with it
+        // require the index to be rebuilt.
+        class DocumentIndex
+        {
+        public:
+            DocumentIndex() = default;
+
+            // Throws a GLTFException if a reference isn't in the array it refers to
+            explicit DocumentIndex(const Document& document);
+
+            // The elements that element refers to
+            const std::vector<DocumentElement>& GetReferences(DocumentElement element) const;
+
+            // The elements that refer to element
+            const std::vector<DocumentElement>& GetReferencedBy(DocumentElement element) const;
+
+            bool IsReferenced(DocumentElement element) const { return !GetReferencedBy(element).empty(); }
+
+            // The number of elements of collection the index knows about
+            size_t GetElementCount(DocumentCollections collection) const;
+
+            // Indexes the elements appended to collection since the index was built or last updated
+            void OnAppend(const Document& document, DocumentCollections collection);
+
+            // Indexes the references of an element again after it was replaced
+            void OnReplace(const Document& document, DocumentElement element);
+
+            // Drops the elements removed from collection and renumbers the remaining ones, given the remap returned by
+            // RemoveIf or RemoveMany. References to removed elements are dropped too, as Document::RemapReferences
+            // clears them.
+            void OnRemove(DocumentCollections collection, const IndexRemap& remap);
+
+        private:
+            struct Entry
+            {
+                std::vector<DocumentElement> references;
+                std::vector<DocumentElement> referencedBy;
+            };
+
+            const Entry& GetEntry(DocumentElement element) const;
+            Entry& GetEntry(DocumentElement element);
+
+            std::vector<DocumentElement> ResolveReferences(const Document& document, DocumentElement element) const;
+            void Link(DocumentElement element, std::vector<DocumentElement> references);
+
+            static constexpr auto c_allCollections = static_cast<std::underlying_type_t<DocumentCollections>>(DocumentCollections::All);
+
+            // A table per DocumentCollections flag, each top-level array's table is at the position of its flag
+            static_assert(std::has_single_bit(c_allCollections + 1U), "The DocumentCollections flags must be contiguous");
+            static constexpr size_t CollectionCount = static_cast<size_t>(std::popcount(c_allCollections));
+
+            // The entries of each top-level array, in the order of the DocumentCollections flags
+            std::array<std::vector<Entry>, CollectionCount> m_entries;
+        };
+    }
+}
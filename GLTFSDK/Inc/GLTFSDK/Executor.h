@@ -0,0 +1,47 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // Runs batches of independent tasks, allowing callers to decide how (and whether) work done by the SDK on
+        // their behalf is parallelized, e.g. by forwarding tasks to an application's existing thread pool
+        class IExecutor
+        {
+        public:
+            virtual ~IExecutor() = default;
+
+            // Calls task(i) once for every i in [0, taskCount) and returns once all calls have completed. If any
+            // call throws then one of the exceptions is rethrown once all the calls have completed.
+            virtual void ParallelFor(size_t taskCount, const std::function<void(size_t)>& task) const = 0;
+        };
+
+        // Runs every task in order on the calling thread
+        class SequentialExecutor : public IExecutor
+        {
+        public:
+            void ParallelFor(size_t taskCount, const std::function<void(size_t)>& task) const override;
+        };
+
+        // Runs tasks on up to threadCount threads (including the calling thread) that are started for each call to
+        // ParallelFor. A threadCount of zero uses std::thread::hardware_concurrency.
+        class ThreadExecutor : public IExecutor
+        {
+        public:
+            explicit ThreadExecutor(size_t threadCount = 0U);
+
+            void ParallelFor(size_t taskCount, const std::function<void(size_t)>& task) const override;
+
+            size_t GetThreadCount() const { return m_threadCount; }
+
+        private:
+            size_t m_threadCount;
+        };
+    }
+}
@@ -5,6 +5,10 @@
 
 #include <GLTFSDK/GLTFResourceReader.h>
 
+#include <mutex>
+#include <span>
+#include <string_view>
+
 namespace Microsoft
 {
     namespace glTF
@@ -20,13 +24,49 @@ namespace Microsoft
 
             const std::string& GetJson() const;
 
+            // The GLB JSON chunk, viewed in place rather than copied. Pass it to Deserializer::Deserialize to parse
+            // the manifest without any intermediate copies. The view is valid for as long as the reader is alive.
+            std::string_view GetJsonChunk() const;
+
+        protected:
+            // Used by readers that hold the whole GLB in memory (e.g. a memory mapped file) and also expose it as
+            // glbStream. The JSON chunk is viewed in place within glbData rather than copied, GetJson only copies it
+            // on first use.
+            GLBResourceReader(std::shared_ptr<const IStreamReader> streamReader, std::shared_ptr<std::istream> glbStream, std::span<const uint8_t> glbData);
+            GLBResourceReader(std::unique_ptr<IStreamReaderCache> streamCache, std::shared_ptr<std::istream> glbStream, std::span<const uint8_t> glbData);
+
+            // Location of the GLB binary chunk's data within the GLB stream. The length is zero
+            // when the GLB has no binary chunk.
+            std::streamoff GetBinaryChunkOffset() const { return m_bufferOffset; }
+            size_t         GetBinaryChunkLength() const { return m_bufferLength; }
+
+            // GetBinaryStream only handles the GLB binary chunk itself and leaves other buffers to GLTFResourceReader
+            bool HasDefaultBinaryStreams() const override;
+
+            // The GLB binary chunk is read via the GLB stream, other buffers via GLTFResourceReader
+            std::shared_ptr<const IRandomAccessReader> CreateBinaryReader(const Buffer& buffer) const override;
+
+            // We allow "uri": "data:," to refer to a GLB buffer
+            static bool IsBinaryChunkBuffer(const Buffer& buffer);
+
         private:
             void Init();
 
+            struct JsonCopy
+            {
+                std::once_flag onceFlag;
+                std::string json;
+            };
+
             std::string m_json;
 
+            std::span<const uint8_t>  m_glbData;
+            std::unique_ptr<JsonCopy> m_jsonCopy; // Only used when the GLB is held in memory
+            size_t                    m_jsonLength;
+
             std::shared_ptr<std::istream> m_buffer;
             std::streamoff                m_bufferOffset;
+            size_t                        m_bufferLength;
         };
     }
 }
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <GLTFSDK/Document.h>
 #include <GLTFSDK/GLTF.h>
 #include <GLTFSDK/GLTFResourceWriter.h>
 
@@ -24,10 +25,18 @@ namespace Microsoft
             template <typename T>
             void FlushStream(const std::string& manifest, T* stream);
             void Flush(const std::string& manifest, const std::string& uri);
+
+            // Serializes the document straight into the JSON chunk with Serializer::Serialize rather than writing a
+            // previously serialized manifest. The chunk and GLB lengths are patched once the manifest has been written,
+            // so the stream must support seekp.
+            void FlushStream(const Document& document, std::ostream& stream, bool pPretty = false);
+            void Flush(const Document& document, const std::string& uri, bool pPretty = false);
             std::string GenerateBufferUri(const std::string& bufferId) const override;
             std::ostream* GetBufferStream(const std::string& bufferId) override;
 
         private:
+            void WriteBinaryChunk(std::ostream& stream);
+
             std::shared_ptr<std::iostream> m_stream;
         };
     }
@@ -286,6 +286,19 @@ namespace Microsoft
                 return *this;
             }
 
+            // Moves transfer the extensions rather than cloning them. Like copy assignment, move assignment keeps the
+            // document this property belongs to.
+            glTFProperty(glTFProperty&&) = default;
+
+            glTFProperty& operator=(glTFProperty&& other) noexcept
+            {
+                extensions = std::move(other.extensions);
+                registeredExtensions = std::move(other.registeredExtensions);
+                extras = std::move(other.extras);
+
+                return *this;
+            }
+
             static bool Equals(const glTFProperty& lhs, const glTFProperty& rhs)
             {
                 auto fnRegisteredExtensionsEquals = [](const glTFProperty& lhs, const glTFProperty& rhs)
@@ -1473,6 +1486,9 @@ namespace Microsoft
             {
             }
 
+            Camera(Camera&&) = default;
+            Camera& operator=(Camera&&) = default;
+
             const Perspective& GetPerspective() const
             {
                 if (const auto ret = dynamic_cast<Perspective*>(projection.get()))
@@ -3,35 +3,96 @@
 
 #pragma once
 
+#include <GLTFSDK/AccessorCache.h>
+#include <GLTFSDK/DecodedBufferCache.h>
 #include <GLTFSDK/Document.h>
+#include <GLTFSDK/Executor.h>
 #include <GLTFSDK/IStreamReader.h>
 #include <GLTFSDK/ResourceReaderUtils.h>
+#include <GLTFSDK/SparseAccessorView.h>
 #include <GLTFSDK/StreamCacheLRU.h>
 #include <GLTFSDK/StreamUtils.h>
 #include <GLTFSDK/Validation.h>
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <span>
+#include <typeinfo>
 
 namespace Microsoft
 {
     namespace glTF
     {
+        // An accessor to be read by GLTFResourceReader::ReadAccessors. The accessor's components, of the type that
+        // matches its componentType, are written to output if one is specified and to data otherwise.
+        struct AccessorReadRequest
+        {
+            explicit AccessorReadRequest(const Accessor& accessor) : AccessorReadRequest(accessor, nullptr, 0U)
+            {
+            }
+
+            AccessorReadRequest(const Accessor& accessor, void* output, size_t outputByteLength, size_t outputByteStride = 0U) :
+                accessor(&accessor),
+                output(output),
+                outputByteLength(outputByteLength),
+                outputByteStride(outputByteStride)
+            {
+            }
+
+            template<typename T>
+            AccessorReadRequest(const Accessor& accessor, std::span<T> output, size_t outputByteStride = 0U) :
+                AccessorReadRequest(accessor, output.data(), output.size_bytes(), outputByteStride)
+            {
+            }
+
+            // The accessor's components when no output was specified
+            template<typename T>
+            std::span<const T> GetData() const
+            {
+                if (sizeof(T) != Accessor::GetComponentTypeSize(accessor->componentType))
+                {
+                    throw GLTFException("Template type T does not match the ComponentType of accessor " + accessor->id);
+                }
+
+                return { reinterpret_cast<const T*>(data.data()), data.size() / sizeof(T) };
+            }
+
+            const Accessor* accessor;
+
+            void*  output;
+            size_t outputByteLength;
+            size_t outputByteStride;
+
+            std::vector<uint8_t> data;
+        };
+
         class GLTFResourceReader
         {
         public:
             GLTFResourceReader(std::shared_ptr<const IStreamReader> streamReader)
-                : GLTFResourceReader(MakeStreamReaderCache<StreamReaderCacheLRU>(std::move(streamReader), 16U))
+                : GLTFResourceReader(streamReader, MakeStreamReaderCache<StreamReaderCacheLRU>(streamReader, 16U))
             {
             }
 
             GLTFResourceReader(std::unique_ptr<IStreamReaderCache> streamCache)
-                : m_streamReaderCache(std::move(streamCache))
+                : GLTFResourceReader(nullptr, std::move(streamCache))
             {
             }
 
             GLTFResourceReader(GLTFResourceReader&&) = default;
 
-            virtual ~GLTFResourceReader() = default;
+            virtual ~GLTFResourceReader()
+            {
+                // The entries this reader cached can never be returned once it is destroyed
+                if (m_accessorCache && m_sharedState)
+                {
+                    m_accessorCache->Clear(m_sharedState->accessorCacheReaderId);
+                }
+            }
 
             // TODO: return mimeType of image
             std::vector<uint8_t> ReadBinaryData(const Document& document, const Image& image) const
@@ -54,13 +115,18 @@ namespace Microsoft
                 {
                     data = ReadBinaryDataUri<uint8_t>({ itBegin, itEnd });
                 }
-                else if (auto stream = m_streamReaderCache->Get(image.uri))
-                {
-                    data = StreamUtils::ReadBinaryFull<uint8_t>(*stream);
-                }
                 else
                 {
-                    throw GLTFException("Unable to read image data");
+                    std::lock_guard<std::mutex> lock(m_sharedState->streamReaderCacheMutex);
+
+                    if (auto stream = m_streamReaderCache->Get(image.uri))
+                    {
+                        data = StreamUtils::ReadBinaryFull<uint8_t>(*stream);
+                    }
+                    else
+                    {
+                        throw GLTFException("Unable to read image data");
+                    }
                 }
 
                 return data;
@@ -68,6 +134,170 @@ namespace Microsoft
 
             template<typename T>
             std::vector<T> ReadBinaryData(const Document& gltfDocument, const Accessor& accessor) const
+            {
+                ValidateComponentType<T>(accessor);
+
+                Validation::ValidateAccessor(gltfDocument, accessor);
+
+                if (accessor.sparse.count > 0U)
+                {
+                    return ReadSparseAccessor<T>(gltfDocument, accessor);
+                }
+
+                return ReadAccessor<T>(gltfDocument, accessor);
+            }
+
+            // Decodes an accessor's elements into caller-provided memory rather than a new vector.
+            // Consecutive elements are written outputByteStride bytes apart, zero means tightly packed.
+            template<typename T>
+            void ReadBinaryData(const Document& gltfDocument, const Accessor& accessor, std::span<T> output, size_t outputByteStride = 0U) const
+            {
+                ReadBinaryData<T>(gltfDocument, accessor, output.data(), output.size_bytes(), outputByteStride);
+            }
+
+            template<typename T>
+            void ReadBinaryData(const Document& gltfDocument, const Accessor& accessor, void* output, size_t outputByteLength, size_t outputByteStride = 0U) const
+            {
+                ValidateComponentType<T>(accessor);
+
+                Validation::ValidateAccessor(gltfDocument, accessor);
+
+                const auto elementSize = sizeof(T) * Accessor::GetTypeCount(accessor.type);
+                const auto stride = GetOutputByteStride(accessor, elementSize, outputByteLength, outputByteStride);
+
+                if (accessor.sparse.count > 0U)
+                {
+                    ReadSparseAccessor<T>(gltfDocument, accessor, static_cast<uint8_t*>(output), stride);
+                }
+                else
+                {
+                    ReadAccessor<T>(gltfDocument, accessor, static_cast<uint8_t*>(output), stride);
+                }
+            }
+
+            // Reads only the substituted elements of a sparse accessor, see SparseAccessorView. Unlike ReadBinaryData
+            // no dense array of accessor.count elements is allocated or read.
+            template<typename T>
+            SparseAccessorView<T> ReadSparseAccessorView(const Document& gltfDocument, const Accessor& accessor) const
+            {
+                ValidateComponentType<T>(accessor);
+
+                Validation::ValidateAccessor(gltfDocument, accessor);
+
+                if (accessor.sparse.count == 0U)
+                {
+                    throw GLTFException("Accessor " + accessor.id + " is not sparse");
+                }
+
+                const auto typeCount = Accessor::GetTypeCount(accessor.type);
+                const auto elementSize = sizeof(T) * typeCount;
+
+                const size_t count = accessor.sparse.count;
+
+                const BufferView& valuesBufferView = gltfDocument.bufferViews.Get(accessor.sparse.valuesBufferViewId);
+                const Buffer& valuesBuffer = gltfDocument.buffers.Get(valuesBufferView.bufferId);
+                const size_t valuesOffset = accessor.sparse.valuesByteOffset + valuesBufferView.byteOffset;
+                const size_t valuesStride = valuesBufferView.byteStride ? valuesBufferView.byteStride.Get() : elementSize;
+
+                std::vector<T> values(count * typeCount);
+                ReadBinaryData(valuesBuffer, valuesOffset, count, elementSize, valuesStride, reinterpret_cast<uint8_t*>(values.data()), elementSize);
+
+                return SparseAccessorView<T>(accessor, ReadSparseIndices(gltfDocument, accessor), std::move(values));
+            }
+
+            template<typename T>
+            std::vector<T> ReadBinaryData(const Document& document, const BufferView& bufferView) const
+            {
+                const Buffer& buffer = document.buffers.Get(bufferView.bufferId);
+
+                Validation::ValidateBufferView(bufferView, buffer);
+
+                auto count = bufferView.byteLength / sizeof(T);
+                assert(bufferView.byteLength % sizeof(T) == 0);
+
+                return ReadBinaryData<T>(buffer, bufferView.byteOffset, count);
+            }
+
+            template<typename T>
+            void ReadBinaryData(const Document& document, const BufferView& bufferView, std::span<T> output) const
+            {
+                const Buffer& buffer = document.buffers.Get(bufferView.bufferId);
+
+                Validation::ValidateBufferView(bufferView, buffer);
+
+                if (output.size_bytes() < bufferView.byteLength)
+                {
+                    throw GLTFException("Output buffer is too small for bufferView " + bufferView.id);
+                }
+
+                ReadBinaryData(buffer, bufferView.byteOffset, bufferView.byteLength, 1U, 1U, reinterpret_cast<uint8_t*>(output.data()), 1U);
+            }
+
+            std::vector<float> ReadFloatData(const Document& gltfDocument, const Accessor& accessor) const;
+
+            // Decodes an accessor's elements to floats in caller-provided memory, see ReadBinaryData
+            void ReadFloatData(const Document& gltfDocument, const Accessor& accessor, std::span<float> output, size_t outputByteStride = 0U) const;
+            void ReadFloatData(const Document& gltfDocument, const Accessor& accessor, void* output, size_t outputByteLength, size_t outputByteStride = 0U) const;
+
+            // Reads many accessors at once. The byte ranges of all the accessors are sorted and those that overlap or
+            // lie close together in the same buffer are merged, so that each merged range is read with a single call
+            // to ReadAt. The merged ranges are read, and then the accessors' elements gathered out of them, in
+            // parallel using the executor.
+            void ReadAccessors(const Document& gltfDocument, std::span<AccessorReadRequest> requests) const;
+            void ReadAccessors(const Document& gltfDocument, std::span<AccessorReadRequest> requests, const IExecutor& executor) const;
+
+            // Data URI buffers are decoded in full the first time they are read and the decoded bytes are kept, up to
+            // the cache's byte budget, so that later reads of the same buffer are plain memory copies. The cache must be
+            // cleared if the reader is later used with a different document.
+            DecodedBufferCache& GetDecodedBufferCache() const
+            {
+                return m_sharedState->decodedBufferCache;
+            }
+
+            // An optional cache of decoded accessor data used by ReadCachedBinaryData and ReadCachedFloatData, which
+            // can be shared by several readers. Each reader's entries are kept separate, so readers over different
+            // resources never see each other's data. Without one those functions decode the accessor on every call.
+            void SetAccessorCache(std::shared_ptr<AccessorCache> accessorCache)
+            {
+                if (m_accessorCache)
+                {
+                    m_accessorCache->Clear(m_sharedState->accessorCacheReaderId);
+                }
+
+                m_accessorCache = std::move(accessorCache);
+            }
+
+            const std::shared_ptr<AccessorCache>& GetAccessorCache() const
+            {
+                return m_accessorCache;
+            }
+
+            // Returns an accessor's decoded data from the accessor cache, decoding and caching it on a miss. The data
+            // is immutable and shared with every other caller that reads the same accessor as the same type.
+            template<typename T>
+            std::shared_ptr<const std::vector<T>> ReadCachedBinaryData(const Document& gltfDocument, const Accessor& accessor) const
+            {
+                if (!m_accessorCache)
+                {
+                    return std::make_shared<const std::vector<T>>(ReadBinaryData<T>(gltfDocument, accessor));
+                }
+
+                const auto readerId = m_sharedState->accessorCacheReaderId;
+
+                if (auto data = m_accessorCache->Get<T>(readerId, gltfDocument, accessor))
+                {
+                    return data;
+                }
+
+                return m_accessorCache->Set<T>(readerId, gltfDocument, accessor, ReadBinaryData<T>(gltfDocument, accessor));
+            }
+
+            std::shared_ptr<const std::vector<float>> ReadCachedFloatData(const Document& gltfDocument, const Accessor& accessor) const;
+
+        protected:
+            // Throws if the template type T doesn't match the accessor's ComponentType
+            template<typename T>
+            static void ValidateComponentType(const Accessor& accessor)
             {
                 bool isValid;
 
@@ -99,103 +329,60 @@ namespace Microsoft
                 {
                     throw GLTFException("ReadAccessorData: Template type T does not match accessor ComponentType");
                 }
-
-                Validation::ValidateAccessor(gltfDocument, accessor);
-
-                if (accessor.sparse.count > 0U)
-                {
-                    return ReadSparseAccessor<T>(gltfDocument, accessor);
-                }
-
-                return ReadAccessor<T>(gltfDocument, accessor);
             }
 
             template<typename T>
-            std::vector<T> ReadBinaryData(const Document& document, const BufferView& bufferView) const
+            std::vector<T> ReadAccessor(const Document& gltfDocument, const Accessor& accessor) const
             {
-                const Buffer& buffer = document.buffers.Get(bufferView.bufferId);
-
-                Validation::ValidateBufferView(bufferView, buffer);
-
-                auto count = bufferView.byteLength / sizeof(T);
-                assert(bufferView.byteLength % sizeof(T) == 0);
+                const auto typeCount = Accessor::GetTypeCount(accessor.type);
 
-                return ReadBinaryData<T>(buffer, bufferView.byteOffset, count);
+                std::vector<T> data(accessor.count * typeCount);
+                ReadAccessor<T>(gltfDocument, accessor, reinterpret_cast<uint8_t*>(data.data()), sizeof(T) * typeCount);
+                return data;
             }
 
-            std::vector<float> ReadFloatData(const Document& gltfDocument, const Accessor& accessor) const;
-
-        protected:
             template<typename T>
-            std::vector<T> ReadAccessor(const Document& gltfDocument, const Accessor& accessor) const
+            void ReadAccessor(const Document& gltfDocument, const Accessor& accessor, uint8_t* output, size_t outputByteStride) const
             {
-                const auto typeCount = Accessor::GetTypeCount(accessor.type);
-                const auto elementSize = sizeof(T) * typeCount;
-
-                std::vector<T> data;
+                const auto elementSize = sizeof(T) * Accessor::GetTypeCount(accessor.type);
 
                 const BufferView& bufferView = gltfDocument.bufferViews.Get(accessor.bufferViewId);
                 const Buffer& buffer = gltfDocument.buffers.Get(bufferView.bufferId);
 
                 const size_t offset = accessor.byteOffset + bufferView.byteOffset;
+                const size_t stride = bufferView.byteStride ? bufferView.byteStride.Get() : elementSize;
 
-                if (!bufferView.byteStride || bufferView.byteStride.Get() == elementSize)
-                {
-                    data = ReadBinaryData<T>(buffer, offset, accessor.count * typeCount);
-                }
-                else
-                {
-                    data = ReadBinaryDataInterleaved<T>(buffer, offset, accessor.count, typeCount, bufferView.byteStride.Get());
-                }
-
-                return data;
+                ReadBinaryData(buffer, offset, accessor.count, elementSize, stride, output, outputByteStride);
             }
 
             template<typename T>
             std::vector<T> ReadSparseAccessor(const Document& gltfDocument, const Accessor& accessor) const
             {
                 const auto typeCount = Accessor::GetTypeCount(accessor.type);
-                const auto elementSize = sizeof(T) * typeCount;
 
-                std::vector<T> baseData;
+                std::vector<T> data(accessor.count * typeCount);
+                ReadSparseAccessor<T>(gltfDocument, accessor, reinterpret_cast<uint8_t*>(data.data()), sizeof(T) * typeCount);
+                return data;
+            }
+
+            template<typename T>
+            void ReadSparseAccessor(const Document& gltfDocument, const Accessor& accessor, uint8_t* output, size_t outputByteStride) const
+            {
+                const auto elementSize = sizeof(T) * Accessor::GetTypeCount(accessor.type);
 
                 if (accessor.bufferViewId.empty())
                 {
-                    baseData.resize(typeCount * accessor.count, T());
-                }
-                else
-                {
-                    const BufferView& bufferView = gltfDocument.bufferViews.Get(accessor.bufferViewId);
-                    const Buffer& buffer = gltfDocument.buffers.Get(bufferView.bufferId);
-
-                    const size_t offset = accessor.byteOffset + bufferView.byteOffset;
-
-                    if (!bufferView.byteStride || bufferView.byteStride.Get() == elementSize)
-                    {
-                        baseData = ReadBinaryData<T>(buffer, offset, accessor.count * typeCount);
-                    }
-                    else
+                    for (size_t i = 0U; i < accessor.count; ++i)
                     {
-                        baseData = ReadBinaryDataInterleaved<T>(buffer, offset, accessor.count, typeCount, bufferView.byteStride.Get());
+                        std::memset(output + i * outputByteStride, 0, elementSize);
                     }
                 }
-
-                switch (accessor.sparse.indicesComponentType)
+                else
                 {
-                case COMPONENT_UNSIGNED_BYTE:
-                    ReadSparseBinaryData<T, uint8_t>(gltfDocument, baseData, accessor);
-                    break;
-                case COMPONENT_UNSIGNED_SHORT:
-                    ReadSparseBinaryData<T, uint16_t>(gltfDocument, baseData, accessor);
-                    break;
-                case COMPONENT_UNSIGNED_INT:
-                    ReadSparseBinaryData<T, uint32_t>(gltfDocument, baseData, accessor);
-                    break;
-                default:
-                    throw GLTFException("Unsupported sparse indices ComponentType");
+                    ReadAccessor<T>(gltfDocument, accessor, output, outputByteStride);
                 }
 
-                return baseData;
+                ReadSparseBinaryData<T>(gltfDocument, output, outputByteStride, accessor);
             }
 
             virtual std::shared_ptr<std::istream> GetBinaryStream(const Buffer& buffer) const
@@ -205,6 +392,8 @@ namespace Microsoft
                     throw GLTFException("Buffer.uri was not specified.");
                 }
 
+                std::lock_guard<std::mutex> lock(m_sharedState->streamReaderCacheMutex);
+
                 return m_streamReaderCache->Get(buffer.uri);
             }
 
@@ -213,7 +402,76 @@ namespace Microsoft
                 return {};
             }
 
+            // Returns the reader that all of a buffer's (non data URI) data is read through, creating it via
+            // CreateBinaryReader the first time the buffer is read. Readers are shared by every thread using this
+            // GLTFResourceReader instance. Like the stream cache, at most 16 readers are kept open and the least
+            // recently used one is released first.
+            std::shared_ptr<const IRandomAccessReader> GetBinaryReader(const Buffer& buffer) const
+            {
+                std::lock_guard<std::mutex> lock(m_sharedState->binaryReadersMutex);
+
+                auto& binaryReaders = m_sharedState->binaryReaders;
+
+                auto it = std::find_if(binaryReaders.begin(), binaryReaders.end(), [&buffer](const auto& entry)
+                {
+                    return entry.first == buffer.uri;
+                });
+
+                if (it != binaryReaders.end())
+                {
+                    // Ensure the returned reader is now the 'most recently used'
+                    binaryReaders.splice(binaryReaders.begin(), binaryReaders, it);
+                    return it->second;
+                }
+
+                auto binaryReader = CreateBinaryReader(buffer);
+
+                if (binaryReaders.size() == BinaryReaderCacheSize)
+                {
+                    binaryReaders.pop_back();
+                }
+
+                binaryReaders.emplace_front(buffer.uri, binaryReader);
+
+                return binaryReader;
+            }
+
+            // Whether buffers may be read positionally via IStreamReader::GetRandomAccessReader instead of through
+            // GetBinaryStream and GetBinaryStreamPos. Only true for the classes that define those two functions, so a
+            // subclass that overrides them is still read from the streams they return. Subclasses that don't redirect
+            // the streams can override this to return true.
+            virtual bool HasDefaultBinaryStreams() const
+            {
+                return typeid(*this) == typeid(GLTFResourceReader);
+            }
+
+            // Buffers are read positionally via the IStreamReader if one was supplied and the binary streams aren't
+            // redirected, otherwise the stream returned by GetBinaryStream is adapted
+            virtual std::shared_ptr<const IRandomAccessReader> CreateBinaryReader(const Buffer& buffer) const
+            {
+                if (m_streamReader && HasDefaultBinaryStreams())
+                {
+                    if (buffer.uri.empty())
+                    {
+                        throw GLTFException("Buffer.uri was not specified.");
+                    }
+
+                    return m_streamReader->GetRandomAccessReader(buffer.uri);
+                }
+
+                return std::make_shared<StreamRandomAccessReader>(GetBinaryStream(buffer), GetBinaryStreamPos(buffer));
+            }
+
         private:
+            static constexpr size_t BinaryReaderCacheSize = 16U;
+
+            GLTFResourceReader(std::shared_ptr<const IStreamReader> streamReader, std::unique_ptr<IStreamReaderCache> streamCache)
+                : m_streamReader(std::move(streamReader)),
+                m_streamReaderCache(std::move(streamCache)),
+                m_sharedState(std::make_unique<SharedState>())
+            {
+            }
+
             void ReadBinaryDataUri(Base64StringView encodedData, Base64BufferView decodedData, const std::streamoff* offsetOverride = nullptr) const
             {
                 // The number of unwanted extra bytes that must be decoded for the specified byte offset
@@ -284,42 +542,56 @@ namespace Microsoft
                 return decodedData;
             }
 
-            template<typename T>
-            std::vector<T> ReadBinaryData(const Buffer& buffer, std::streamoff offset, size_t componentCount) const
+            // Returns the whole decoded buffer, decoding and caching it on first use, or nullptr if it is too large to be
+            // cached in which case only the requested range should be decoded
+            DecodedBufferCache::Data GetDecodedBufferData(const Buffer& buffer, Base64StringView encodedData) const
             {
-                std::vector<T> data;
-
-                std::string::const_iterator itBegin;
-                std::string::const_iterator itEnd;
+                auto& decodedBufferCache = m_sharedState->decodedBufferCache;
 
-                if (IsUriBase64(buffer.uri, itBegin, itEnd))
+                if (auto decodedData = decodedBufferCache.Get(buffer))
                 {
-                    data = ReadBinaryDataUri<T>({ itBegin, itEnd }, &offset, &componentCount);
+                    return decodedData;
                 }
-                else
+
+                if (encodedData.GetByteCount() > decodedBufferCache.GetByteBudget())
                 {
-                    data.resize(componentCount);
+                    return nullptr;
+                }
 
-                    auto bufferStream = GetBinaryStream(buffer);
-                    auto bufferStreamPos = GetBinaryStreamPos(buffer);
+                return decodedBufferCache.Set(buffer, Base64Decode(encodedData));
+            }
 
-                    bufferStream->seekg(bufferStreamPos);
-                    bufferStream->seekg(offset, std::ios_base::cur);
+            // Returns the byte distance between consecutive output elements, throws if the output can't hold them all
+            static size_t GetOutputByteStride(const Accessor& accessor, size_t elementSize, size_t outputByteLength, size_t outputByteStride)
+            {
+                if (outputByteStride == 0U)
+                {
+                    outputByteStride = elementSize;
+                }
+                else if (outputByteStride < elementSize)
+                {
+                    throw GLTFException("Output stride is smaller than the element size of accessor " + accessor.id);
+                }
 
-                    StreamUtils::ReadBinary(*bufferStream, reinterpret_cast<char*>(data.data()), componentCount * sizeof(T));
+                // Only the last element needs elementSize bytes, the others need the full outputByteStride
+                if (accessor.count > 0U && (outputByteLength < elementSize || (accessor.count - 1U) > (outputByteLength - elementSize) / outputByteStride))
+                {
+                    throw GLTFException("Output buffer is too small for accessor " + accessor.id);
                 }
 
-                return data;
+                return outputByteStride;
             }
 
+            // Converts an accessor's components of type T to floats as the raw components are read, see ReadFloatData
             template<typename T>
-            std::vector<T> ReadBinaryDataInterleaved(const Buffer& buffer, std::streamoff offset, size_t elementCount, uint8_t typeCount, size_t stride) const
-            {
-                const size_t elementSize = sizeof(T) * typeCount;
-                const size_t componentCount = elementCount * typeCount;
+            void ReadFloatComponents(const Document& gltfDocument, const Accessor& accessor, uint8_t* output, size_t outputByteLength, size_t outputByteStride) const;
 
-                std::vector<T> data(componentCount);
+            typedef std::function<void(std::streamoff offset, uint8_t* block, size_t blockLength)> ReadBlockFn;
 
+            // Returns the whole decoded buffer if it is a data URI held in the decoded buffer cache. Otherwise nullptr is
+            // returned and readBlock is set to a function that reads any byte range of the buffer.
+            DecodedBufferCache::Data GetBufferSource(const Buffer& buffer, ReadBlockFn& readBlock) const
+            {
                 std::string::const_iterator itBegin;
                 std::string::const_iterator itEnd;
 
@@ -327,81 +599,213 @@ namespace Microsoft
                 {
                     Base64StringView encodedData(itBegin, itEnd);
 
-                    for (size_t componentsRead = 0U; componentsRead < componentCount; componentsRead += typeCount, offset += stride)
+                    if (auto decodedData = GetDecodedBufferData(buffer, encodedData))
                     {
-                        ReadBinaryDataUri(encodedData, Base64BufferView(data.data() + componentsRead, elementSize), &offset);
+                        return decodedData;
                     }
+
+                    readBlock = [this, encodedData](std::streamoff blockOffset, uint8_t* block, size_t blockLength)
+                    {
+                        ReadBinaryDataUri(encodedData, Base64BufferView(block, blockLength), &blockOffset);
+                    };
                 }
                 else
                 {
-                    auto bufferStream = GetBinaryStream(buffer);
-                    auto bufferStreamPos = GetBinaryStreamPos(buffer) + offset;
-
-                    for (size_t componentsRead = 0U; componentsRead < componentCount; componentsRead += typeCount)
+                    readBlock = [binaryReader = GetBinaryReader(buffer)](std::streamoff blockOffset, uint8_t* block, size_t blockLength)
                     {
-                        bufferStream->seekg(bufferStreamPos);
-                        bufferStreamPos += stride;
+                        if (blockOffset < 0)
+                        {
+                            throw GLTFException("Negative offsets are not supported");
+                        }
 
-                        StreamUtils::ReadBinary(*bufferStream, reinterpret_cast<char*>(data.data() + componentsRead), elementSize);
-                    }
+                        binaryReader->ReadAt(static_cast<uint64_t>(blockOffset), { block, blockLength });
+                    };
                 }
 
-                return data;
+                return nullptr;
             }
 
-            template<typename T, typename I>
-            void ReadSparseBinaryData(const Document& gltfDocument, std::vector<T>& baseData, const Accessor& accessor) const
+            // Returns a pointer to the first of the elements in a decoded data URI buffer, throws if any of them lie outside it
+            static const uint8_t* GetDecodedElements(const Buffer& buffer, const std::vector<uint8_t>& decodedData, std::streamoff offset, size_t elementCount, size_t elementSize, size_t stride)
             {
-                const auto typeCount = Accessor::GetTypeCount(accessor.type);
-                const auto elementSize = sizeof(T) * typeCount;
+                if (offset < 0)
+                {
+                    throw GLTFException("Negative offsets are not supported");
+                }
 
-                const size_t count = accessor.sparse.count;
+                const size_t byteOffset = static_cast<size_t>(offset);
 
-                const BufferView& indicesBufferView = gltfDocument.bufferViews.Get(accessor.sparse.indicesBufferViewId);
-                const Buffer& indicesBuffer = gltfDocument.buffers.Get(indicesBufferView.bufferId);
-                const size_t indicesOffset = accessor.sparse.indicesByteOffset + indicesBufferView.byteOffset;
+                if (byteOffset > decodedData.size() || (elementCount > 0U && (elementSize > decodedData.size() - byteOffset || (elementCount - 1U) > (decodedData.size() - byteOffset - elementSize) / std::max<size_t>(1U, stride))))
+                {
+                    throw GLTFException("Buffer " + buffer.id + " data is outside the range of the decoded data URI");
+                }
 
-                const BufferView& valuesBufferView = gltfDocument.bufferViews.Get(accessor.sparse.valuesBufferViewId);
-                const Buffer& valuesBuffer = gltfDocument.buffers.Get(valuesBufferView.bufferId);
-                const size_t valuesOffset = accessor.sparse.valuesByteOffset + valuesBufferView.byteOffset;
+                return decodedData.data() + byteOffset;
+            }
 
-                std::vector<I> indices;
+            // Copies elementCount elements of elementSize bytes, starting at offset and spaced stride bytes apart in the
+            // buffer, to output where consecutive elements are spaced outputByteStride bytes apart
+            void ReadBinaryData(const Buffer& buffer, std::streamoff offset, size_t elementCount, size_t elementSize, size_t stride, uint8_t* output, size_t outputByteStride) const
+            {
+                auto copyBlock = [&](const uint8_t* source, size_t first, size_t count)
+                {
+                    CopyStrided(source, stride, output + first * outputByteStride, outputByteStride, elementSize, count);
+                };
 
-                if (!indicesBufferView.byteStride || indicesBufferView.byteStride.Get() == sizeof(I))
+                ReadBlockFn readBlock;
+
+                if (auto decodedData = GetBufferSource(buffer, readBlock))
+                {
+                    copyBlock(GetDecodedElements(buffer, *decodedData, offset, elementCount, elementSize, stride), 0U, elementCount);
+                }
+                else if ((stride == elementSize) && (outputByteStride == elementSize))
                 {
-                    indices = ReadBinaryData<I>(indicesBuffer, indicesOffset, count);
+                    readBlock(offset, output, elementCount * elementSize);
                 }
                 else
                 {
-                    indices = ReadBinaryDataInterleaved<I>(indicesBuffer, indicesOffset, count, 1U, indicesBufferView.byteStride.Get());
+                    ReadBinaryDataBlocks(offset, elementCount, elementSize, stride, readBlock, copyBlock);
                 }
+            }
 
-                std::vector<T> values;
+            // Calls visitBlock(source, first, count) for consecutive blocks of the elements without copying them to
+            // an output first: source points to element 'first' and the block's elements are spaced stride bytes apart
+            template<typename Fn>
+            void VisitBinaryData(const Buffer& buffer, std::streamoff offset, size_t elementCount, size_t elementSize, size_t stride, Fn&& visitBlock) const
+            {
+                ReadBlockFn readBlock;
 
-                if (!valuesBufferView.byteStride || valuesBufferView.byteStride.Get() == elementSize)
+                if (auto decodedData = GetBufferSource(buffer, readBlock))
                 {
-                    values = ReadBinaryData<T>(valuesBuffer, valuesOffset, count * typeCount);
+                    visitBlock(GetDecodedElements(buffer, *decodedData, offset, elementCount, elementSize, stride), 0U, elementCount);
                 }
                 else
                 {
-                    values = ReadBinaryDataInterleaved<T>(valuesBuffer, valuesOffset, count, typeCount, valuesBufferView.byteStride.Get());
+                    ReadBinaryDataBlocks(offset, elementCount, elementSize, stride, readBlock, visitBlock);
                 }
+            }
+
+            // Rather than reading each strided element individually, the byte range spanned by the elements is read in
+            // bulk, one block at a time, via readBlock(offset, block, blockLength) and each block is then passed to
+            // visitBlock(block, first, count)
+            template<typename Fn>
+            static void ReadBinaryDataBlocks(std::streamoff offset, size_t elementCount, size_t elementSize, size_t stride, const ReadBlockFn& readBlock, Fn&& visitBlock)
+            {
+                constexpr size_t blockByteLength = 64U * 1024U;
 
-                for (size_t i = 0; i < indices.size(); i++)
+                const size_t blockElementCount = std::max<size_t>(1U, blockByteLength / std::max<size_t>(1U, stride));
+
+                std::vector<uint8_t> block;
+
+                for (size_t first = 0U; first < elementCount; first += blockElementCount)
                 {
-                    assert(baseData.size() == accessor.count * typeCount);
-                    static_assert(sizeof(I) <= sizeof(size_t), "sizeof(I) < sizeof(size_t)");
-                    if (0 <= indices[i] && static_cast<size_t>(indices[i]) < accessor.count)
+                    const size_t count = std::min(blockElementCount, elementCount - first);
+
+                    block.resize((count - 1U) * stride + elementSize);
+                    readBlock(offset + static_cast<std::streamoff>(first * stride), block.data(), block.size());
+
+                    visitBlock(static_cast<const uint8_t*>(block.data()), first, count);
+                }
+            }
+
+            template<typename T>
+            std::vector<T> ReadBinaryData(const Buffer& buffer, std::streamoff offset, size_t componentCount) const
+            {
+                std::vector<T> data(componentCount);
+                ReadBinaryData(buffer, offset, componentCount, sizeof(T), sizeof(T), reinterpret_cast<uint8_t*>(data.data()), sizeof(T));
+                return data;
+            }
+
+            // Reads a sparse accessor's indices, widened to 32 bits. Throws if any index is outside the accessor's range,
+            // before anything is written to the output, as SparseAccessorView does.
+            std::vector<uint32_t> ReadSparseIndices(const Document& gltfDocument, const Accessor& accessor) const
+            {
+                switch (accessor.sparse.indicesComponentType)
+                {
+                case COMPONENT_UNSIGNED_BYTE:
+                    return ReadSparseIndices<uint8_t>(gltfDocument, accessor);
+                case COMPONENT_UNSIGNED_SHORT:
+                    return ReadSparseIndices<uint16_t>(gltfDocument, accessor);
+                case COMPONENT_UNSIGNED_INT:
+                    return ReadSparseIndices<uint32_t>(gltfDocument, accessor);
+                default:
+                    throw GLTFException("Unsupported sparse indices ComponentType");
+                }
+            }
+
+            template<typename I>
+            std::vector<uint32_t> ReadSparseIndices(const Document& gltfDocument, const Accessor& accessor) const
+            {
+                const size_t count = accessor.sparse.count;
+
+                const BufferView& indicesBufferView = gltfDocument.bufferViews.Get(accessor.sparse.indicesBufferViewId);
+                const Buffer& indicesBuffer = gltfDocument.buffers.Get(indicesBufferView.bufferId);
+                const size_t indicesOffset = accessor.sparse.indicesByteOffset + indicesBufferView.byteOffset;
+                const size_t indicesStride = indicesBufferView.byteStride ? indicesBufferView.byteStride.Get() : sizeof(I);
+
+                std::vector<uint32_t> indices(count);
+
+                VisitBinaryData(indicesBuffer, indicesOffset, count, sizeof(I), indicesStride, [&](const uint8_t* source, size_t first, size_t blockCount)
+                {
+                    for (size_t i = 0U; i < blockCount; ++i)
                     {
-                        for (size_t j = 0; j < typeCount; j++)
+                        I index;
+                        std::memcpy(&index, source + i * indicesStride, sizeof(I));
+
+                        if (index >= accessor.count)
                         {
-                            baseData[indices[i] * typeCount + j] = values[i * typeCount + j];
+                            throw GLTFException("Sparse index " + std::to_string(index) + " is outside the range of accessor " + accessor.id);
                         }
+
+                        indices[first + i] = index;
                     }
-                }
+                });
+
+                return indices;
+            }
+
+            // Writes a sparse accessor's substituted elements over the dense elements already in the output. The values
+            // are scattered straight from the blocks they are read in, rather than being read into a vector first.
+            template<typename T>
+            void ReadSparseBinaryData(const Document& gltfDocument, uint8_t* output, size_t outputByteStride, const Accessor& accessor) const
+            {
+                const auto elementSize = sizeof(T) * Accessor::GetTypeCount(accessor.type);
+
+                const std::vector<uint32_t> indices = ReadSparseIndices(gltfDocument, accessor);
+
+                const BufferView& valuesBufferView = gltfDocument.bufferViews.Get(accessor.sparse.valuesBufferViewId);
+                const Buffer& valuesBuffer = gltfDocument.buffers.Get(valuesBufferView.bufferId);
+                const size_t valuesOffset = accessor.sparse.valuesByteOffset + valuesBufferView.byteOffset;
+                const size_t valuesStride = valuesBufferView.byteStride ? valuesBufferView.byteStride.Get() : elementSize;
+
+                VisitBinaryData(valuesBuffer, valuesOffset, indices.size(), elementSize, valuesStride, [&](const uint8_t* source, size_t first, size_t blockCount)
+                {
+                    for (size_t i = 0U; i < blockCount; ++i)
+                    {
+                        std::memcpy(output + indices[first + i] * outputByteStride, source + i * valuesStride, elementSize);
+                    }
+                });
             }
 
+            // State shared by concurrent reads. It is held by pointer so that the reader remains movable.
+            struct SharedState
+            {
+                std::mutex streamReaderCacheMutex;
+
+                // Ordered from most to least recently used. The list is short enough that searching it is cheaper
+                // than maintaining a separate index.
+                std::mutex binaryReadersMutex;
+                std::list<std::pair<std::string, std::shared_ptr<const IRandomAccessReader>>> binaryReaders;
+
+                DecodedBufferCache decodedBufferCache;
+
+                const AccessorCache::ReaderId accessorCacheReaderId = AccessorCache::CreateReaderId();
+            };
+
+            std::shared_ptr<const IStreamReader> m_streamReader;
             std::unique_ptr<IStreamReaderCache> m_streamReaderCache;
+            std::unique_ptr<SharedState> m_sharedState;
+            std::shared_ptr<AccessorCache> m_accessorCache;
         };
     }
 }
@@ -0,0 +1,27 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // Positional, read-only access to a resource. Unlike an std::istream there is no shared get pointer that
+        // each read must first seek, so implementations must allow ReadAt to be called concurrently from multiple
+        // threads.
+        class IRandomAccessReader
+        {
+        public:
+            virtual ~IRandomAccessReader() = default;
+
+            // Fills data with the bytes starting at offset, throws if there are fewer than data.size() bytes available
+            virtual void ReadAt(uint64_t offset, std::span<uint8_t> data) const = 0;
+
+            virtual uint64_t GetSize() const = 0;
+        };
+    }
+}
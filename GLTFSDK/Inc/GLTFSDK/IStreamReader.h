@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <GLTFSDK/RandomAccessReader.h>
+
 #include <istream>
 #include <memory>
 #include <string>
@@ -16,6 +18,14 @@ namespace Microsoft
         public:
             virtual ~IStreamReader() = default;
             virtual std::shared_ptr<std::istream> GetInputStream(const std::string& filename) const = 0;
+
+            // Used by GLTFResourceReader to read buffer data. By default the stream returned by GetInputStream is
+            // adapted, which serializes concurrent reads. Override to return e.g. a FileRandomAccessReader so reads
+            // from multiple threads can proceed in parallel.
+            virtual std::shared_ptr<const IRandomAccessReader> GetRandomAccessReader(const std::string& filename) const
+            {
+                return std::make_shared<StreamRandomAccessReader>(GetInputStream(filename));
+            }
         };
     }
 }
@@ -6,8 +6,19 @@
 #include <iostream>
 #include <GLTFSDK/Exceptions.h>
 
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 #include <nlohmann/json.hpp>
 #include <nlohmann/json_fwd.hpp>
@@ -35,18 +46,87 @@ namespace Microsoft
             GenerateOnEmpty
         };
 
+        // The new index of each element of an IndexedContainer after RemoveIf or RemoveMany, indexed by the element's
+        // index before the removal. Removed elements map to RemovedIndex.
+        using IndexRemap = std::vector<size_t>;
+
+        constexpr size_t RemovedIndex = std::numeric_limits<size_t>::max();
+
+        // A typed 32-bit index of an element of an IndexedContainer<T>, a compact alternative to the element's string
+        // id that is resolved by indexing the container's vector directly. A default constructed handle is invalid
+        // and stands for an empty id, i.e. no reference. Handles are only valid until elements are removed.
+        template<typename T>
+        struct Handle
+        {
+            static constexpr uint32_t InvalidIndex = std::numeric_limits<uint32_t>::max();
+
+            constexpr Handle() = default;
+            constexpr explicit Handle(uint32_t index) : index(index) {}
+
+            constexpr bool IsValid() const { return index != InvalidIndex; }
+            constexpr explicit operator bool() const { return IsValid(); }
+
+            constexpr bool operator==(const Handle& rhs) const { return index == rhs.index; }
+            constexpr bool operator!=(const Handle& rhs) const { return index != rhs.index; }
+            constexpr bool operator<(const Handle& rhs) const { return index < rhs.index; }
+
+            uint32_t index = InvalidIndex;
+        };
+
         template<typename T, bool = std::is_const<T>::value>
         class IndexedContainer;
 
         // Const template parameter T partial specialization
         template<typename T>
         class IndexedContainer<const T, true> {
-            std::vector<T> m_elements;
-            std::unordered_map<std::string, size_t> m_elementIndices;
+            // The state of a container whose glTF array is only deserialized once the container is first accessed
+            struct DeferredElements {
+                std::function<nlohmann::json()> loadElements;
+                std::shared_ptr<ExtensionDeserializer> extensionDeserializer;
+                // Set by deserializeDeferred so that element types without JSON conversions can still be contained
+                void (*load)(IndexedContainer& container) = nullptr;
+                std::once_flag onceFlag;
+                std::atomic<bool> isLoaded = false;
+            };
+
+            // Mutable so that deferred elements can be loaded on first access, including const access
+            mutable std::vector<T> m_elements;
+            mutable std::pmr::unordered_map<std::string, size_t> m_elementIndices;
+            std::shared_ptr<DeferredElements> m_deferred;
         protected:
 
             Document* gltfDocument{};
         public:
+            IndexedContainer() = default;
+
+            // The index of the elements' ids, one node per element, is allocated from resource, which must outlive the
+            // container. Copies of the container use the default resource. The elements themselves stay in a single
+            // std::vector so that Elements() keeps its type, and the strings and containers inside each element, e.g.
+            // ids longer than the small-string buffer, still use the global heap. Releasing a resource therefore doesn't
+            // free a container in O(1), the elements are still destroyed one at a time.
+            explicit IndexedContainer(std::pmr::memory_resource* resource) : m_elementIndices(resource) {}
+
+            IndexedContainer(const IndexedContainer& other) {
+                *this = other;
+            }
+
+            IndexedContainer(IndexedContainer&&) = default;
+
+            // Copies are never deferred, the elements of other are loaded first if necessary
+            IndexedContainer& operator=(const IndexedContainer& other) {
+                if (this != &other) {
+                    other.Load();
+
+                    m_elements = other.m_elements;
+                    m_elementIndices = other.m_elementIndices;
+                    m_deferred.reset();
+                    gltfDocument = other.gltfDocument;
+                }
+
+                return *this;
+            }
+
+            IndexedContainer& operator=(IndexedContainer&&) = default;
 
             virtual void setGltfDocument(Document* pGltfDocument) {
                 gltfDocument = pGltfDocument;
@@ -61,33 +141,128 @@ namespace Microsoft
                 }
             }
             void serialize(nlohmann::json& json) const {
+                Load();
                 json = m_elements;
             }
 
+            // Converts the elements of the glTF array and moves them into the container, which is reserved up front
             void deserialize(const nlohmann::json& json) {
-                size_t index = 0;
+                Load();
+                reserveAdditional(json.size());
+
                 for (auto& valueArray : json) {
-                    try {
-                        auto elem = valueArray.get<T>();
+                    appendElement(valueArray);
+                }
+            }
 
-                        const auto& item = Append(elem, AppendIdPolicy::GenerateOnEmpty);
-                        const auto& itemId = item.id;
+            // Converts a single element of the glTF array and appends it, used when the array isn't available as a
+            // whole because the document is parsed one element at a time
+            void deserializeElement(const nlohmann::json& json) {
+                Load();
+                appendElement(json);
+            }
+
+            // Replaces the elements with a glTF array that is only obtained from loadElements, and converted, once the
+            // container is first accessed. Access is thread-safe to the same extent as it is for any other container,
+            // i.e. concurrent const access is safe. Any exception thrown while loading the elements is rethrown by the
+            // access that triggered it and the container is left empty, the next access tries to load them again.
+            void deserializeDeferred(std::function<nlohmann::json()> loadElements) {
+                Clear();
 
+                m_deferred = std::make_shared<DeferredElements>();
+                m_deferred->loadElements = std::move(loadElements);
+                m_deferred->load = [](IndexedContainer& container) { container.loadDeferred(); };
+            }
 
-                        (void)itemId;   // To disable unused-variable warnings when assert is compiled away.
-                        assert(itemId == std::to_string(index));
+            // Whether the elements are still waiting to be loaded by the first access to the container
+            bool IsDeferred() const {
+                return m_deferred && !m_deferred->isLoaded;
+            }
+
+        private:
+            void Load() const {
+                if (m_deferred) {
+                    std::call_once(m_deferred->onceFlag, [this]() {
+                        // Only the mutable members are modified
+                        m_deferred->load(const_cast<IndexedContainer&>(*this));
+                    });
+                }
+            }
+
+            void loadDeferred() {
+                try {
+                    const auto json = m_deferred->loadElements();
+
+                    reserveAdditional(json.size());
+
+                    for (auto& valueArray : json) {
+                        appendElement(valueArray);
                     }
-                    catch (const InvalidGLTFException& e){
-                        std::cerr << "Could not parse " << "[" << index << "]: " << e.what() << "\n";
-                        throw;
+
+                    if (m_deferred->extensionDeserializer) {
+                        for (auto& m_Element : m_elements) {
+                            m_Element.deserializeExtensions(m_deferred->extensionDeserializer);
+                        }
                     }
+                }
+                catch (...) {
+                    m_elementIndices.clear();
+                    m_elements.clear();
+                    throw;
+                }
+
+                // The JSON isn't needed anymore
+                m_deferred->loadElements = nullptr;
+                m_deferred->isLoaded = true;
+            }
 
-                    ++index;
+            void appendElement(const nlohmann::json& json) {
+                const size_t index = m_elements.size();
+                try {
+                    auto elem = json.get<T>();
+
+                    const auto& item = appendLoaded(std::move(elem), AppendIdPolicy::GenerateOnEmpty);
+
+                    (void)item;   // To disable unused-variable warnings when assert is compiled away.
+                    assert(IsIndexId(item.id, index));
+                }
+                catch (const InvalidGLTFException& e){
+                    std::cerr << "Could not parse " << "[" << index << "]: " << e.what() << "\n";
+                    throw;
                 }
             }
 
+            // Whether id is the element's index, as generated for elements read from a glTF array, compared without
+            // allocating a string for the index
+            static bool IsIndexId(const std::string& id, size_t index) {
+                char buffer[std::numeric_limits<size_t>::digits10 + 1];
+                const auto result = std::to_chars(std::begin(buffer), std::end(buffer), index);
+
+                return std::string_view(buffer, result.ptr - buffer) == id;
+            }
+
+            // Grows the elements and the index of their ids to fit count more elements. Capacity grows geometrically
+            // so that repeatedly appending small ranges doesn't reallocate on every call.
+            void reserveAdditional(size_t count) {
+                const size_t size = m_elements.size() + count;
+
+                if (size > m_elements.capacity()) {
+                    m_elements.reserve(std::max(size, m_elements.capacity() * 2U));
+                }
+
+                m_elementIndices.reserve(size);
+            }
+
+        public:
             void deserializeExtensions(const std::shared_ptr<ExtensionDeserializer> &pDeserializer) {
                 if (!pDeserializer) return;
+
+                // Deferred elements are deserialized once they're loaded
+                if (IsDeferred()) {
+                    m_deferred->extensionDeserializer = pDeserializer;
+                    return;
+                }
+
                 for (auto & m_Element : m_elements) {
                     m_Element.deserializeExtensions(pDeserializer);
                 }
@@ -101,12 +276,14 @@ namespace Microsoft
                 type.deserialize(json);
             }
 
-            const T& Front() const { return m_elements.front(); }
+            const T& Front() const { Load(); return m_elements.front(); }
 
-            const T& Back() const { return m_elements.back(); }
+            const T& Back() const { Load(); return m_elements.back(); }
 
             const T& operator[](size_t index) const
             {
+                Load();
+
                 if (index < m_elements.size())
                 {
                     return m_elements[index]; // operator[] used rather than at() to avoid unnecessary bounds checking
@@ -117,7 +294,15 @@ namespace Microsoft
 
             const T& operator[](const std::string& key) const { return operator[](GetIndex(key)); }
 
-            bool operator==(const IndexedContainer& rhs) const { return (m_elements == rhs.m_elements); }
+            const T& operator[](Handle<T> handle) const
+            {
+                if (!handle)
+                    throw GLTFException("Invalid handle");
+
+                return operator[](handle.index);
+            }
+
+            bool operator==(const IndexedContainer& rhs) const { Load(); rhs.Load(); return (m_elements == rhs.m_elements); }
 
             bool operator!=(const IndexedContainer& rhs) const { return !(operator==(rhs)); }
 
@@ -126,6 +311,24 @@ namespace Microsoft
             }
 
             const T& Append(T&& element, AppendIdPolicy policy = AppendIdPolicy::ThrowOnEmpty) {
+                Load();
+                return appendLoaded(std::move(element), policy);
+            }
+
+            // Moves all the elements of a range into the container, which is reserved for them up front. Ids are
+            // handled as by Append, if an exception is thrown the elements before the one that caused it are kept.
+            template<typename Range>
+            void AppendRange(Range&& elements, AppendIdPolicy policy = AppendIdPolicy::ThrowOnEmpty) {
+                Load();
+                reserveAdditional(std::size(elements));
+
+                for (auto& element : elements) {
+                    appendLoaded(std::move(element), policy);
+                }
+            }
+
+        private:
+            const T& appendLoaded(T&& element, AppendIdPolicy policy) {
                 const bool isEmptyId = element.id.empty();
                 if constexpr (requires() {
                     element.setGltfDocument(gltfDocument);
@@ -161,19 +364,42 @@ namespace Microsoft
                 return m_elements.back();
             }
 
+        public:
+            // Any deferred elements are discarded without being loaded
             void Clear()
             {
+                m_deferred.reset();
                 m_elementIndices.clear();
                 m_elements.clear();
             }
 
-            const std::vector<T>& Elements() const { return m_elements; }
+            const std::vector<T>& Elements() const { Load(); return m_elements; }
+
+            std::pmr::memory_resource* GetMemoryResource() const { return m_elementIndices.get_allocator().resource(); }
 
             const T& Get(size_t index) const { return operator[](index); }
 
             const T& Get(const std::string& key) const { return operator[](key); }
 
+            const T& Get(Handle<T> handle) const { return operator[](handle); }
+
+            // An empty key, i.e. no reference, maps to an invalid handle. Throws if the key isn't in the container.
+            Handle<T> GetHandle(const std::string& key) const {
+                if (key.empty()) return {};
+
+                return Handle<T>(static_cast<uint32_t>(GetIndex(key)));
+            }
+
+            // The id of the element a handle refers to, or an empty id for an invalid handle
+            const std::string& GetId(Handle<T> handle) const {
+                static const std::string emptyId;
+
+                return handle ? operator[](handle).id : emptyId;
+            }
+
             size_t GetIndex(const std::string& key) const {
+                Load();
+
                 if (key.empty())
                     throw GLTFException("Invalid key - cannot be empty");
 
@@ -185,7 +411,7 @@ namespace Microsoft
                 return it->second;
             }
 
-            bool Has(const std::string& key) const { return m_elementIndices.find(key) != m_elementIndices.end(); }
+            bool Has(const std::string& key) const { Load(); return m_elementIndices.find(key) != m_elementIndices.end(); }
 
             void Remove(const std::string& key)
             {
@@ -203,6 +429,51 @@ namespace Microsoft
                 }
             }
 
+            // Removes every element for which pred returns true and compacts the remaining ones in a single pass,
+            // keeping their order. The container is left unchanged if pred throws.
+            template<typename Pred>
+            IndexRemap RemoveIf(Pred pred) {
+                Load();
+
+                std::vector<bool> isRemoved(m_elements.size());
+
+                for (size_t i = 0U; i < m_elements.size(); ++i) {
+                    isRemoved[i] = pred(std::as_const(m_elements[i]));
+                }
+
+                return removeMarked(isRemoved);
+            }
+
+            // Removes the elements with the given keys in a single pass. Throws, without removing anything, if any of
+            // the keys isn't in the container.
+            IndexRemap RemoveMany(const std::vector<std::string>& keys) {
+                std::vector<bool> isRemoved(Size());
+
+                for (const auto& key : keys) {
+                    isRemoved[GetIndex(key)] = true;
+                }
+
+                return removeMarked(isRemoved);
+            }
+
+            // Changes the id of the element with the given key without moving it. Throws if key isn't in the
+            // container, or if newKey is empty or already in the container.
+            void Rename(const std::string& key, std::string newKey) {
+                const auto index = GetIndex(key);
+
+                if (newKey.empty())
+                    throw GLTFException("Invalid key - cannot be empty");
+
+                if (newKey == key)
+                    return;
+
+                if (!m_elementIndices.emplace(newKey, index).second)
+                    throw GLTFException("key " + newKey + " already exists in IndexedContainer");
+
+                m_elementIndices.erase(key);
+                m_elements[index].id = std::move(newKey);
+            }
+
             void Replace(const T& element) { Replace(T(element)); }
 
             void Replace(T&& element) {
@@ -211,12 +482,36 @@ namespace Microsoft
             }
 
             void Reserve(size_t capacity) {
+                Load();
                 m_elements.reserve(capacity);
                 m_elementIndices.reserve(capacity);
             }
 
-            size_t Size() const { return m_elements.size(); }
+            size_t Size() const { Load(); return m_elements.size(); }
+
+        private:
+            // Moves each remaining element to its new index and updates only the indices of the ids that changed
+            IndexRemap removeMarked(const std::vector<bool>& isRemoved) {
+                IndexRemap remap(m_elements.size(), RemovedIndex);
+                size_t size = 0U;
+
+                for (size_t i = 0U; i < m_elements.size(); ++i) {
+                    if (isRemoved[i]) {
+                        m_elementIndices.erase(m_elements[i].id);
+                        continue;
+                    }
 
+                    if (size != i) {
+                        m_elements[size] = std::move(m_elements[i]);
+                        m_elementIndices.find(m_elements[size].id)->second = size;
+                    }
+
+                    remap[i] = size++;
+                }
+
+                m_elements.erase(m_elements.begin() + size, m_elements.end());
+                return remap;
+            }
         };
 
         // Mutable template parameter T partial specialization - Uses private inheritance to gain the const template parameter functionality without an is-a relationship
@@ -227,6 +522,10 @@ namespace Microsoft
             // T). This means all inherited members must be qualified with 'this->' or 'IndexedContainer<const T>::'
 
         public:
+            IndexedContainer() = default;
+
+            explicit IndexedContainer(std::pmr::memory_resource* resource) : IndexedContainer<const T>(resource) {}
+
             void setGltfDocument(Document* pGltfDocument) override {
                 this->gltfDocument = pGltfDocument;
 
@@ -244,25 +543,11 @@ namespace Microsoft
             }
 
             void deserialize(const nlohmann::json& json) {
-                size_t index = 0;
-                for (auto& valueArray : json) {
-                    try {
-                        auto elem = valueArray.get<T>();
-
-                        const auto& item = Append(elem, AppendIdPolicy::GenerateOnEmpty);
-                        const auto& itemId = item.id;
-
-
-                        (void)itemId;   // To disable unused-variable warnings when assert is compiled away.
-                        assert(itemId == std::to_string(index));
-                    }
-                    catch (const InvalidGLTFException& e){
-                        std::cerr << "Could not parse " << "[" << index << "]: " << e.what() << "\n";
-                        throw;
-                    }
+                IndexedContainer<const T>::deserialize(json);
+            }
 
-                    ++index;
-                }
+            void deserializeElement(const nlohmann::json& json) {
+                IndexedContainer<const T>::deserializeElement(json);
             }
 
             friend void to_json(nlohmann::json& json, const IndexedContainer& type) {
@@ -292,6 +577,11 @@ namespace Microsoft
                 return operator[](GetIndex(key));
             }
 
+            T& operator[](Handle<T> handle)
+            {
+                return const_cast<T&>(IndexedContainer<const T>::operator[](handle));
+            }
+
             bool operator==(const IndexedContainer& rhs) const
             {
                 return IndexedContainer<const T>::operator==(rhs);
@@ -327,17 +617,29 @@ namespace Microsoft
                 return operator[](key);
             }
 
+            T& Get(Handle<T> handle)
+            {
+                return operator[](handle);
+            }
+
             // No using declaration for Append, operator== or operator!= as we don't
             // want to make the base class versions of these functions publically
             // accessible (the mutable versions replace rather than complement them)
+            using IndexedContainer<const T>::AppendRange;
             using IndexedContainer<const T>::Front;
             using IndexedContainer<const T>::Back;
             using IndexedContainer<const T>::Clear;
             using IndexedContainer<const T>::Elements;
             using IndexedContainer<const T>::Get;
+            using IndexedContainer<const T>::GetHandle;
+            using IndexedContainer<const T>::GetId;
             using IndexedContainer<const T>::GetIndex;
+            using IndexedContainer<const T>::GetMemoryResource;
             using IndexedContainer<const T>::Has;
             using IndexedContainer<const T>::Remove;
+            using IndexedContainer<const T>::RemoveIf;
+            using IndexedContainer<const T>::RemoveMany;
+            using IndexedContainer<const T>::Rename;
             using IndexedContainer<const T>::Replace;
             using IndexedContainer<const T>::Reserve;
             using IndexedContainer<const T>::Size;
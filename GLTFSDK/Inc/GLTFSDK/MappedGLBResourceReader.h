@@ -0,0 +1,96 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/GLBResourceReader.h>
+#include <GLTFSDK/MemoryMappedFile.h>
+
+#include <span>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // A GLBResourceReader that maps the whole GLB file into memory rather than reading it
+        // through an std::istream. Data stored in the GLB binary chunk can be accessed in place via
+        // the GetBinaryDataView functions, the inherited ReadBinaryData functions still work and
+        // copy straight out of the mapping. Spans returned by this class are valid for as long as
+        // the reader (or any stream returned by GetBinaryStream) is alive. GetJsonChunk views the
+        // manifest within the mapping so it can be deserialized without being copied.
+        class MappedGLBResourceReader : public GLBResourceReader
+        {
+        public:
+            MappedGLBResourceReader(std::shared_ptr<const IStreamReader> streamReader, const std::string& glbPath);
+            MappedGLBResourceReader(std::unique_ptr<IStreamReaderCache> streamCache, const std::string& glbPath);
+
+            MappedGLBResourceReader(std::shared_ptr<const IStreamReader> streamReader, std::shared_ptr<const MemoryMappedFile> glbFile);
+            MappedGLBResourceReader(std::unique_ptr<IStreamReaderCache> streamCache, std::shared_ptr<const MemoryMappedFile> glbFile);
+
+            // The data of the GLB binary chunk, empty if the GLB has no binary chunk
+            std::span<const uint8_t> GetBinaryChunk() const;
+
+            // The bytes of a bufferView that references the GLB binary chunk
+            std::span<const uint8_t> GetBinaryDataView(const Document& document, const BufferView& bufferView) const;
+
+            // The elements of an accessor that references the GLB binary chunk. Only accessors whose
+            // data can be addressed in place are supported: sparse and interleaved accessors throw
+            // a GLTFException and must be read with ReadBinaryData instead.
+            template<typename T>
+            std::span<const T> GetBinaryDataView(const Document& document, const Accessor& accessor) const
+            {
+                ValidateComponentType<T>(accessor);
+
+                Validation::ValidateAccessor(document, accessor);
+
+                if (accessor.sparse.count > 0U)
+                {
+                    throw GLTFException("Accessor " + accessor.id + " is sparse and can't be viewed in place");
+                }
+
+                if (accessor.bufferViewId.empty())
+                {
+                    throw GLTFException("Accessor " + accessor.id + " has no bufferView");
+                }
+
+                const BufferView& bufferView = document.bufferViews.Get(accessor.bufferViewId);
+
+                const size_t typeCount = Accessor::GetTypeCount(accessor.type);
+                const size_t elementSize = sizeof(T) * typeCount;
+
+                if (bufferView.byteStride && bufferView.byteStride.Get() != elementSize)
+                {
+                    throw GLTFException("Accessor " + accessor.id + " is interleaved and can't be viewed in place");
+                }
+
+                const auto bufferViewData = GetBinaryDataView(document, bufferView);
+                const size_t byteLength = accessor.count * elementSize;
+
+                if (accessor.byteOffset > bufferViewData.size() || byteLength > (bufferViewData.size() - accessor.byteOffset))
+                {
+                    throw GLTFException("Accessor " + accessor.id + " data is outside the range of its bufferView");
+                }
+
+                const auto accessorData = bufferViewData.subspan(accessor.byteOffset, byteLength);
+
+                if (reinterpret_cast<uintptr_t>(accessorData.data()) % alignof(T) != 0U)
+                {
+                    throw GLTFException("Accessor " + accessor.id + " data is not aligned to its component type");
+                }
+
+                return { reinterpret_cast<const T*>(accessorData.data()), accessor.count * typeCount };
+            }
+
+            const MemoryMappedFile& GetMappedFile() const { return *m_glbFile; }
+
+        protected:
+            bool HasDefaultBinaryStreams() const override;
+
+            // The GLB binary chunk is read straight out of the mapping without any locking
+            std::shared_ptr<const IRandomAccessReader> CreateBinaryReader(const Buffer& buffer) const override;
+
+        private:
+            std::shared_ptr<const MemoryMappedFile> m_glbFile;
+        };
+    }
+}
@@ -0,0 +1,40 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // Read-only view of an entire file mapped into the address space of the process. The
+        // mapping is released when the MemoryMappedFile instance is destroyed so any spans
+        // returned by GetData must not outlive it.
+        class MemoryMappedFile
+        {
+        public:
+            // The path is expected to be encoded as UTF-8
+            explicit MemoryMappedFile(const std::string& path);
+            ~MemoryMappedFile();
+
+            MemoryMappedFile(const MemoryMappedFile&) = delete;
+            MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+            std::span<const uint8_t> GetData() const { return { m_data, m_size }; }
+
+            size_t GetSize() const { return m_size; }
+
+        private:
+            const uint8_t* m_data;
+            size_t         m_size;
+#ifdef _WIN32
+            void*          m_fileMapping;
+#endif
+        };
+    }
+}
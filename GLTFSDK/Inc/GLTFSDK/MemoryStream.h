@@ -0,0 +1,88 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <span>
+#include <streambuf>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // Read-only, seekable stream buffer over a contiguous block of memory. No data is copied,
+        // so the memory must remain valid for the lifetime of the MemoryStreamBuf.
+        class MemoryStreamBuf : public std::streambuf
+        {
+        public:
+            explicit MemoryStreamBuf(std::span<const uint8_t> data)
+            {
+                // std::streambuf only deals in mutable pointers, the get area is never written to
+                auto begin = reinterpret_cast<char*>(const_cast<uint8_t*>(data.data()));
+                setg(begin, begin, begin + data.size());
+            }
+
+        protected:
+            pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override
+            {
+                if (!(which & std::ios_base::in))
+                {
+                    return pos_type(off_type(-1));
+                }
+
+                off_type base;
+
+                switch (dir)
+                {
+                case std::ios_base::beg:
+                    base = 0;
+                    break;
+                case std::ios_base::cur:
+                    base = gptr() - eback();
+                    break;
+                case std::ios_base::end:
+                    base = egptr() - eback();
+                    break;
+                default:
+                    return pos_type(off_type(-1));
+                }
+
+                const off_type pos = base + off;
+
+                if (pos < 0 || pos > (egptr() - eback()))
+                {
+                    return pos_type(off_type(-1));
+                }
+
+                setg(eback(), eback() + pos, egptr());
+                return pos_type(pos);
+            }
+
+            pos_type seekpos(pos_type pos, std::ios_base::openmode which) override
+            {
+                return seekoff(off_type(pos), std::ios_base::beg, which);
+            }
+        };
+
+        // An std::istream over a MemoryStreamBuf. The optional owner keeps the underlying memory
+        // alive for as long as the stream exists (e.g. a shared MemoryMappedFile instance).
+        class MemoryStream : public std::istream
+        {
+        public:
+            explicit MemoryStream(std::span<const uint8_t> data, std::shared_ptr<const void> owner = nullptr) :
+                std::istream(nullptr),
+                m_owner(std::move(owner)),
+                m_streamBuf(data)
+            {
+                rdbuf(&m_streamBuf);
+            }
+
+        private:
+            std::shared_ptr<const void> m_owner;
+            MemoryStreamBuf m_streamBuf;
+        };
+    }
+}
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <span>
 #include <vector>
 
 #include <GLTFSDK/GLTF.h>
@@ -57,6 +58,31 @@ namespace Microsoft
             std::vector<uint32_t> GetJointWeights32(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor);
             std::vector<uint32_t> GetJointWeights32_0(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive);
 
+            // Variants that decode into caller-provided memory rather than allocating a new vector. Vertex
+            // attributes are written outputByteStride bytes apart, zero means the output is tightly packed.
+            void GetIndices16Into(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, std::span<uint16_t> output);
+            void GetIndices16Into(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, std::span<uint16_t> output);
+
+            void GetIndices32Into(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, std::span<uint32_t> output);
+            void GetIndices32Into(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, std::span<uint32_t> output);
+
+            void GetPositionsInto(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, std::span<float> output, size_t outputByteStride = 0U);
+            void GetPositionsInto(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, std::span<float> output, size_t outputByteStride = 0U);
+            void GetPositionsInto(const Document& doc, const GLTFResourceReader& reader, const MorphTarget& morphTarget, std::span<float> output, size_t outputByteStride = 0U);
+
+            void GetNormalsInto(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, std::span<float> output, size_t outputByteStride = 0U);
+            void GetNormalsInto(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, std::span<float> output, size_t outputByteStride = 0U);
+            void GetNormalsInto(const Document& doc, const GLTFResourceReader& reader, const MorphTarget& morphTarget, std::span<float> output, size_t outputByteStride = 0U);
+
+            void GetTangentsInto(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, std::span<float> output, size_t outputByteStride = 0U);
+            void GetTangentsInto(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, std::span<float> output, size_t outputByteStride = 0U);
+            void GetTangentsInto(const Document& doc, const GLTFResourceReader& reader, const MorphTarget& morphTarget, std::span<float> output, size_t outputByteStride = 0U);
+            void GetMorphTangentsInto(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, std::span<float> output, size_t outputByteStride = 0U);
+
+            void GetTexCoordsInto(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, std::span<float> output, size_t outputByteStride = 0U);
+            void GetTexCoordsInto_0(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, std::span<float> output, size_t outputByteStride = 0U);
+            void GetTexCoordsInto_1(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, std::span<float> output, size_t outputByteStride = 0U);
+
             std::vector<uint16_t> ReverseTriangulateIndices16(const uint16_t* indices, size_t indexCount, MeshMode mode);
             std::vector<uint32_t> ReverseTriangulateIndices32(const uint32_t* indices, size_t indexCount, MeshMode mode);
 
@@ -0,0 +1,73 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/IRandomAccessReader.h>
+
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // Reads from a contiguous block of memory. No data is copied, the optional owner keeps the memory alive for
+        // as long as the reader exists (e.g. a shared MemoryMappedFile or std::vector instance).
+        class MemoryRandomAccessReader : public IRandomAccessReader
+        {
+        public:
+            explicit MemoryRandomAccessReader(std::span<const uint8_t> data, std::shared_ptr<const void> owner = nullptr);
+
+            void ReadAt(uint64_t offset, std::span<uint8_t> data) const override;
+            uint64_t GetSize() const override;
+
+        private:
+            std::shared_ptr<const void> m_owner;
+            std::span<const uint8_t> m_data;
+        };
+
+        // Reads from a file with positional reads (pread or overlapped ReadFile) so that concurrent reads never
+        // contend for a file position
+        class FileRandomAccessReader : public IRandomAccessReader
+        {
+        public:
+            // The path is expected to be encoded as UTF-8
+            explicit FileRandomAccessReader(const std::string& path);
+            ~FileRandomAccessReader();
+
+            FileRandomAccessReader(const FileRandomAccessReader&) = delete;
+            FileRandomAccessReader& operator=(const FileRandomAccessReader&) = delete;
+
+            void ReadAt(uint64_t offset, std::span<uint8_t> data) const override;
+            uint64_t GetSize() const override;
+
+        private:
+#ifdef _WIN32
+            void* m_file;
+#else
+            int m_file;
+#endif
+            uint64_t m_size;
+        };
+
+        // Adapts an std::istream, starting at the specified position, for streams that have no positional
+        // equivalent. Each seek and read is made while holding a lock, so concurrent reads are safe but serialized.
+        class StreamRandomAccessReader : public IRandomAccessReader
+        {
+        public:
+            explicit StreamRandomAccessReader(std::shared_ptr<std::istream> stream, std::streampos streamPos = {});
+
+            void ReadAt(uint64_t offset, std::span<uint8_t> data) const override;
+            uint64_t GetSize() const override;
+
+        private:
+            std::shared_ptr<std::istream> m_stream;
+            std::streampos m_streamPos;
+
+            mutable std::mutex m_mutex;
+        };
+    }
+}
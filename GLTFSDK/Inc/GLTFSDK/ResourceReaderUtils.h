@@ -5,6 +5,7 @@
 
 #include <GLTFSDK/Exceptions.h>
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <cmath>
@@ -109,65 +110,9 @@ namespace Microsoft
             return decodeTable;
         }
 
-        inline void Base64Decode(Base64StringView encodedData, Base64BufferView decodedData, size_t bytesToSkip)
-        {
-            if (encodedData.GetByteCount() != (decodedData.bufferByteLength + bytesToSkip))
-            {
-                throw GLTFException("The specified decode buffer's size is incorrect");
-            }
-
-            static const std::vector<uint8_t> decodeTable = GetDecodeTable();
-
-            uint32_t block = 0U;
-            uint32_t blockBits = 0U;
-
-            uint8_t* decodedBytePtr = static_cast<uint8_t*>(decodedData.buffer);
-
-            for (const auto encodedChar : encodedData)
-            {
-                // For platforms where char is unsigned (encodedChar < 0) results in a tautology warning.
-                // Only do that test on platforms where char is signed.
-                if ((std::numeric_limits<char>::is_signed && (static_cast<signed char>(encodedChar) < 0)) || (static_cast<size_t>(encodedChar) >= decodeTable.size()))
-                {
-                    throw GLTFException("Invalid base64 character");
-                }
-
-                const auto decodedChar = decodeTable[encodedChar];
-
-                if (decodedChar == std::numeric_limits<uint8_t>::max())
-                {
-                    throw GLTFException("Invalid base64 character");
-                }
-
-                // Each character of a base64 string encodes 6 bits of data so left shift any remaining
-                // bits to accomodate another character's worth of data before performing a bitwise OR
-                block <<= 6U;
-                block |= decodedChar & 0x3F;
-
-                // Keep track of how many bits of the 'block' variable are currently used
-                blockBits += 6U;
-
-                // If there are 8 or more bits stored in 'block' then write a single byte to the output buffer
-                if (blockBits >= 8U)
-                {
-                    blockBits -= 8U;
-
-                    if (bytesToSkip > 0)
-                    {
-                        bytesToSkip--;
-                    }
-                    else
-                    {
-                        // Right shift the decoded data stored in 'block' so that the byte of
-                        // data to be written to the output buffer occupies the low-order byte
-                        *(decodedBytePtr++) = (block >> blockBits) & 0xFF;
-                    }
-
-                    // Generate a bitmask that discards only the byte just written to the output buffer during the bitwise AND
-                    block &= (1 << blockBits) - 1;
-                }
-            }
-        }
+        // Decodes encodedData into decodedData, discarding the first bytesToSkip decoded bytes. Blocks of characters are
+        // validated and decoded with SIMD kernels (selected at runtime based on CPU support) where available.
+        void Base64Decode(Base64StringView encodedData, Base64BufferView decodedData, size_t bytesToSkip);
 
         inline std::vector<uint8_t> Base64Decode(const Base64StringView& encodedData)
         {
@@ -219,6 +164,18 @@ namespace Microsoft
             return IsUriBase64(uri, itBegin, itEnd);
         }
 
+        // Copies elementCount elements of elementSize bytes from source, where consecutive elements are sourceStride
+        // bytes apart, to destination, where they are destinationStride bytes apart. Common element sizes are copied
+        // with SIMD load/store or gather kernels when the CPU supports them.
+        void CopyStrided(const uint8_t* source, size_t sourceStride, uint8_t* destination, size_t destinationStride, size_t elementSize, size_t elementCount);
+
+        // Converts componentCount tightly packed components of type T (int8_t, uint8_t, int16_t or uint16_t) from source
+        // to tightly packed floats in destination in a single pass, applying ComponentToFloat if normalized is true and
+        // a plain conversion otherwise. The results are identical to the scalar conversions, using SIMD kernels when the
+        // CPU supports them. Neither pointer needs to be aligned.
+        template<typename T>
+        void ComponentsToFloats(const uint8_t* source, uint8_t* destination, size_t componentCount, bool normalized);
+
         // Conversions of normalized component types to/from floats are explicitly defined in the 2.0 spec
         inline float ComponentToFloat(const float w)   { return w; }
         inline float ComponentToFloat(const int8_t w)  { return std::max(static_cast<float>(w) / 127.0f, -1.0f); }
@@ -90,6 +90,19 @@ namespace Microsoft
         SchemaFlags  operator& (SchemaFlags lhs,  SchemaFlags rhs);
         SchemaFlags& operator&=(SchemaFlags& lhs, SchemaFlags rhs);
 
+        // Returns the flag that disables the schema at schemaUri, or SchemaFlags::None if it is not one of the glTF schemas
+        SchemaFlags GetSchemaFlag(const std::string& schemaUri);
+
         std::unique_ptr<const class ISchemaLocator> GetDefaultSchemaLocator(SchemaFlags schemaFlags);
+
+        // How documents are validated against the glTF schemas. Valijson, the default, interprets the schemas at
+        // runtime and is always used for schemas provided by a custom ISchemaLocator. Native is opt-in and uses
+        // validation code generated from the schemas at build time by GenerateSchemaValidator.cmake, which reports the
+        // same violations as Valijson. Builds that don't generate the native code fall back to Valijson.
+        enum class SchemaValidationEngine
+        {
+            Native,
+            Valijson
+        };
     }
 }
@@ -1,9 +1,20 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#pragma once
+
+#include <GLTFSDK/Executor.h>
+#include <GLTFSDK/Schema.h>
+
 #include <memory>
+#include <string>
 #include <nlohmann/json_fwd.hpp>
 
+namespace valijson
+{
+    class Schema;
+}
+
 namespace Microsoft
 {
     namespace glTF
@@ -15,6 +26,56 @@ namespace Microsoft
             virtual const char* GetSchemaContent(const std::string& uri) const = 0;
         };
 
+        namespace NativeSchemaValidation
+        {
+            class Context;
+        }
+
+        // A schema that is parsed once and can then validate any number of documents
+        class SchemaValidator
+        {
+        public:
+            // Validates against one of the glTF schemas with the generated native code, see SchemaValidationEngine
+            SchemaValidator(const std::string& schemaUri, SchemaFlags schemaFlags);
+            SchemaValidator(const std::string& schemaUri, const ISchemaLocator& schemaLocator);
+            SchemaValidator(const std::string& schemaUri, std::unique_ptr<const ISchemaLocator> schemaLocator);
+            ~SchemaValidator();
+
+            // Whether documents are validated by the generated native code rather than valijson
+            bool IsNative() const;
+
+            // Throws a ValidationException describing the first schema violation found. If rootContext isn't empty it
+            // replaces the '<root>' the reported location starts with, e.g. "<root>[accessors][3]" when validating an
+            // element of a document's accessors array on its own.
+            void Validate(const nlohmann::json& document, const std::string& rootContext = {}) const;
+
+        private:
+            std::unique_ptr<valijson::Schema> m_schema;
+
+            bool (*m_nativeSchema)(const nlohmann::json& value, NativeSchemaValidation::Context& context);
+            SchemaFlags m_schemaFlags;
+        };
+
+        // Returns the schema at schemaUri as located by GetDefaultSchemaLocator(schemaFlags). Schemas are compiled on
+        // first use and then shared, process-wide, by every caller requesting the same uri, flags and engine. Thread-safe.
+        std::shared_ptr<const SchemaValidator> GetSchemaValidator(const std::string& schemaUri, SchemaFlags schemaFlags, SchemaValidationEngine schemaEngine = SchemaValidationEngine::Valijson);
+
+        // As above for a caller provided locator, e.g. by an extension deserializer. Schemas are cached for as long as
+        // the locator instance is alive, so the locator should be created once and reused rather than per document.
+        std::shared_ptr<const SchemaValidator> GetSchemaValidator(const std::string& schemaUri, const std::shared_ptr<const ISchemaLocator>& schemaLocator);
+
+        void ValidateDocumentAgainstSchema(const nlohmann::json& d, const std::string& schemaUri, SchemaFlags schemaFlags, SchemaValidationEngine schemaEngine = SchemaValidationEngine::Valijson);
+
+        constexpr size_t DefaultValidationChunkSize = 1024U;
+
+        // Validates a manifest against the glTF schema, as ValidateDocumentAgainstSchema(d, SCHEMA_URI_GLTF, ...) does,
+        // with the elements of the top-level arrays (accessors, nodes, meshes, etc.) validated concurrently on the
+        // executor in chunks of up to chunkSize elements. Reports the same violation as serial validation regardless of
+        // which chunk finds a violation first.
+        void ValidateDocumentAgainstSchema(const nlohmann::json& d, SchemaFlags schemaFlags, const IExecutor& executor, size_t chunkSize = DefaultValidationChunkSize, SchemaValidationEngine schemaEngine = SchemaValidationEngine::Valijson);
+
+        // Compiles the schema on every call as the locator is released afterwards, there is nothing to associate a cached
+        // schema with. Use GetSchemaValidator with a shared locator to validate against a cached schema instead.
         void ValidateDocumentAgainstSchema(const nlohmann::json& d, const std::string& schemaUri, std::unique_ptr<const ISchemaLocator> schemaLocator);
     }
 }
@@ -3,14 +3,28 @@
 
 #pragma once
 
+#include <cstddef>
+#include <iosfwd>
 #include <memory>
 #include <string>
 
 namespace Microsoft::glTF {
 class Document;
+class IExecutor;
+
+constexpr size_t DefaultSerializationChunkSize = 4096U;
+
 class Serializer {
 public:
 
     static std::string Serialize(const std::shared_ptr<Document>& gltfDocument, bool pPretty = false);
+
+    // Writes the same manifest as above straight to the stream. The top-level arrays are written one element at a
+    // time, so only a single element's JSON is held in memory rather than a DOM and a string of the whole manifest.
+    static void Serialize(const Document& gltfDocument, std::ostream& stream, bool pPretty = false);
+
+    // As above with the elements of the top-level arrays rendered concurrently on the executor, in chunks of up to
+    // chunkSize elements, and then written in order. The output is identical to serial serialization.
+    static void Serialize(const Document& gltfDocument, std::ostream& stream, const IExecutor& executor, bool pPretty = false, size_t chunkSize = DefaultSerializationChunkSize);
 };
 }
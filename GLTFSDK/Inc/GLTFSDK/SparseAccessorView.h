@@ -0,0 +1,181 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/GLTF.h>
+
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // The substitutions of a sparse accessor as (index, value) pairs, without the dense array of accessor.count
+        // elements they are applied to. Elements that aren't substituted take their value from the base: the
+        // accessor's bufferView if it has one (see HasBase) and zero otherwise. Returned by
+        // GLTFResourceReader::ReadSparseAccessorView, indices are always widened to 32 bits.
+        template<typename T>
+        class SparseAccessorView
+        {
+        public:
+            struct Element
+            {
+                uint32_t            index;
+                std::span<const T>  value;
+            };
+
+            class Iterator
+            {
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = Element;
+                using difference_type = std::ptrdiff_t;
+                using pointer = void;
+                using reference = Element;
+
+                Iterator() = default;
+                Iterator(const SparseAccessorView* view, size_t position) : m_view(view), m_position(position)
+                {
+                }
+
+                Element operator*() const
+                {
+                    return (*m_view)[m_position];
+                }
+
+                Iterator& operator++()
+                {
+                    ++m_position;
+                    return *this;
+                }
+
+                Iterator operator++(int)
+                {
+                    Iterator result = *this;
+                    ++m_position;
+                    return result;
+                }
+
+                bool operator==(const Iterator& other) const
+                {
+                    return m_view == other.m_view && m_position == other.m_position;
+                }
+
+            private:
+                const SparseAccessorView* m_view = nullptr;
+                size_t m_position = 0U;
+            };
+
+            SparseAccessorView(const Accessor& accessor, std::vector<uint32_t> indices, std::vector<T> values) :
+                m_accessor(&accessor),
+                m_typeCount(Accessor::GetTypeCount(accessor.type)),
+                m_indices(std::move(indices)),
+                m_values(std::move(values))
+            {
+                if (m_values.size() != m_indices.size() * m_typeCount)
+                {
+                    throw GLTFException("The number of sparse values doesn't match the number of sparse indices of accessor " + accessor.id);
+                }
+
+                for (const auto index : m_indices)
+                {
+                    if (index >= accessor.count)
+                    {
+                        throw GLTFException("Sparse index " + std::to_string(index) + " is outside the range of accessor " + accessor.id);
+                    }
+                }
+            }
+
+            // The accessor the view was read from, it must outlive the view
+            const Accessor& GetAccessor() const
+            {
+                return *m_accessor;
+            }
+
+            // Whether the elements that aren't substituted come from the accessor's bufferView rather than being zero
+            bool HasBase() const
+            {
+                return !m_accessor->bufferViewId.empty();
+            }
+
+            // The number of substituted elements
+            size_t Size() const
+            {
+                return m_indices.size();
+            }
+
+            bool Empty() const
+            {
+                return m_indices.empty();
+            }
+
+            Element operator[](size_t position) const
+            {
+                return { m_indices[position], std::span<const T>(m_values).subspan(position * m_typeCount, m_typeCount) };
+            }
+
+            Iterator begin() const
+            {
+                return Iterator(this, 0U);
+            }
+
+            Iterator end() const
+            {
+                return Iterator(this, m_indices.size());
+            }
+
+            const std::vector<uint32_t>& GetIndices() const
+            {
+                return m_indices;
+            }
+
+            // The values of all the substituted elements, tightly packed in the same order as the indices
+            const std::vector<T>& GetValues() const
+            {
+                return m_values;
+            }
+
+            // Writes each substituted element's value to output, where the accessor's elements are outputByteStride
+            // bytes apart (zero means tightly packed), leaving the other elements untouched. The output must hold all
+            // accessor.count elements.
+            void Scatter(std::span<T> output, size_t outputByteStride = 0U) const
+            {
+                const size_t elementSize = sizeof(T) * m_typeCount;
+
+                if (outputByteStride == 0U)
+                {
+                    outputByteStride = elementSize;
+                }
+                else if (outputByteStride < elementSize)
+                {
+                    throw GLTFException("Output stride is smaller than the element size of accessor " + m_accessor->id);
+                }
+
+                if (m_accessor->count > 0U && (output.size_bytes() < elementSize || (m_accessor->count - 1U) > (output.size_bytes() - elementSize) / outputByteStride))
+                {
+                    throw GLTFException("Output buffer is too small for accessor " + m_accessor->id);
+                }
+
+                auto outputBytes = reinterpret_cast<uint8_t*>(output.data());
+
+                for (size_t i = 0U; i < m_indices.size(); ++i)
+                {
+                    std::memcpy(outputBytes + m_indices[i] * outputByteStride, m_values.data() + i * m_typeCount, elementSize);
+                }
+            }
+
+        private:
+            const Accessor* m_accessor;
+            size_t m_typeCount;
+
+            std::vector<uint32_t> m_indices;
+            std::vector<T> m_values;
+        };
+    }
+}
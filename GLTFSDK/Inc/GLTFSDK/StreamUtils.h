@@ -5,6 +5,8 @@
 
 #include <istream>
 #include <ostream>
+#include <stdexcept>
+#include <vector>
 
 namespace Microsoft
 {
@@ -0,0 +1,182 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/AccessorCache.h>
+
+#include <atomic>
+
+using namespace Microsoft::glTF;
+
+AccessorCache::AccessorCache(size_t byteBudget) :
+    m_byteBudget(byteBudget),
+    m_byteCount(0U),
+    m_hitCount(0U),
+    m_missCount(0U)
+{
+}
+
+AccessorCache::ReaderId AccessorCache::CreateReaderId()
+{
+    static std::atomic<ReaderId> nextReaderId = 0U;
+
+    return nextReaderId++;
+}
+
+std::shared_ptr<const void> AccessorCache::Get(ReaderId readerId, const Document& document, const Accessor& accessor, std::type_index type)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto itMap = m_entryMap.find({ readerId, &document, accessor.id, type });
+
+    if (itMap == m_entryMap.end() || itMap->second->accessor != accessor)
+    {
+        ++m_missCount;
+        return nullptr;
+    }
+
+    auto it = itMap->second;
+
+    // Ensure the returned entry is now the 'most recently used'
+    if (it != m_entries.begin())
+    {
+        m_entries.splice(m_entries.begin(), m_entries, it);
+    }
+
+    ++m_hitCount;
+    return it->data;
+}
+
+void AccessorCache::Set(ReaderId readerId, const Document& document, const Accessor& accessor, std::type_index type, std::shared_ptr<const void> data, size_t byteCount)
+{
+    Key key = { readerId, &document, accessor.id, type };
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto itMap = m_entryMap.find(key);
+
+    if (itMap != m_entryMap.end())
+    {
+        Erase(itMap->second);
+    }
+
+    if (byteCount <= m_byteBudget)
+    {
+        Evict(m_byteBudget - byteCount);
+
+        m_entries.push_front({ key, accessor, std::move(data), byteCount });
+        m_entryMap.emplace(std::move(key), m_entries.begin());
+        m_byteCount += byteCount;
+    }
+}
+
+void AccessorCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_entries.clear();
+    m_entryMap.clear();
+    m_byteCount = 0U;
+}
+
+void AccessorCache::Clear(const Document& document)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (auto it = m_entries.begin(); it != m_entries.end();)
+    {
+        auto itNext = std::next(it);
+
+        if (it->key.document == &document)
+        {
+            Erase(it);
+        }
+
+        it = itNext;
+    }
+}
+
+void AccessorCache::Clear(ReaderId readerId)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (auto it = m_entries.begin(); it != m_entries.end();)
+    {
+        auto itNext = std::next(it);
+
+        if (it->key.readerId == readerId)
+        {
+            Erase(it);
+        }
+
+        it = itNext;
+    }
+}
+
+void AccessorCache::SetByteBudget(size_t byteBudget)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_byteBudget = byteBudget;
+
+    Evict(byteBudget);
+}
+
+size_t AccessorCache::GetByteBudget() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_byteBudget;
+}
+
+size_t AccessorCache::GetByteCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_byteCount;
+}
+
+size_t AccessorCache::Size() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_entries.size();
+}
+
+size_t AccessorCache::GetHitCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_hitCount;
+}
+
+size_t AccessorCache::GetMissCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_missCount;
+}
+
+void AccessorCache::ResetCounters()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_hitCount = 0U;
+    m_missCount = 0U;
+}
+
+// Removes a single entry. Callers must hold m_mutex.
+void AccessorCache::Erase(EntryList::iterator it)
+{
+    m_byteCount -= it->byteCount;
+    m_entryMap.erase(it->key);
+    m_entries.erase(it);
+}
+
+// Removes least recently used entries until the cached data occupies no more than byteBudget bytes. Callers must hold m_mutex.
+void AccessorCache::Evict(size_t byteBudget)
+{
+    while (m_byteCount > byteBudget)
+    {
+        Erase(std::prev(m_entries.end()));
+    }
+}
@@ -8,118 +8,229 @@
 
 using namespace Microsoft::glTF;
 
-std::vector<float> AnimationUtils::GetKeyframeTimes(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
+namespace
 {
-    if (accessor.type != TYPE_SCALAR)
+    void ValidateKeyframeTimesAccessor(const Accessor& accessor)
+    {
+        if (accessor.type != TYPE_SCALAR)
+        {
+            throw GLTFException("Invalid type for animation input accessor " + accessor.id);
+        }
+
+        if (accessor.componentType != COMPONENT_FLOAT)
+        {
+            throw GLTFException("Invalid componentType for animation input accessor " + accessor.id);
+        }
+    }
+
+    void ValidateInverseBindMatricesAccessor(const Accessor& accessor)
     {
-        throw GLTFException("Invalid type for animation input accessor " + accessor.id);
+        if (accessor.type != TYPE_MAT4)
+        {
+            throw GLTFException("Invalid type for inverse bind matrices accessor " + accessor.id);
+        }
+
+        if (accessor.componentType != COMPONENT_FLOAT)
+        {
+            throw GLTFException("Invalid componentType for inverse bind matrices accessor " + accessor.id);
+        }
     }
 
-    if (accessor.componentType != COMPONENT_FLOAT)
+    void ValidateTranslationsAccessor(const Accessor& accessor)
     {
-        throw GLTFException("Invalid componentType for animation input accessor " + accessor.id);
+        if (accessor.type != TYPE_VEC3)
+        {
+            throw GLTFException("Invalid type for translations accessor " + accessor.id);
+        }
+
+        if (accessor.componentType != COMPONENT_FLOAT)
+        {
+            throw GLTFException("Invalid componentType for translations accessor " + accessor.id);
+        }
     }
 
+    void ValidateRotationsAccessor(const Accessor& accessor)
+    {
+        if (accessor.type != TYPE_VEC4)
+        {
+            throw GLTFException("Invalid type for rotations accessor " + accessor.id);
+        }
+    }
+
+    void ValidateScalesAccessor(const Accessor& accessor)
+    {
+        if (accessor.type != TYPE_VEC3)
+        {
+            throw GLTFException("Invalid type for scales accessor " + accessor.id);
+        }
+
+        if (accessor.componentType != COMPONENT_FLOAT)
+        {
+            throw GLTFException("Invalid componentType for scales accessor " + accessor.id);
+        }
+    }
+
+    void ValidateMorphWeightsAccessor(const Accessor& accessor)
+    {
+        if (accessor.type != TYPE_SCALAR)
+        {
+            throw GLTFException("Invalid type for weights accessor " + accessor.id);
+        }
+    }
+}
+
+std::vector<float> AnimationUtils::GetKeyframeTimes(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
+{
+    ValidateKeyframeTimesAccessor(accessor);
+
     return reader.ReadBinaryData<float>(doc, accessor);
 }
 
+void AnimationUtils::GetKeyframeTimesInto(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, std::span<float> output)
+{
+    ValidateKeyframeTimesAccessor(accessor);
+
+    reader.ReadBinaryData<float>(doc, accessor, output);
+}
+
 std::vector<float> AnimationUtils::GetKeyframeTimes(const Document& doc, const GLTFResourceReader& reader, const AnimationSampler& sampler)
 {
     auto& accessor = doc.accessors[sampler.inputAccessorId];
     return GetKeyframeTimes(doc, reader, accessor);
 }
 
-std::vector<float> AnimationUtils::GetInverseBindMatrices(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
+void AnimationUtils::GetKeyframeTimesInto(const Document& doc, const GLTFResourceReader& reader, const AnimationSampler& sampler, std::span<float> output)
 {
-    if (accessor.type != TYPE_MAT4)
-    {
-        throw GLTFException("Invalid type for inverse bind matrices accessor " + accessor.id);
-    }
+    auto& accessor = doc.accessors[sampler.inputAccessorId];
+    GetKeyframeTimesInto(doc, reader, accessor, output);
+}
 
-    if (accessor.componentType != COMPONENT_FLOAT)
-    {
-        throw GLTFException("Invalid componentType for inverse bind matrices accessor " + accessor.id);
-    }
+std::vector<float> AnimationUtils::GetInverseBindMatrices(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
+{
+    ValidateInverseBindMatricesAccessor(accessor);
 
     return reader.ReadBinaryData<float>(doc, accessor);
 }
 
+void AnimationUtils::GetInverseBindMatricesInto(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, std::span<float> output)
+{
+    ValidateInverseBindMatricesAccessor(accessor);
+
+    reader.ReadBinaryData<float>(doc, accessor, output);
+}
+
 std::vector<float> AnimationUtils::GetInverseBindMatrices(const Document& doc, const GLTFResourceReader& reader, const Skin& skin)
 {
     auto& accessor = doc.accessors[skin.inverseBindMatricesAccessorId];
     return GetInverseBindMatrices(doc, reader, accessor);
 }
 
-std::vector<float> AnimationUtils::GetTranslations(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
+void AnimationUtils::GetInverseBindMatricesInto(const Document& doc, const GLTFResourceReader& reader, const Skin& skin, std::span<float> output)
 {
-    if (accessor.type != TYPE_VEC3)
-    {
-        throw GLTFException("Invalid type for translations accessor " + accessor.id);
-    }
+    auto& accessor = doc.accessors[skin.inverseBindMatricesAccessorId];
+    GetInverseBindMatricesInto(doc, reader, accessor, output);
+}
 
-    if (accessor.componentType != COMPONENT_FLOAT)
-    {
-        throw GLTFException("Invalid componentType for translations accessor " + accessor.id);
-    }
+std::vector<float> AnimationUtils::GetTranslations(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
+{
+    ValidateTranslationsAccessor(accessor);
 
     return reader.ReadBinaryData<float>(doc, accessor);
 }
 
+void AnimationUtils::GetTranslationsInto(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, std::span<float> output)
+{
+    ValidateTranslationsAccessor(accessor);
+
+    reader.ReadBinaryData<float>(doc, accessor, output);
+}
+
 std::vector<float> AnimationUtils::GetTranslations(const Document& doc, const GLTFResourceReader& reader, const AnimationSampler& sampler)
 {
     auto& accessor = doc.accessors[sampler.outputAccessorId];
     return GetTranslations(doc, reader, accessor);
 }
 
+void AnimationUtils::GetTranslationsInto(const Document& doc, const GLTFResourceReader& reader, const AnimationSampler& sampler, std::span<float> output)
+{
+    auto& accessor = doc.accessors[sampler.outputAccessorId];
+    GetTranslationsInto(doc, reader, accessor, output);
+}
+
 std::vector<float> AnimationUtils::GetRotations(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
 {
-    if (accessor.type != TYPE_VEC4)
-    {
-        throw GLTFException("Invalid type for rotations accessor " + accessor.id);
-    }
+    ValidateRotationsAccessor(accessor);
 
     return reader.ReadFloatData(doc, accessor);
 }
 
+void AnimationUtils::GetRotationsInto(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, std::span<float> output)
+{
+    ValidateRotationsAccessor(accessor);
+
+    reader.ReadFloatData(doc, accessor, output);
+}
+
 std::vector<float> AnimationUtils::GetRotations(const Document& doc, const GLTFResourceReader& reader, const AnimationSampler& sampler)
 {
     auto& accessor = doc.accessors[sampler.outputAccessorId];
     return GetRotations(doc, reader, accessor);
 }
 
-std::vector<float> AnimationUtils::GetScales(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
+void AnimationUtils::GetRotationsInto(const Document& doc, const GLTFResourceReader& reader, const AnimationSampler& sampler, std::span<float> output)
 {
-    if (accessor.type != TYPE_VEC3)
-    {
-        throw GLTFException("Invalid type for scales accessor " + accessor.id);
-    }
+    auto& accessor = doc.accessors[sampler.outputAccessorId];
+    GetRotationsInto(doc, reader, accessor, output);
+}
 
-    if (accessor.componentType != COMPONENT_FLOAT)
-    {
-        throw GLTFException("Invalid componentType for scales accessor " + accessor.id);
-    }
+std::vector<float> AnimationUtils::GetScales(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
+{
+    ValidateScalesAccessor(accessor);
 
     return reader.ReadBinaryData<float>(doc, accessor);
 }
 
+void AnimationUtils::GetScalesInto(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, std::span<float> output)
+{
+    ValidateScalesAccessor(accessor);
+
+    reader.ReadBinaryData<float>(doc, accessor, output);
+}
+
 std::vector<float> AnimationUtils::GetScales(const Document& doc, const GLTFResourceReader& reader, const AnimationSampler& sampler)
 {
     auto& accessor = doc.accessors[sampler.outputAccessorId];
     return GetScales(doc, reader, accessor);
 }
 
+void AnimationUtils::GetScalesInto(const Document& doc, const GLTFResourceReader& reader, const AnimationSampler& sampler, std::span<float> output)
+{
+    auto& accessor = doc.accessors[sampler.outputAccessorId];
+    GetScalesInto(doc, reader, accessor, output);
+}
+
 std::vector<float> AnimationUtils::GetMorphWeights(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
 {
-    if (accessor.type != TYPE_SCALAR)
-    {
-        throw GLTFException("Invalid type for weights accessor " + accessor.id);
-    }
+    ValidateMorphWeightsAccessor(accessor);
 
     return reader.ReadFloatData(doc, accessor);
 }
 
+void AnimationUtils::GetMorphWeightsInto(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, std::span<float> output)
+{
+    ValidateMorphWeightsAccessor(accessor);
+
+    reader.ReadFloatData(doc, accessor, output);
+}
+
 std::vector<float> AnimationUtils::GetMorphWeights(const Document& doc, const GLTFResourceReader& reader, const AnimationSampler& sampler)
 {
     auto& accessor = doc.accessors[sampler.outputAccessorId];
     return GetMorphWeights(doc, reader, accessor);
 }
+
+void AnimationUtils::GetMorphWeightsInto(const Document& doc, const GLTFResourceReader& reader, const AnimationSampler& sampler, std::span<float> output)
+{
+    auto& accessor = doc.accessors[sampler.outputAccessorId];
+    GetMorphWeightsInto(doc, reader, accessor, output);
+}
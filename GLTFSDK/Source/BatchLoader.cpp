@@ -0,0 +1,198 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/BatchLoader.h>
+
+#include <GLTFSDK/Constants.h>
+#include <GLTFSDK/Exceptions.h>
+#include <GLTFSDK/GLBResourceReader.h>
+
+#include <chrono>
+#include <cstring>
+#include <sstream>
+
+using namespace Microsoft::glTF;
+
+namespace
+{
+    // GLB assets are recognized by the magic string at the start of their header rather than by file extension
+    bool IsGLB(std::istream& stream)
+    {
+        char magic[GLB_HEADER_MAGIC_STRING_SIZE] = {};
+
+        const auto position = stream.tellg();
+        stream.read(magic, GLB_HEADER_MAGIC_STRING_SIZE);
+
+        const bool isGLB = stream.gcount() == GLB_HEADER_MAGIC_STRING_SIZE && std::memcmp(magic, GLB_HEADER_MAGIC_STRING, GLB_HEADER_MAGIC_STRING_SIZE) == 0;
+
+        stream.clear();
+        stream.seekg(position);
+
+        return isGLB;
+    }
+
+    double GetMilliseconds(std::chrono::steady_clock::time_point begin)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+    }
+}
+
+double BatchLoadStats::GetAssetsPerSecond() const
+{
+    return milliseconds > 0.0 ? static_cast<double>(assetCount) / (milliseconds / 1000.0) : 0.0;
+}
+
+double BatchLoadStats::GetManifestMegabytesPerSecond() const
+{
+    return milliseconds > 0.0 ? (static_cast<double>(manifestByteCount) / (1024.0 * 1024.0)) / (milliseconds / 1000.0) : 0.0;
+}
+
+BatchLoader::BatchLoader(StreamReaderFactory streamReaderFactory, BatchLoaderOptions options) :
+    m_streamReaderFactory(std::move(streamReaderFactory)),
+    m_options(std::move(options))
+{
+    if (!m_streamReaderFactory)
+    {
+        throw GLTFException("BatchLoader requires a stream reader factory");
+    }
+}
+
+std::vector<BatchLoadResult> BatchLoader::Load(const std::vector<BatchAsset>& assets) const
+{
+    return Load(assets, ThreadExecutor(m_options.threadCount));
+}
+
+std::vector<BatchLoadResult> BatchLoader::Load(const std::vector<BatchAsset>& assets, const IExecutor& executor) const
+{
+    const auto begin = std::chrono::steady_clock::now();
+
+    std::vector<BatchLoadResult> results(assets.size());
+
+    executor.ParallelFor(assets.size(), [&](size_t i)
+    {
+        results[i].asset = assets[i];
+        LoadAsset(results[i]);
+    });
+
+    BatchLoadStats stats;
+
+    for (const auto& result : results)
+    {
+        stats.failureCount += result.IsSuccess() ? 0U : 1U;
+        stats.manifestByteCount += result.manifestByteCount;
+        stats.decodedByteCount += result.decodedByteCount;
+    }
+
+    stats.assetCount = results.size();
+    stats.milliseconds = GetMilliseconds(begin);
+
+    std::lock_guard<std::mutex> lock(m_statsMutex);
+
+    m_stats.assetCount += stats.assetCount;
+    m_stats.failureCount += stats.failureCount;
+    m_stats.manifestByteCount += stats.manifestByteCount;
+    m_stats.decodedByteCount += stats.decodedByteCount;
+    m_stats.milliseconds += stats.milliseconds;
+
+    return results;
+}
+
+BatchLoadResult BatchLoader::Load(const BatchAsset& asset) const
+{
+    return std::move(Load(std::vector<BatchAsset>{ asset }, SequentialExecutor()).front());
+}
+
+BatchLoadStats BatchLoader::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(m_statsMutex);
+
+    return m_stats;
+}
+
+void BatchLoader::ResetStats()
+{
+    std::lock_guard<std::mutex> lock(m_statsMutex);
+
+    m_stats = {};
+}
+
+// Never throws, any exception is stored in the result
+void BatchLoader::LoadAsset(BatchLoadResult& result) const
+{
+    const auto begin = std::chrono::steady_clock::now();
+
+    try
+    {
+        auto streamReader = m_streamReaderFactory(result.asset.root);
+
+        if (!streamReader)
+        {
+            throw GLTFException("No stream reader was created for asset root " + result.asset.root);
+        }
+
+        auto stream = streamReader->GetInputStream(result.asset.manifest);
+
+        if (!stream || stream->fail())
+        {
+            throw GLTFException("Unable to open manifest " + result.asset.manifest);
+        }
+
+        if (IsGLB(*stream))
+        {
+            auto glbResourceReader = std::make_shared<GLBResourceReader>(std::move(streamReader), std::move(stream));
+
+            const auto json = glbResourceReader->GetJsonChunk();
+
+            result.manifestByteCount = json.size();
+            result.document = Deserializer::Deserialize(json, m_options.deserializeOptions, m_options.extensionDeserializer);
+            result.resourceReader = std::move(glbResourceReader);
+        }
+        else
+        {
+            std::stringstream manifestStream;
+            manifestStream << stream->rdbuf();
+
+            // Parsed in place, without copying the manifest out of the stream
+            const auto json = manifestStream.view();
+
+            result.manifestByteCount = json.size();
+            result.document = Deserializer::Deserialize(json, m_options.deserializeOptions, m_options.extensionDeserializer);
+            result.resourceReader = std::make_shared<GLTFResourceReader>(std::move(streamReader));
+        }
+
+        if (m_options.decodeAccessors)
+        {
+            for (const auto& accessor : result.document->accessors.Elements())
+            {
+                result.accessors.emplace_back(accessor);
+            }
+
+            result.resourceReader->ReadAccessors(*result.document, result.accessors);
+
+            for (const auto& request : result.accessors)
+            {
+                result.decodedByteCount += request.data.size();
+            }
+        }
+    }
+    catch (const std::exception& ex)
+    {
+        result.exception = std::current_exception();
+        result.error = ex.what();
+    }
+    catch (...)
+    {
+        result.exception = std::current_exception();
+        result.error = "Unknown error";
+    }
+
+    if (result.exception)
+    {
+        result.document.reset();
+        result.resourceReader.reset();
+        result.accessors.clear();
+        result.decodedByteCount = 0U;
+    }
+
+    result.milliseconds = GetMilliseconds(begin);
+}
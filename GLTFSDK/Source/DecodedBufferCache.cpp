@@ -0,0 +1,129 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/DecodedBufferCache.h>
+
+#include <string_view>
+
+using namespace Microsoft::glTF;
+
+DecodedBufferCache::DecodedBufferCache(size_t byteBudget) :
+    m_byteBudget(byteBudget),
+    m_byteCount(0U)
+{
+}
+
+DecodedBufferCache::Data DecodedBufferCache::Get(const Buffer& buffer)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto itMap = m_entryMap.find(buffer.id);
+
+    if (itMap == m_entryMap.end())
+    {
+        return nullptr;
+    }
+
+    auto it = itMap->second;
+
+    if (!(it->fingerprint == GetFingerprint(buffer.uri)))
+    {
+        return nullptr;
+    }
+
+    // Ensure the returned entry is now the 'most recently used'
+    if (it != m_entries.begin())
+    {
+        m_entries.splice(m_entries.begin(), m_entries, it);
+    }
+
+    return it->data;
+}
+
+DecodedBufferCache::Data DecodedBufferCache::Set(const Buffer& buffer, std::vector<uint8_t> data)
+{
+    auto sharedData = std::make_shared<const std::vector<uint8_t>>(std::move(data));
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto itMap = m_entryMap.find(buffer.id);
+
+    if (itMap != m_entryMap.end())
+    {
+        m_byteCount -= itMap->second->GetByteCount();
+        m_entries.erase(itMap->second);
+        m_entryMap.erase(itMap);
+    }
+
+    const size_t byteCount = sharedData->size();
+
+    if (byteCount <= m_byteBudget)
+    {
+        Evict(m_byteBudget - byteCount);
+
+        m_entries.push_front({ buffer.id, GetFingerprint(buffer.uri), sharedData });
+        m_entryMap.emplace(buffer.id, m_entries.begin());
+        m_byteCount += byteCount;
+    }
+
+    return sharedData;
+}
+
+void DecodedBufferCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_entries.clear();
+    m_entryMap.clear();
+    m_byteCount = 0U;
+}
+
+void DecodedBufferCache::SetByteBudget(size_t byteBudget)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_byteBudget = byteBudget;
+
+    Evict(byteBudget);
+}
+
+size_t DecodedBufferCache::GetByteBudget() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_byteBudget;
+}
+
+size_t DecodedBufferCache::GetByteCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_byteCount;
+}
+
+size_t DecodedBufferCache::Size() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_entries.size();
+}
+
+// Removes least recently used entries until the cached data occupies no more than byteBudget bytes. Callers must hold m_mutex.
+void DecodedBufferCache::Evict(size_t byteBudget)
+{
+    while (m_byteCount > byteBudget)
+    {
+        const Entry& entry = m_entries.back();
+
+        m_byteCount -= entry.GetByteCount();
+        m_entryMap.erase(entry.bufferId);
+        m_entries.pop_back();
+    }
+}
+
+// Hashes every character of the uri: a data URI's decoded bytes depend on all of it, so sampling would let two uris
+// that differ only between the samples share an entry. Hashing is still far cheaper than the base64 decode it saves.
+DecodedBufferCache::UriFingerprint DecodedBufferCache::GetFingerprint(std::string_view uri)
+{
+    return { uri.size(), std::hash<std::string_view>()(uri) };
+}
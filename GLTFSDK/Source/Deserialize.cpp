@@ -7,19 +7,1081 @@
 #include <GLTFSDK/GLTF.h>
 #include <GLTFSDK/SchemaValidation.h>
 
+#include "TopLevelArrays.h"
+
+#include <charconv>
+#include <cstring>
+#include <iterator>
+#include <span>
+#include <sstream>
+#include <string_view>
+
 using namespace Microsoft::glTF;
 
+namespace {
+// A top-level array of the manifest whose elements are deserialized one at a time by DeserializeStreaming
+struct ElementArray : Detail::TopLevelArrayInfo {
+    void (*deserializeElement)(Document& document, const nlohmann::json& json);
+    void (*deserializeDeferred)(Document& document, std::function<nlohmann::json()> loadElements);
+    void (*clear)(Document& document);
+};
+
+template<size_t I>
+auto& GetContainer(Document& document) {
+    return document.*std::get<I>(Detail::c_topLevelArrays).container;
+}
+
+template<size_t I>
+void DeserializeElement(Document& document, const nlohmann::json& json) {
+    GetContainer<I>(document).deserializeElement(json);
+}
+
+template<size_t I>
+void DeserializeDeferred(Document& document, std::function<nlohmann::json()> loadElements) {
+    GetContainer<I>(document).deserializeDeferred(std::move(loadElements));
+}
+
+template<size_t I>
+void ClearElements(Document& document) {
+    GetContainer<I>(document).Clear();
+}
+
+constexpr auto c_elementArrays = Detail::MakeTopLevelArrayTable<ElementArray>([](auto i) -> ElementArray {
+    return {std::get<i>(Detail::c_topLevelArrays), &DeserializeElement<i>, &DeserializeDeferred<i>, &ClearElements<i>};
+});
+
+size_t IndexOf(const ElementArray& array) {
+    return static_cast<size_t>(&array - c_elementArrays.data());
+}
+
+// The flags disabling the schemas of all the top-level array elements. The elements have already been validated
+// individually by DeserializeStreaming, so the root schema only needs to check what remains of the manifest.
+SchemaFlags GetElementSchemaFlags() {
+    SchemaFlags schemaFlags = SchemaFlags::None;
+
+    for (const auto& elementArray : c_elementArrays) {
+        schemaFlags |= elementArray.schemaFlag;
+    }
+
+    return schemaFlags;
+}
+
+const ElementArray* FindElementArray(const std::string& name) {
+    for (const auto& array : c_elementArrays) {
+        if (name == array.name) return &array;
+    }
+
+    return nullptr;
+}
+
+// Builds the DOM of a value from SAX events the same way nlohmann's own DOM parser does
+class ValueBuilder {
+public:
+    // The number of containers that are open
+    size_t Depth() const { return stack.size(); }
+
+    bool IsBuilding() const { return !stack.empty(); }
+
+    nlohmann::json& Result() { return result; }
+
+    // Returns true if the value is complete
+    template<typename Value>
+    bool Add(Value&& value) {
+        Insert(std::forward<Value>(value));
+        return stack.empty();
+    }
+
+    void Start(nlohmann::json::value_t type) { stack.push_back(Insert(type)); }
+
+    void Key(const std::string& key) { objectValue = &(*stack.back())[key]; }
+
+    // Returns true if the value is complete
+    bool End() {
+        stack.pop_back();
+        return stack.empty();
+    }
+
+private:
+    template<typename Value>
+    nlohmann::json* Insert(Value&& value) {
+        if (stack.empty()) {
+            result = nlohmann::json(std::forward<Value>(value));
+            return &result;
+        }
+
+        if (auto parent = stack.back(); parent->is_array()) {
+            parent->emplace_back(std::forward<Value>(value));
+            return &parent->back();
+        }
+
+        *objectValue = nlohmann::json(std::forward<Value>(value));
+        return objectValue;
+    }
+
+    nlohmann::json result;
+    std::vector<nlohmann::json*> stack;
+    nlohmann::json* objectValue = nullptr;
+};
+
+// Reads accessors, meshes and nodes straight from SAX events into the document, without building a DOM of them.
+// Members are converted with the same get<T>() calls as the elements' from_json, applied to a json holding just the
+// scalar, which doesn't allocate for numbers. Extensions, extras, sparse accessors, morph targets and any value that
+// doesn't have the expected shape are built as a DOM of their own and converted as from_json would, so the elements
+// match those read by Deserialize. Unknown members are skipped without being built.
+class ElementReader {
+public:
+    explicit ElementReader(Document& document) : document(document) {}
+
+    bool IsReading() const { return !levels.empty(); }
+
+    // Starts reading an element of the array, which must be an object, if its type is one that is read directly
+    bool Start(const ElementArray& array) {
+        Frame frame;
+
+        switch (array.collection) {
+        case DocumentCollections::Accessors:
+            accessor = Accessor();
+            frame = Frame::Accessor;
+            break;
+        case DocumentCollections::Meshes:
+            mesh = Mesh();
+            frame = Frame::Mesh;
+            break;
+        case DocumentCollections::Nodes:
+            node = Node();
+            frame = Frame::Node;
+            break;
+        default:
+            return false;
+        }
+
+        hasComponentType = hasCount = hasType = hasPrimitives = hasMatrix = false;
+        levels.push_back({frame});
+        return true;
+    }
+
+    void StartObject() {
+        if (!value.IsBuilding()) {
+            const auto& level = levels.back();
+
+            if (level.frame == Frame::Primitives) {
+                mesh.primitives.emplace_back();
+                levels.push_back({Frame::Primitive});
+                return;
+            }
+
+            if (level.frame == Frame::Primitive && level.member == Member::Attributes) {
+                mesh.primitives.back().attributes.clear();
+                levels.push_back({Frame::Attributes});
+                return;
+            }
+
+            if (IsSkipped(level)) {
+                levels.push_back({Frame::Skip});
+                return;
+            }
+        }
+
+        value.Start(nlohmann::json::value_t::object);
+    }
+
+    void StartArray() {
+        if (!value.IsBuilding()) {
+            const auto& level = levels.back();
+
+            if (IsSkipped(level)) {
+                levels.push_back({Frame::Skip});
+                return;
+            }
+
+            if (IsObject(level.frame)) {
+                switch (level.member) {
+                case Member::Max:
+                case Member::Min:
+                case Member::Weights:
+                    Floats(level.member).clear();
+                    levels.push_back({Frame::Floats, level.member});
+                    return;
+                case Member::Matrix:
+                    hasMatrix = true;
+                    [[fallthrough]];
+                case Member::Rotation:
+                case Member::Scale:
+                case Member::Translation:
+                    levels.push_back({Frame::FixedFloats, level.member});
+                    return;
+                case Member::Children:
+                    node.children.clear();
+                    levels.push_back({Frame::Children, level.member});
+                    return;
+                case Member::Primitives:
+                    mesh.primitives.clear();
+                    hasPrimitives = true;
+                    levels.push_back({Frame::Primitives, level.member});
+                    return;
+                default:
+                    break;
+                }
+            }
+        }
+
+        value.Start(nlohmann::json::value_t::array);
+    }
+
+    void Key(std::string& key) {
+        if (value.IsBuilding()) {
+            value.Key(key);
+            return;
+        }
+
+        auto& level = levels.back();
+
+        if (level.frame == Frame::Attributes) attributeName = std::move(key);
+        else if (level.frame != Frame::Skip) level.member = FindMember(level.frame, key);
+    }
+
+    void String(std::string& string) {
+        if (!value.IsBuilding() && IsObject(levels.back().frame)) {
+            switch (levels.back().member) {
+            case Member::Name:
+                Element().name = std::move(string);
+                return;
+            case Member::Type:
+                accessor.type = Accessor::ParseType(string);
+                hasType = true;
+                return;
+            default:
+                break;
+            }
+        }
+
+        Value(nlohmann::json(std::move(string)));
+    }
+
+    void Value(nlohmann::json&& json) {
+        if (value.IsBuilding()) value.Add(std::move(json));
+        else Set(std::move(json));
+    }
+
+    // Returns true once the element is complete and has been appended to the document
+    bool End() {
+        if (value.IsBuilding()) {
+            if (value.End()) Set(std::move(value.Result()));
+            return false;
+        }
+
+        const Level level = levels.back();
+        levels.pop_back();
+
+        switch (level.frame) {
+        case Frame::FixedFloats:
+            // Throws the same out_of_range as get_to does for too short an array
+            if (level.count < FixedSize(level.member)) static_cast<void>(nlohmann::json::array().at(level.count));
+            return false;
+        case Frame::Accessor:
+        case Frame::Mesh:
+        case Frame::Node:
+            Append(level.frame);
+            return true;
+        default:
+            return false;
+        }
+    }
+
+private:
+    enum class Frame : uint8_t {
+        Accessor,
+        Mesh,
+        Node,
+        Primitive,
+        Attributes,
+        Primitives,
+        Children,
+        Floats,
+        FixedFloats,
+        Skip
+    };
+
+    enum class Member : uint8_t {
+        Unknown,
+        Extensions,
+        Extras,
+        Name,
+        BufferView,
+        ByteOffset,
+        ComponentType,
+        Count,
+        Max,
+        Min,
+        Normalized,
+        Sparse,
+        Type,
+        Primitives,
+        Weights,
+        Camera,
+        Children,
+        Matrix,
+        Mesh,
+        Rotation,
+        Scale,
+        Skin,
+        Translation,
+        Attributes,
+        Indices,
+        Material,
+        Mode,
+        Targets
+    };
+
+    struct Level {
+        Frame frame;
+        Member member = Member::Unknown; // The member whose value is next, or the one an array belongs to
+        size_t count = 0U;               // The number of elements of a FixedFloats array read so far
+    };
+
+    struct MemberName {
+        std::string_view name;
+        Member member;
+    };
+
+    static constexpr MemberName c_accessorMembers[] = {
+        {"bufferView", Member::BufferView}, {"byteOffset", Member::ByteOffset}, {"componentType", Member::ComponentType},
+        {"count", Member::Count}, {"type", Member::Type}, {"max", Member::Max}, {"min", Member::Min},
+        {"normalized", Member::Normalized}, {"sparse", Member::Sparse}, {"name", Member::Name},
+        {"extensions", Member::Extensions}, {"extras", Member::Extras}};
+
+    static constexpr MemberName c_meshMembers[] = {
+        {"primitives", Member::Primitives}, {"weights", Member::Weights}, {"name", Member::Name},
+        {"extensions", Member::Extensions}, {"extras", Member::Extras}};
+
+    static constexpr MemberName c_nodeMembers[] = {
+        {"children", Member::Children}, {"mesh", Member::Mesh}, {"matrix", Member::Matrix},
+        {"rotation", Member::Rotation}, {"scale", Member::Scale}, {"translation", Member::Translation},
+        {"camera", Member::Camera}, {"skin", Member::Skin}, {"weights", Member::Weights}, {"name", Member::Name},
+        {"extensions", Member::Extensions}, {"extras", Member::Extras}};
+
+    static constexpr MemberName c_primitiveMembers[] = {
+        {"attributes", Member::Attributes}, {"indices", Member::Indices}, {"material", Member::Material},
+        {"mode", Member::Mode}, {"targets", Member::Targets}, {"extensions", Member::Extensions},
+        {"extras", Member::Extras}};
+
+    static Member FindMember(Frame frame, std::string_view key) {
+        std::span<const MemberName> names;
+
+        switch (frame) {
+        case Frame::Accessor: names = c_accessorMembers; break;
+        case Frame::Mesh: names = c_meshMembers; break;
+        case Frame::Node: names = c_nodeMembers; break;
+        case Frame::Primitive: names = c_primitiveMembers; break;
+        default: break;
+        }
+
+        for (const auto& name : names) {
+            if (name.name == key) return name.member;
+        }
+
+        return Member::Unknown;
+    }
+
+    static bool IsObject(Frame frame) {
+        return frame == Frame::Accessor || frame == Frame::Mesh || frame == Frame::Node || frame == Frame::Primitive;
+    }
+
+    static bool IsSkipped(const Level& level) {
+        return level.frame == Frame::Skip || (IsObject(level.frame) && level.member == Member::Unknown);
+    }
+
+    static size_t FixedSize(Member member) {
+        switch (member) {
+        case Member::Matrix: return 16U;
+        case Member::Rotation: return 4U;
+        default: return 3U;
+        }
+    }
+
+    glTFChildOfRootProperty& Element() {
+        switch (levels.front().frame) {
+        case Frame::Accessor: return accessor;
+        case Frame::Mesh: return mesh;
+        default: return node;
+        }
+    }
+
+    std::vector<float>& Floats(Member member) {
+        switch (member) {
+        case Member::Max: return accessor.max;
+        case Member::Min: return accessor.min;
+        default: return levels.front().frame == Frame::Mesh ? mesh.weights : node.weights;
+        }
+    }
+
+    float& FixedFloat(Member member, size_t index) {
+        switch (member) {
+        case Member::Matrix:
+            return node.matrix.values[index];
+        case Member::Rotation:
+            return index == 0U ? node.rotation.x : index == 1U ? node.rotation.y : index == 2U ? node.rotation.z : node.rotation.w;
+        default: {
+            auto& vector = (member == Member::Scale) ? node.scale : node.translation;
+            return index == 0U ? vector.x : index == 1U ? vector.y : vector.z;
+        }
+        }
+    }
+
+    // Sets the value of the innermost object's current member, or appends it to the innermost array
+    void Set(nlohmann::json&& json) {
+        auto& level = levels.back();
+
+        switch (level.frame) {
+        case Frame::Accessor:
+            SetAccessorMember(level.member, std::move(json));
+            break;
+        case Frame::Mesh:
+            SetMeshMember(level.member, std::move(json));
+            break;
+        case Frame::Node:
+            SetNodeMember(level.member, std::move(json));
+            break;
+        case Frame::Primitive:
+            SetPrimitiveMember(level.member, std::move(json));
+            break;
+        case Frame::Attributes:
+            mesh.primitives.back().attributes[attributeName] = std::to_string(json.get<uint32_t>());
+            break;
+        case Frame::Primitives:
+            mesh.primitives.push_back(json.get<MeshPrimitive>());
+            break;
+        case Frame::Children:
+            node.children.push_back(std::to_string(json.get<uint32_t>()));
+            break;
+        case Frame::Floats:
+            Floats(level.member).push_back(json.get<float>());
+            break;
+        case Frame::FixedFloats:
+            // As with get_to, elements past the end are ignored
+            if (level.count < FixedSize(level.member)) FixedFloat(level.member, level.count) = json.get<float>();
+            ++level.count;
+            break;
+        case Frame::Skip:
+            break;
+        }
+    }
+
+    static void SetPropertyMember(glTFProperty& property, Member member, nlohmann::json&& json) {
+        switch (member) {
+        case Member::Extensions:
+            // As with the DOM parser the last of any duplicate keys wins
+            property.extensions.clear();
+
+            for (auto& entry : json.items()) {
+                property.extensions.emplace(entry.key(), std::move(entry.value()));
+            }
+            break;
+        case Member::Extras:
+            property.extras = json.dump();
+            break;
+        default:
+            break;
+        }
+    }
+
+    static void SetChildOfRootMember(glTFChildOfRootProperty& property, Member member, nlohmann::json&& json) {
+        if (member == Member::Name) property.name = json.get<std::string>();
+        else SetPropertyMember(property, member, std::move(json));
+    }
+
+    void SetAccessorMember(Member member, nlohmann::json&& json) {
+        switch (member) {
+        case Member::BufferView:
+            accessor.bufferViewId = std::to_string(json.get<uint32_t>());
+            break;
+        case Member::ByteOffset:
+            accessor.byteOffset = static_cast<size_t>(json.get<int>());
+            break;
+        case Member::ComponentType:
+            accessor.componentType = Accessor::GetComponentType(static_cast<uint32_t>(json.get<size_t>()));
+            hasComponentType = true;
+            break;
+        case Member::Count:
+            accessor.count = json.get<size_t>();
+            hasCount = true;
+            break;
+        case Member::Type:
+            accessor.type = Accessor::ParseType(json.get<std::string>());
+            hasType = true;
+            break;
+        case Member::Max:
+            json.get_to(accessor.max);
+            break;
+        case Member::Min:
+            json.get_to(accessor.min);
+            break;
+        case Member::Normalized:
+            accessor.normalized = json.get<bool>();
+            break;
+        case Member::Sparse:
+            json.get_to(accessor.sparse);
+            break;
+        default:
+            SetChildOfRootMember(accessor, member, std::move(json));
+            break;
+        }
+    }
+
+    void SetMeshMember(Member member, nlohmann::json&& json) {
+        switch (member) {
+        case Member::Primitives:
+            json.get_to(mesh.primitives);
+            hasPrimitives = true;
+            break;
+        case Member::Weights:
+            json.get_to(mesh.weights);
+            break;
+        default:
+            SetChildOfRootMember(mesh, member, std::move(json));
+            break;
+        }
+    }
+
+    void SetNodeMember(Member member, nlohmann::json&& json) {
+        switch (member) {
+        case Member::Children: {
+            std::vector<uint32_t> children;
+            json.get_to(children);
+
+            node.children.clear();
+            node.children.reserve(children.size());
+            for (uint32_t child : children) node.children.push_back(std::to_string(child));
+            break;
+        }
+        case Member::Mesh:
+            node.meshId = std::to_string(json.get<uint32_t>());
+            break;
+        case Member::Skin:
+            node.skinId = std::to_string(json.get<uint32_t>());
+            break;
+        case Member::Camera:
+            node.cameraId = std::to_string(json.get<uint32_t>());
+            break;
+        case Member::Matrix:
+            json.get_to(node.matrix);
+            hasMatrix = true;
+            break;
+        case Member::Rotation:
+            json.get_to(node.rotation);
+            break;
+        case Member::Scale:
+            json.get_to(node.scale);
+            break;
+        case Member::Translation:
+            json.get_to(node.translation);
+            break;
+        case Member::Weights:
+            json.get_to(node.weights);
+            break;
+        default:
+            SetChildOfRootMember(node, member, std::move(json));
+            break;
+        }
+    }
+
+    void SetPrimitiveMember(Member member, nlohmann::json&& json) {
+        auto& primitive = mesh.primitives.back();
+
+        switch (member) {
+        case Member::Attributes:
+            primitive.attributes.clear();
+
+            for (const auto& attribute : json.items()) {
+                primitive.attributes[attribute.key()] = std::to_string(attribute.value().get<uint32_t>());
+            }
+            break;
+        case Member::Indices:
+            primitive.indicesAccessorId = std::to_string(json.get<uint32_t>());
+            break;
+        case Member::Material:
+            primitive.materialId = std::to_string(json.get<uint32_t>());
+            break;
+        case Member::Mode:
+            primitive.mode = static_cast<MeshMode>(json.get<int>());
+            break;
+        case Member::Targets:
+            json.get_to(primitive.targets);
+            break;
+        default:
+            SetPropertyMember(primitive, member, std::move(json));
+            break;
+        }
+    }
+
+    // Throws the same out_of_range as from_json does, through at(), if a required member is missing
+    static void CheckRequired(bool hasMember, const char* key) {
+        if (!hasMember) static_cast<void>(nlohmann::json::object().at(key));
+    }
+
+    void Append(Frame frame) {
+        switch (frame) {
+        case Frame::Accessor:
+            CheckRequired(hasComponentType, "componentType");
+            CheckRequired(hasCount, "count");
+            CheckRequired(hasType, "type");
+            document.accessors.Append(std::move(accessor), AppendIdPolicy::GenerateOnEmpty);
+            break;
+        case Frame::Mesh:
+            CheckRequired(hasPrimitives, "primitives");
+            document.meshes.Append(std::move(mesh), AppendIdPolicy::GenerateOnEmpty);
+            break;
+        default:
+            // As with from_json, a node's translation, rotation and scale are ignored if it has a matrix
+            if (hasMatrix) {
+                node.translation = Vector3::ZERO;
+                node.rotation = Quaternion::IDENTITY;
+                node.scale = Vector3::ONE;
+            }
+            document.nodes.Append(std::move(node), AppendIdPolicy::GenerateOnEmpty);
+            break;
+        }
+    }
+
+    Document& document;
+
+    Accessor accessor;
+    Mesh mesh;
+    Node node;
+    bool hasComponentType = false;
+    bool hasCount = false;
+    bool hasType = false;
+    bool hasPrimitives = false;
+    bool hasMatrix = false;
+
+    std::vector<Level> levels;
+    std::string attributeName;
+    ValueBuilder value; // A value that isn't read directly
+};
+
+// Builds the manifest's JSON the same way nlohmann's own DOM parser does, except for the elements of the top-level
+// arrays. Without schema validation accessors, meshes and nodes are read straight into the document by ElementReader.
+// Any other element, and every element when validating since the schema validator needs a DOM, is built as a DOM of
+// its own which is validated, converted with get<T>() into the document and discarded as soon as it is complete. The
+// arrays are left holding a null per element so that the root schema can still check their lengths.
+class StreamingSaxHandler : public nlohmann::json_sax<nlohmann::json> {
+public:
+    StreamingSaxHandler(Document& document, SchemaFlags schemaFlags, SchemaValidationEngine schemaEngine)
+        : document(document), schemaFlags(schemaFlags), schemaEngine(schemaEngine), validate((schemaFlags & SchemaFlags::DisableSchemaRoot) != SchemaFlags::DisableSchemaRoot), reader(document) {}
+
+    bool null() override { return HandleValue(nullptr); }
+    bool boolean(bool val) override { return HandleValue(val); }
+    bool number_integer(number_integer_t val) override { return HandleValue(val); }
+    bool number_unsigned(number_unsigned_t val) override { return HandleValue(val); }
+    bool number_float(number_float_t val, const string_t&) override { return HandleValue(val); }
+    bool binary(binary_t& val) override { return HandleValue(std::move(val)); }
+
+    bool string(string_t& val) override {
+        if (reader.IsReading()) {
+            reader.String(val);
+            return true;
+        }
+
+        return HandleValue(std::move(val));
+    }
+
+    bool start_object(std::size_t) override {
+        if (reader.IsReading()) {
+            reader.StartObject();
+        } else if (!IsElementStart() || validate || !reader.Start(*elementArray)) {
+            Builder().Start(nlohmann::json::value_t::object);
+        }
+        return true;
+    }
+
+    bool key(string_t& val) override {
+        if (reader.IsReading()) {
+            reader.Key(val);
+            return true;
+        }
+
+        if (root.Depth() == 1U) rootKey = val;
+        Builder().Key(val);
+        return true;
+    }
+
+    bool end_object() override { return EndValue(); }
+
+    bool start_array(std::size_t) override {
+        if (reader.IsReading()) {
+            reader.StartArray();
+            return true;
+        }
+
+        if (root.Depth() == 1U && root.Result().is_object()) {
+            elementArray = FindElementArray(rootKey);
+
+            // As with the DOM parser the last of any duplicate keys wins
+            if (elementArray) elementArray->clear(document);
+            elementIndex = 0U;
+        }
+
+        Builder().Start(nlohmann::json::value_t::array);
+        return true;
+    }
+
+    bool end_array() override { return EndValue(); }
+
+    bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception&) override {
+        // The input is not valid JSON.
+        throw GLTFException("The document is invalid due to bad JSON formatting");
+    }
+
+    // Validates and deserializes what remains of the manifest once all the array elements have been appended
+    void EndDocument() {
+        auto& json = root.Result();
+
+        if (validate) {
+            GetSchemaValidator(SCHEMA_URI_GLTF, schemaFlags | GetElementSchemaFlags(), schemaEngine)->Validate(json);
+        }
+
+        if (json.is_object()) {
+            for (const auto& array : c_elementArrays) {
+                if (auto iter = json.find(array.name); iter != json.end() && iter->is_array()) json.erase(iter);
+            }
+        }
+
+        document.deserialize(json);
+    }
+
+private:
+    // Whether the next value is in an element of one of the top-level arrays
+    bool IsInElement() const { return elementArray && root.Depth() == 2U; }
+
+    // Whether the next value is an element of one of the top-level arrays
+    bool IsElementStart() const { return IsInElement() && !element.IsBuilding(); }
+
+    // The DOM the next value is added to
+    ValueBuilder& Builder() { return IsInElement() ? element : root; }
+
+    template<typename Value>
+    bool HandleValue(Value&& value) {
+        if (reader.IsReading()) {
+            reader.Value(nlohmann::json(std::forward<Value>(value)));
+        } else if (Builder().Add(std::forward<Value>(value)) && IsInElement()) {
+            AppendElement();
+        }
+        return true;
+    }
+
+    bool EndValue() {
+        if (reader.IsReading()) {
+            if (reader.End()) AppendPlaceholder();
+        } else if (element.IsBuilding()) {
+            if (element.End()) AppendElement();
+        } else {
+            root.End();
+            if (elementArray && root.Depth() == 1U) elementArray = nullptr;
+        }
+        return true;
+    }
+
+    void AppendElement() {
+        if (validate) {
+            auto& validator = validators[IndexOf(*elementArray)];
+
+            if (!validator) validator = GetSchemaValidator(elementArray->schemaUri, schemaFlags, schemaEngine);
+
+            validator->Validate(element.Result(), "<root>[" + std::string(elementArray->name) + "][" + std::to_string(elementIndex) + "]");
+        }
+
+        elementArray->deserializeElement(document, element.Result());
+        element.Result() = nullptr;
+
+        AppendPlaceholder();
+    }
+
+    void AppendPlaceholder() {
+        root.Add(nullptr);
+        ++elementIndex;
+    }
+
+    Document& document;
+    const SchemaFlags schemaFlags;
+    const SchemaValidationEngine schemaEngine;
+    const bool validate;
+
+    ValueBuilder root;
+    ValueBuilder element;
+    ElementReader reader;
+    std::string rootKey;
+
+    const ElementArray* elementArray = nullptr;
+    size_t elementIndex = 0U;
+    std::shared_ptr<const SchemaValidator> validators[std::size(c_elementArrays)];
+};
+
+// Splits a JSON object into its members, or an array into its elements, without parsing their values. Used to split
+// the manifest's root object so that collections can be skipped or kept as unparsed JSON, and by Peek to read only
+// the few values it needs. Values are skipped by counting brackets outside of strings, the rest of their syntax is
+// only checked if and when they are parsed.
+class JsonScanner {
+public:
+    struct Member {
+        std::string key; // Empty for the elements of an array
+        std::string_view value;
+        size_t elementCount; // The number of elements if the value is an array
+    };
+
+    explicit JsonScanner(std::string_view json) : json(json) {
+        SkipWhitespace();
+
+        const char open = Peek();
 
-std::shared_ptr<Document> Deserializer::DeserializeInternal(const nlohmann::json &document, const std::shared_ptr<ExtensionDeserializer>& extensionDeserializer, SchemaFlags schemaFlags) {
-    ValidateDocumentAgainstSchema(document, SCHEMA_URI_GLTF, GetDefaultSchemaLocator(schemaFlags));
+        if (open != '{' && open != '[') Fail();
 
-    auto gltfDocument = document.get<std::shared_ptr<Document>>();
+        ++pos;
+        close = (open == '{') ? '}' : ']';
+
+        SkipWhitespace();
+
+        if (Peek() == close) {
+            ++pos;
+            End();
+        }
+    }
+
+    bool IsObject() const {
+        return close == '}';
+    }
+
+    // Returns false once all the members have been read. The key's storage is reused by successive calls.
+    bool Next(Member& member) {
+        if (isEnd) return false;
+
+        SkipWhitespace();
+
+        if (IsObject()) {
+            const size_t keyBegin = pos;
+            Expect('"');
+            SkipString();
+            ParseString(json.substr(keyBegin, pos - keyBegin), member.key);
+
+            SkipWhitespace();
+            Expect(':');
+            SkipWhitespace();
+        } else {
+            member.key.clear();
+        }
+
+        const size_t valueBegin = pos;
+        member.elementCount = SkipValue();
+        member.value = json.substr(valueBegin, pos - valueBegin);
+
+        SkipWhitespace();
+
+        if (Peek() == ',') {
+            ++pos;
+        } else {
+            Expect(close);
+            End();
+        }
+
+        return true;
+    }
+
+    // Unquotes a string value, only unescaping it with nlohmann's parser if it contains escape sequences
+    static void ParseString(std::string_view value, std::string& result) {
+        if (value.size() < 2U || value.front() != '"') Fail();
+
+        if (value.find('\\') == std::string_view::npos) {
+            result.assign(value.substr(1U, value.size() - 2U));
+            return;
+        }
+
+        try {
+            result = nlohmann::json::parse(value).get<std::string>();
+        } catch (...) {
+            Fail();
+        }
+    }
+
+private:
+    [[noreturn]] static void Fail() {
+        throw GLTFException("The document is invalid due to bad JSON formatting");
+    }
+
+    static bool IsWhitespace(char c) {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    }
+
+    char Peek() const {
+        if (pos >= json.size()) Fail();
+        return json[pos];
+    }
+
+    void Expect(char c) {
+        if (Peek() != c) Fail();
+        ++pos;
+    }
+
+    void SkipWhitespace() {
+        while (pos < json.size() && IsWhitespace(json[pos])) ++pos;
+    }
+
+    // Like nlohmann's parser nothing but whitespace may follow the root object
+    void End() {
+        SkipWhitespace();
+        if (pos != json.size()) Fail();
+        isEnd = true;
+    }
+
+    // Skips the rest of a string whose opening quote has been read
+    void SkipString() {
+        for (char c = Peek(); c != '"'; c = Peek()) {
+            ++pos;
+            if (c == '\\') {
+                Peek();
+                ++pos;
+            }
+        }
+        ++pos;
+    }
+
+    size_t SkipValue() {
+        const char c = Peek();
+        ++pos;
+
+        if (c == '"') {
+            SkipString();
+            return 0U;
+        }
+
+        if (c == '{' || c == '[') {
+            size_t depth = 1U;
+            size_t separatorCount = 0U;
+            bool isEmpty = true;
+
+            while (depth > 0U) {
+                const char next = Peek();
+                ++pos;
+
+                if (next == '"') {
+                    SkipString();
+                } else if (next == '{' || next == '[') {
+                    ++depth;
+                } else if (next == '}' || next == ']') {
+                    --depth;
+                    continue;
+                } else if (next == ',') {
+                    if (depth == 1U) ++separatorCount;
+                } else if (IsWhitespace(next)) {
+                    continue;
+                }
+
+                isEmpty = false;
+            }
+
+            return (c == '[' && !isEmpty) ? separatorCount + 1U : 0U;
+        }
+
+        // A literal or number
+        while (pos < json.size() && json[pos] != ',' && json[pos] != '}' && json[pos] != ']' && !IsWhitespace(json[pos])) ++pos;
+        return 0U;
+    }
+
+    std::string_view json;
+    size_t pos = 0U;
+    char close = '}';
+    bool isEnd = false;
+};
+
+nlohmann::json ParseJson(std::string_view json) {
+    try {
+        return nlohmann::json::parse(json);
+    } catch (...) {
+        // The input is not valid JSON.
+        throw GLTFException("The document is invalid due to bad JSON formatting");
+    }
+}
+
+void ValidateManifest(const nlohmann::json& document, const DeserializeOptions& options) {
+    if (options.executor) {
+        ValidateDocumentAgainstSchema(document, options.schemaFlags, *options.executor, options.validationChunkSize, options.schemaEngine);
+    } else {
+        ValidateDocumentAgainstSchema(document, SCHEMA_URI_GLTF, options.schemaFlags, options.schemaEngine);
+    }
+}
+
+bool HasCollection(DocumentCollections collections, const ElementArray& array) {
+    return (collections & array.collection) != DocumentCollections::None;
+}
+
+void PeekStrings(std::string_view json, std::vector<std::string>& strings) {
+    JsonScanner scanner(json);
+    JsonScanner::Member member;
+
+    while (scanner.Next(member)) {
+        JsonScanner::ParseString(member.value, strings.emplace_back());
+    }
+}
+
+void PeekAsset(std::string_view json, DocumentSummary& summary) {
+    JsonScanner scanner(json);
+    JsonScanner::Member member;
+
+    while (scanner.Next(member)) {
+        if (member.key == "version") {
+            JsonScanner::ParseString(member.value, summary.version);
+        } else if (member.key == "minVersion") {
+            JsonScanner::ParseString(member.value, summary.minVersion);
+        } else if (member.key == "generator") {
+            JsonScanner::ParseString(member.value, summary.generator);
+        } else if (member.key == "copyright") {
+            JsonScanner::ParseString(member.value, summary.copyright);
+        }
+    }
+}
+
+uint64_t PeekByteLength(std::string_view value) {
+    uint64_t byteLength = 0U;
+
+    if (std::from_chars(value.data(), value.data() + value.size(), byteLength).ptr == value.data() + value.size()) {
+        return byteLength;
+    }
+
+    // An integer written as a float, e.g. 1024.0
+    double number = 0.0;
+
+    if (std::from_chars(value.data(), value.data() + value.size(), number).ptr != value.data() + value.size() || number < 0.0) {
+        throw GLTFException("Buffer byteLength " + std::string(value) + " is not a valid length");
+    }
+
+    return static_cast<uint64_t>(number);
+}
+
+void PeekBuffers(std::string_view json, DocumentSummary& summary) {
+    JsonScanner scanner(json);
+    JsonScanner::Member buffer;
+    JsonScanner::Member member;
+
+    while (scanner.Next(buffer)) {
+        JsonScanner bufferScanner(buffer.value);
+
+        while (bufferScanner.Next(member)) {
+            if (member.key == "byteLength") summary.bufferByteLength += PeekByteLength(member.value);
+        }
+    }
+}
+}
+
+
+std::shared_ptr<Document> Deserializer::DeserializeInternal(const nlohmann::json &document, const std::shared_ptr<ExtensionDeserializer>& extensionDeserializer, const DeserializeOptions& options) {
+    ValidateManifest(document, options);
+
+    auto gltfDocument = Document::create(options.memoryResource);
+    gltfDocument->deserialize(document);
 
     gltfDocument->deserializeExtensions(extensionDeserializer);
 
     return gltfDocument;
 }
-std::shared_ptr<Document> Deserializer::Deserialize(const std::string& json, const std::shared_ptr<ExtensionDeserializer>& extensionDeserializer, SchemaFlags schemaFlags){
+std::shared_ptr<Document> Deserializer::Deserialize(std::string_view json, const std::shared_ptr<ExtensionDeserializer>& extensionDeserializer, SchemaFlags schemaFlags, SchemaValidationEngine schemaEngine) {
     nlohmann::json document;
 
     try {
@@ -29,10 +1091,10 @@ std::shared_ptr<Document> Deserializer::Deserialize(const std::string& json, con
         throw GLTFException("The document is invalid due to bad JSON formatting");
     }
 
-    return DeserializeInternal(document, extensionDeserializer, schemaFlags);
+    return DeserializeInternal(document, extensionDeserializer, { .schemaFlags = schemaFlags, .schemaEngine = schemaEngine });
 }
 
-std::shared_ptr<Document> Deserializer::Deserialize(std::istream& jsonStream, const std::shared_ptr<ExtensionDeserializer>& extensionDeserializer, SchemaFlags schemaFlags){
+std::shared_ptr<Document> Deserializer::Deserialize(std::istream& jsonStream, const std::shared_ptr<ExtensionDeserializer>& extensionDeserializer, SchemaFlags schemaFlags, SchemaValidationEngine schemaEngine) {
     nlohmann::json document;
     try {
         jsonStream >> document;
@@ -41,5 +1103,219 @@ std::shared_ptr<Document> Deserializer::Deserialize(std::istream& jsonStream, co
         throw GLTFException("The document is invalid due to bad JSON formatting");
     }
 
-    return DeserializeInternal(document, extensionDeserializer, schemaFlags);
-}
\ No newline at end of file
+    return DeserializeInternal(document, extensionDeserializer, { .schemaFlags = schemaFlags, .schemaEngine = schemaEngine });
+}
+
+std::shared_ptr<Document> Deserializer::Deserialize(std::string_view json, const DeserializeOptions& options, const std::shared_ptr<ExtensionDeserializer>& extensionDeserializer) {
+    if (options.skipCollections == DocumentCollections::None && options.lazyCollections == DocumentCollections::None) {
+        return DeserializeInternal(ParseJson(json), extensionDeserializer, options);
+    }
+
+    const bool skipScenes = HasCollection(options.skipCollections, *FindElementArray("scenes"));
+
+    // The unparsed JSON of the collections that are deserialized on first access
+    std::string_view deferredArrays[std::size(c_elementArrays)];
+
+    nlohmann::json root = nlohmann::json::object();
+
+    JsonScanner scanner(json);
+    JsonScanner::Member member;
+
+    if (!scanner.IsObject()) {
+        throw GLTFException("The document is invalid due to bad JSON formatting");
+    }
+
+    while (scanner.Next(member)) {
+        if (const auto array = FindElementArray(member.key)) {
+            auto& deferredArray = deferredArrays[IndexOf(*array)];
+
+            // As with the DOM parser the last of any duplicate keys wins
+            deferredArray = {};
+            root.erase(member.key);
+
+            if (HasCollection(options.skipCollections, *array)) continue;
+
+            // Like DeserializeStreaming the root schema is given a null per element so that it can still check the
+            // array's length, the elements are validated once they're loaded
+            if (HasCollection(options.lazyCollections, *array) && member.value.front() == '[') {
+                deferredArray = member.value;
+                root[member.key] = nlohmann::json::array_t(member.elementCount);
+                continue;
+            }
+        }
+
+        if (skipScenes && member.key == "scene") continue;
+
+        root[member.key] = ParseJson(member.value);
+    }
+
+    DeserializeOptions rootOptions = options;
+
+    for (const auto& array : c_elementArrays) {
+        if (!deferredArrays[IndexOf(array)].empty()) rootOptions.schemaFlags |= array.schemaFlag;
+    }
+
+    ValidateManifest(root, rootOptions);
+
+    for (const auto& array : c_elementArrays) {
+        if (!deferredArrays[IndexOf(array)].empty()) root.erase(array.name);
+    }
+
+    auto document = Document::create(options.memoryResource);
+    document->deserialize(root);
+
+    for (const auto& array : c_elementArrays) {
+        const auto& deferredArray = deferredArrays[IndexOf(array)];
+
+        if (deferredArray.empty()) continue;
+
+        std::shared_ptr<const SchemaValidator> validator;
+
+        if ((options.schemaFlags & (SchemaFlags::DisableSchemaRoot | array.schemaFlag)) == SchemaFlags::None) {
+            validator = GetSchemaValidator(array.schemaUri, options.schemaFlags, options.schemaEngine);
+        }
+
+        array.deserializeDeferred(*document, [json = std::string(deferredArray), validator, name = std::string(array.name)]() {
+            auto elements = ParseJson(json);
+
+            if (validator) {
+                for (size_t i = 0U; i < elements.size(); ++i) {
+                    validator->Validate(elements[i], "<root>[" + name + "][" + std::to_string(i) + "]");
+                }
+            }
+
+            return elements;
+        });
+    }
+
+    document->deserializeExtensions(extensionDeserializer);
+
+    return document;
+}
+
+std::shared_ptr<Document> Deserializer::Deserialize(std::istream& jsonStream, const DeserializeOptions& options, const std::shared_ptr<ExtensionDeserializer>& extensionDeserializer) {
+    if (options.skipCollections == DocumentCollections::None && options.lazyCollections == DocumentCollections::None) {
+        nlohmann::json document;
+        try {
+            jsonStream >> document;
+        } catch (...) {
+            // The input is not valid JSON.
+            throw GLTFException("The document is invalid due to bad JSON formatting");
+        }
+
+        return DeserializeInternal(document, extensionDeserializer, options);
+    }
+
+    std::stringstream json;
+    json << jsonStream.rdbuf();
+
+    return Deserialize(json.view(), options, extensionDeserializer);
+}
+
+std::shared_ptr<Document> Deserializer::DeserializeStreaming(std::string_view json, const std::shared_ptr<ExtensionDeserializer>& extensionDeserializer, SchemaFlags schemaFlags, SchemaValidationEngine schemaEngine) {
+    auto document = Document::create();
+
+    StreamingSaxHandler handler(*document, schemaFlags, schemaEngine);
+    nlohmann::json::sax_parse(json, &handler);
+    handler.EndDocument();
+
+    document->deserializeExtensions(extensionDeserializer);
+
+    return document;
+}
+
+std::shared_ptr<Document> Deserializer::DeserializeStreaming(std::istream& jsonStream, const std::shared_ptr<ExtensionDeserializer>& extensionDeserializer, SchemaFlags schemaFlags, SchemaValidationEngine schemaEngine) {
+    auto document = Document::create();
+
+    // Like operator>>, trailing characters after the manifest are ignored
+    StreamingSaxHandler handler(*document, schemaFlags, schemaEngine);
+    nlohmann::json::sax_parse(jsonStream, &handler, nlohmann::json::input_format_t::json, false);
+    handler.EndDocument();
+
+    document->deserializeExtensions(extensionDeserializer);
+
+    return document;
+}
+
+DocumentSummary Deserializer::Peek(std::string_view json) {
+    DocumentSummary summary;
+
+    JsonScanner scanner(json);
+    JsonScanner::Member member;
+
+    if (!scanner.IsObject()) {
+        throw GLTFException("The document is invalid due to bad JSON formatting");
+    }
+
+    while (scanner.Next(member)) {
+        if (member.key == "asset") {
+            PeekAsset(member.value, summary);
+        } else if (member.key == "extensionsUsed") {
+            PeekStrings(member.value, summary.extensionsUsed);
+        } else if (member.key == "extensionsRequired") {
+            PeekStrings(member.value, summary.extensionsRequired);
+        } else {
+            if (const auto array = FindElementArray(member.key)) {
+                summary.*array->summaryCount = member.elementCount;
+
+                if (array->collection == DocumentCollections::Buffers) PeekBuffers(member.value, summary);
+            }
+        }
+    }
+
+    return summary;
+}
+
+DocumentSummary Deserializer::Peek(std::istream& stream) {
+    char magic[GLB_HEADER_MAGIC_STRING_SIZE] = {};
+    stream.read(magic, GLB_HEADER_MAGIC_STRING_SIZE);
+
+    const auto magicLength = static_cast<size_t>(stream.gcount());
+
+    if (magicLength != GLB_HEADER_MAGIC_STRING_SIZE || std::memcmp(magic, GLB_HEADER_MAGIC_STRING, GLB_HEADER_MAGIC_STRING_SIZE) != 0) {
+        // A glTF manifest, whose first few characters have already been read
+        std::string json(magic, magicLength);
+        json.append(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+
+        return Peek(json);
+    }
+
+    // Only the GLB header and JSON chunk are read, the binary chunk's length is read from its header
+    uint32_t header[4] = {}; // Version, length, JSON chunk length and JSON chunk type
+
+    if (!stream.read(reinterpret_cast<char*>(header), sizeof(header))) {
+        throw InvalidGLTFException("Cannot read the GLB header");
+    }
+
+    if (header[0] != GLB_HEADER_VERSION_2) {
+        throw InvalidGLTFException("Unsupported GLB Version: " + std::to_string(header[0]));
+    }
+
+    if (std::memcmp(&header[3], GLB_CHUNK_TYPE_JSON, GLB_CHUNK_TYPE_SIZE) != 0) {
+        throw InvalidGLTFException("JSON chunk should appear first");
+    }
+
+    // Reject a JSON chunk that can't fit in the reported file length before allocating it
+    if (header[1] < GLB_HEADER_BYTE_SIZE || header[2] > header[1] - GLB_HEADER_BYTE_SIZE) {
+        throw InvalidGLTFException("File length " + std::to_string(header[1]) + " less than content length " + std::to_string(header[2]) +
+                                   " plus header length " + std::to_string(GLB_HEADER_BYTE_SIZE));
+    }
+
+    std::string json(header[2], '\0');
+
+    if (!stream.read(json.data(), json.size())) {
+        throw InvalidGLTFException("Cannot read the json from the GLB file");
+    }
+
+    auto summary = Peek(json);
+    summary.isGLB = true;
+
+    uint32_t binaryChunkHeader[2] = {}; // Length and type
+
+    if (header[1] > GLB_HEADER_BYTE_SIZE + header[2] && stream.read(reinterpret_cast<char*>(binaryChunkHeader), sizeof(binaryChunkHeader))
+        && std::memcmp(&binaryChunkHeader[1], GLB_CHUNK_TYPE_BIN, GLB_CHUNK_TYPE_SIZE) == 0) {
+        summary.binaryChunkByteLength = binaryChunkHeader[0];
+    }
+
+    return summary;
+}
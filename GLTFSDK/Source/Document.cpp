@@ -2,8 +2,256 @@
 // Licensed under the MIT License.
 
 #include <GLTFSDK/Document.h>
+#include <GLTFSDK/ExtensionsKHR.h>
+
+#include "TopLevelArrays.h"
+
+#include <algorithm>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 using namespace Microsoft::glTF;
+using Microsoft::glTF::Detail::VisitContainer;
+
+namespace
+{
+    // The ids of the remaining elements of an array before RemapReferences, mapped to their ids after it
+    using IdMap = std::unordered_map<std::string, std::string>;
+
+    // The id a reference is rewritten to, or an empty id if it referred to a removed element
+    const std::string& RemapId(const IdMap& ids, const std::string& id)
+    {
+        static const std::string emptyId;
+
+        const auto it = ids.find(id);
+        return it == ids.end() ? emptyId : it->second;
+    }
+
+    // All the new ids are checked before any element is renamed, so the container is left unchanged if it throws
+    template<typename T>
+    IdMap RenumberIds(IndexedContainer<const T>& container, const IndexRemap& remap)
+    {
+        IdMap ids;
+        ids.reserve(container.Size());
+
+        std::vector<std::string> newIds;
+        newIds.reserve(container.Size());
+
+        for (size_t oldIndex = 0U; oldIndex < remap.size(); ++oldIndex)
+        {
+            const auto newIndex = remap[oldIndex];
+
+            if (newIndex == RemovedIndex)
+            {
+                continue;
+            }
+
+            if (newIndex != ids.size() || newIndex >= container.Size())
+            {
+                throw GLTFException("The index remap doesn't match the container");
+            }
+
+            const std::string& id = container[newIndex].id;
+
+            newIds.push_back(id == std::to_string(oldIndex) ? std::to_string(newIndex) : id);
+            ids.emplace(id, newIds.back());
+        }
+
+        if (ids.size() != container.Size())
+        {
+            throw GLTFException("The index remap doesn't match the container");
+        }
+
+        // The elements kept their order, so once the new ids are known to be unique renaming them in order can't
+        // clash either: an id is only ever renamed to a lower index, which an earlier element has already vacated
+        std::unordered_set<std::string_view> uniqueIds;
+        uniqueIds.reserve(newIds.size());
+
+        for (const auto& newId : newIds)
+        {
+            if (!uniqueIds.insert(newId).second)
+            {
+                throw GLTFException("Renumbering the remaining elements would give more than one of them the id " + newId);
+            }
+        }
+
+        for (size_t index = 0U; index < newIds.size(); ++index)
+        {
+            container.Rename(std::string(container[index].id), std::move(newIds[index]));
+        }
+
+        return ids;
+    }
+
+    // Calls fn with the array each id of an element refers to, and the id
+    template<typename T, typename Fn>
+    void VisitIds(T& element, Fn&& fn)
+    {
+        using Element = std::remove_const_t<T>;
+
+        if constexpr (std::is_same_v<Element, Accessor>)
+        {
+            fn(DocumentCollections::BufferViews, element.bufferViewId);
+            fn(DocumentCollections::BufferViews, element.sparse.indicesBufferViewId);
+            fn(DocumentCollections::BufferViews, element.sparse.valuesBufferViewId);
+        }
+        else if constexpr (std::is_same_v<Element, Animation>)
+        {
+            for (auto& channel : element.channels.Elements())
+            {
+                fn(DocumentCollections::Nodes, channel.target.nodeId);
+            }
+
+            for (auto& sampler : element.samplers.Elements())
+            {
+                fn(DocumentCollections::Accessors, sampler.inputAccessorId);
+                fn(DocumentCollections::Accessors, sampler.outputAccessorId);
+            }
+        }
+        else if constexpr (std::is_same_v<Element, BufferView>)
+        {
+            fn(DocumentCollections::Buffers, element.bufferId);
+        }
+        else if constexpr (std::is_same_v<Element, Image>)
+        {
+            fn(DocumentCollections::BufferViews, element.bufferViewId);
+        }
+        else if constexpr (std::is_same_v<Element, Material>)
+        {
+            fn(DocumentCollections::Textures, element.metallicRoughness.baseColorTexture.textureId);
+            fn(DocumentCollections::Textures, element.metallicRoughness.metallicRoughnessTexture.textureId);
+            fn(DocumentCollections::Textures, element.normalTexture.textureId);
+            fn(DocumentCollections::Textures, element.occlusionTexture.textureId);
+            fn(DocumentCollections::Textures, element.emissiveTexture.textureId);
+
+            if (element.template HasExtension<KHR::Materials::PBRSpecularGlossiness>())
+            {
+                auto& specularGlossiness = element.template GetExtension<KHR::Materials::PBRSpecularGlossiness>();
+
+                fn(DocumentCollections::Textures, specularGlossiness.diffuseTexture.textureId);
+                fn(DocumentCollections::Textures, specularGlossiness.specularGlossinessTexture.textureId);
+            }
+        }
+        else if constexpr (std::is_same_v<Element, Mesh>)
+        {
+            for (auto& primitive : element.primitives)
+            {
+                for (auto& attribute : primitive.attributes)
+                {
+                    fn(DocumentCollections::Accessors, attribute.second);
+                }
+
+                fn(DocumentCollections::Accessors, primitive.indicesAccessorId);
+                fn(DocumentCollections::Materials, primitive.materialId);
+
+                for (auto& target : primitive.targets)
+                {
+                    fn(DocumentCollections::Accessors, target.positionsAccessorId);
+                    fn(DocumentCollections::Accessors, target.normalsAccessorId);
+                    fn(DocumentCollections::Accessors, target.tangentsAccessorId);
+                }
+
+                if (primitive.template HasExtension<KHR::MeshPrimitives::DracoMeshCompression>())
+                {
+                    fn(DocumentCollections::BufferViews, primitive.template GetExtension<KHR::MeshPrimitives::DracoMeshCompression>().bufferViewId);
+                }
+            }
+        }
+        else if constexpr (std::is_same_v<Element, Node>)
+        {
+            fn(DocumentCollections::Cameras, element.cameraId);
+
+            for (auto& child : element.children)
+            {
+                fn(DocumentCollections::Nodes, child);
+            }
+
+            fn(DocumentCollections::Meshes, element.meshId);
+            fn(DocumentCollections::Skins, element.skinId);
+        }
+        else if constexpr (std::is_same_v<Element, Scene>)
+        {
+            for (auto& node : element.nodes)
+            {
+                fn(DocumentCollections::Nodes, node);
+            }
+        }
+        else if constexpr (std::is_same_v<Element, Skin>)
+        {
+            fn(DocumentCollections::Accessors, element.inverseBindMatricesAccessorId);
+            fn(DocumentCollections::Nodes, element.skeletonId);
+
+            for (auto& joint : element.jointIds)
+            {
+                fn(DocumentCollections::Nodes, joint);
+            }
+        }
+        else if constexpr (std::is_same_v<Element, Texture>)
+        {
+            fn(DocumentCollections::Samplers, element.samplerId);
+            fn(DocumentCollections::Images, element.imageId);
+        }
+    }
+
+    // Lists can't hold empty ids, so references to removed elements are erased from them rather than cleared
+    template<typename T>
+    void EraseEmptyIds(T& element)
+    {
+        if constexpr (std::is_same_v<T, Mesh>)
+        {
+            for (auto& primitive : element.primitives)
+            {
+                std::erase_if(primitive.attributes, [](const auto& attribute) { return attribute.second.empty(); });
+            }
+        }
+        else if constexpr (std::is_same_v<T, Node>)
+        {
+            std::erase(element.children, std::string());
+        }
+        else if constexpr (std::is_same_v<T, Scene>)
+        {
+            std::erase(element.nodes, std::string());
+        }
+        else if constexpr (std::is_same_v<T, Skin>)
+        {
+            std::erase(element.jointIds, std::string());
+        }
+    }
+
+    // Only the elements that refer to a renamed or removed element are copied and replaced
+    template<typename T>
+    void RemapIds(IndexedContainer<const T>& container, DocumentCollections collection, const IdMap& ids)
+    {
+        for (size_t i = 0U; i < container.Size(); ++i)
+        {
+            bool isChanged = false;
+
+            VisitIds(container[i], [collection, &ids, &isChanged](DocumentCollections target, const std::string& id)
+            {
+                isChanged = isChanged || (target == collection && !id.empty() && RemapId(ids, id) != id);
+            });
+
+            if (isChanged)
+            {
+                T element = container[i];
+
+                VisitIds(element, [collection, &ids](DocumentCollections target, std::string& id)
+                {
+                    if (target == collection && !id.empty())
+                    {
+                        id = RemapId(ids, id);
+                    }
+                });
+
+                EraseEmptyIds(element);
+                container.Replace(std::move(element));
+            }
+        }
+    }
+}
 
 Document::Document() = default;
 
@@ -11,6 +259,23 @@ Document::Document(Asset&& asset) : asset(std::move(asset))
 {
 }
 
+Document::Document(std::pmr::memory_resource* resource) :
+    accessors(resource ? resource : std::pmr::get_default_resource()),
+    animations(accessors.GetMemoryResource()),
+    buffers(accessors.GetMemoryResource()),
+    bufferViews(accessors.GetMemoryResource()),
+    cameras(accessors.GetMemoryResource()),
+    images(accessors.GetMemoryResource()),
+    materials(accessors.GetMemoryResource()),
+    meshes(accessors.GetMemoryResource()),
+    nodes(accessors.GetMemoryResource()),
+    samplers(accessors.GetMemoryResource()),
+    scenes(accessors.GetMemoryResource()),
+    skins(accessors.GetMemoryResource()),
+    textures(accessors.GetMemoryResource())
+{
+}
+
 bool Document::IsExtensionUsed(const std::string& extension) const
 {
     return extensionsUsed.find(extension) != extensionsUsed.end();
@@ -52,8 +317,42 @@ const Scene& Document::SetDefaultScene(Scene&& scene, AppendIdPolicy policy)
     return defaultScene;
 }
 
+void Document::RemapReferences(DocumentCollections collection, const IndexRemap& remap)
+{
+    const auto ids = VisitContainer(*this, collection, [&remap](auto& container) { return RenumberIds(container, remap); });
+
+    Detail::ForEachTopLevelArray([this, collection, &ids](const auto& array)
+    {
+        RemapIds(this->*array.container, collection, ids);
+    });
+
+    if (collection == DocumentCollections::Scenes && HasDefaultScene())
+    {
+        defaultSceneId = RemapId(ids, defaultSceneId);
+    }
+}
+
+size_t Document::GetElementCount(DocumentCollections collection) const
+{
+    return VisitContainer(*this, collection, [](const auto& container) { return container.Size(); });
+}
+
+void Document::ForEachReference(DocumentCollections collection, size_t index, const std::function<void(DocumentCollections, size_t)>& fn) const
+{
+    VisitContainer(*this, collection, [this, index, &fn](const auto& container)
+    {
+        VisitIds(container[index], [this, &fn](DocumentCollections target, const std::string& id)
+        {
+            if (!id.empty())
+            {
+                fn(target, VisitContainer(*this, target, [&id](const auto& targetContainer) { return targetContainer.GetIndex(id); }));
+            }
+        });
+    });
+}
+
 void Document::serialize(nlohmann::json &json) const {
-    json["asset"] = asset;
+    serializeProperties(json);
     if (accessors.Size()>0) json["accessors"] = accessors;
     if (animations.Size()>0) json["animations"] = animations;
     if (bufferViews.Size()>0) json["bufferViews"] = bufferViews;
@@ -67,6 +366,10 @@ void Document::serialize(nlohmann::json &json) const {
     if (scenes.Size()>0) json["scenes"] = scenes;
     if (skins.Size()>0) json["skins"] = skins;
     if (textures.Size()>0) json["textures"] = textures;
+}
+
+void Document::serializeProperties(nlohmann::json &json) const {
+    json["asset"] = asset;
     if (HasDefaultScene()) json["scene"] = scenes.GetIndex(defaultSceneId);
     if (!gltfDocument->extensionsUsed.empty()) json["extensionsUsed"] = gltfDocument->extensionsUsed;
     for (auto& extensionName : gltfDocument->extensionsRequired) {
@@ -76,6 +379,36 @@ void Document::serialize(nlohmann::json &json) const {
     if (!gltfDocument->extensionsRequired.empty()) json["extensionsRequired"] = gltfDocument->extensionsRequired;
 }
 
+void Document::deserialize(const nlohmann::json &json) {
+    nlohmann::from_json(json, static_cast<glTFProperty&>(*this));
+    if (auto iter = json.find("asset"); iter != json.end()) {
+        iter.value().get_to(asset);
+    }
+    if (auto iter = json.find("accessors"); iter != json.end()) iter.value().get_to(accessors);
+    if (auto iter = json.find("animations"); iter != json.end()) iter.value().get_to(animations);
+    if (auto iter = json.find("buffers"); iter != json.end()) iter.value().get_to(buffers);
+    if (auto iter = json.find("bufferViews"); iter != json.end()) iter.value().get_to(bufferViews);
+    if (auto iter = json.find("cameras"); iter != json.end()) iter.value().get_to(cameras);
+    if (auto iter = json.find("images"); iter != json.end()) iter.value().get_to(images);
+    if (auto iter = json.find("materials"); iter != json.end()) iter.value().get_to(materials);
+    if (auto iter = json.find("meshes"); iter != json.end()) iter.value().get_to(meshes);
+    if (auto iter = json.find("nodes"); iter != json.end()) iter.value().get_to(nodes);
+    if (auto iter = json.find("samplers"); iter != json.end()) iter.value().get_to(samplers);
+    if (auto iter = json.find("scenes"); iter != json.end()) iter.value().get_to(scenes);
+    if (auto iter = json.find("skins"); iter != json.end()) iter.value().get_to(skins);
+    if (auto iter = json.find("textures"); iter != json.end()) iter.value().get_to(textures);
+
+    if (auto iter = json.find("scene"); iter != json.end()) {
+        defaultSceneId = std::to_string(iter.value().get<unsigned int>());
+    }
+
+    if (auto iter = json.find("extensionsUsed"); iter != json.end())
+        iter.value().get_to(extensionsUsed);
+
+    if (auto iter = json.find("extensionsRequired"); iter != json.end())
+        iter.value().get_to(extensionsRequired);
+}
+
 bool Document::operator==(const Document& rhs) const
 {
     return this->asset == rhs.asset
@@ -97,3 +430,35 @@ bool Document::operator==(const Document& rhs) const
         && this->defaultSceneId == rhs.defaultSceneId
         && glTFProperty::Equals(*this, rhs);
 }
+
+// DocumentCollections operator definitions
+
+DocumentCollections Microsoft::glTF::operator|(DocumentCollections lhs, DocumentCollections rhs)
+{
+    const auto result =
+        static_cast<std::underlying_type_t<DocumentCollections>>(lhs) |
+        static_cast<std::underlying_type_t<DocumentCollections>>(rhs);
+
+    return static_cast<DocumentCollections>(result);
+}
+
+DocumentCollections& Microsoft::glTF::operator|=(DocumentCollections& lhs, DocumentCollections rhs)
+{
+    lhs = lhs | rhs;
+    return lhs;
+}
+
+DocumentCollections Microsoft::glTF::operator&(DocumentCollections lhs, DocumentCollections rhs)
+{
+    const auto result =
+        static_cast<std::underlying_type_t<DocumentCollections>>(lhs) &
+        static_cast<std::underlying_type_t<DocumentCollections>>(rhs);
+
+    return static_cast<DocumentCollections>(result);
+}
+
+DocumentCollections& Microsoft::glTF::operator&=(DocumentCollections& lhs, DocumentCollections rhs)
+{
+    lhs = lhs & rhs;
+    return lhs;
+}
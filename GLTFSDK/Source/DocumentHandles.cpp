@@ -0,0 +1,372 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/DocumentHandles.h>
+#include <GLTFSDK/ExtensionsKHR.h>
+
+#include <algorithm>
+#include <type_traits>
+#include <unordered_map>
+
+using namespace Microsoft::glTF;
+
+namespace
+{
+    template<typename TReferences>
+    void CheckSize(size_t size, const std::vector<TReferences>& references, const char* name)
+    {
+        if (size != references.size())
+        {
+            throw DocumentException(std::string("The handles don't match the document's ") + name);
+        }
+    }
+
+    // Calls fn(element, references, set) for each element, where fn passes each of the element's ids to set along
+    // with the id its handle refers to. fn is first called on the element itself with a set that only compares the
+    // ids, and only if one of them differs is the element copied, updated by calling fn again and replaced.
+    template<typename T, typename TReferences, typename Fn>
+    void Update(IndexedContainer<const T>& container, const std::vector<TReferences>& references, const char* name, Fn fn)
+    {
+        CheckSize(container.Size(), references, name);
+
+        for (size_t i = 0U; i < references.size(); ++i)
+        {
+            bool isChanged = false;
+
+            fn(container[i], references[i], [&isChanged](const auto& id, const auto& newId)
+            {
+                isChanged = isChanged || id != newId;
+            });
+
+            if (isChanged)
+            {
+                T element = container[i];
+
+                fn(element, references[i], [](auto& id, auto&& newId)
+                {
+                    id = std::forward<decltype(newId)>(newId);
+                });
+
+                container.Replace(std::move(element));
+            }
+        }
+    }
+
+    std::vector<NodeHandle> ResolveNodes(const Document& document, const std::vector<std::string>& nodeIds)
+    {
+        std::vector<NodeHandle> nodes;
+        nodes.reserve(nodeIds.size());
+
+        for (const auto& nodeId : nodeIds)
+        {
+            nodes.push_back(document.nodes.GetHandle(nodeId));
+        }
+
+        return nodes;
+    }
+
+    template<typename T, typename TExtension, typename Fn>
+    void VisitExtension(T& property, Fn fn)
+    {
+        if (property.template HasExtension<TExtension>())
+        {
+            fn(property.template GetExtension<TExtension>());
+        }
+    }
+
+    std::unordered_map<std::string, std::string> GetAttributes(const Document& document, const std::vector<std::pair<std::string, AccessorHandle>>& attributes)
+    {
+        std::unordered_map<std::string, std::string> attributeIds;
+        attributeIds.reserve(attributes.size());
+
+        for (const auto& [name, accessor] : attributes)
+        {
+            attributeIds.emplace(name, document.accessors.GetId(accessor));
+        }
+
+        return attributeIds;
+    }
+
+    std::vector<std::string> GetNodeIds(const Document& document, const std::vector<NodeHandle>& nodes)
+    {
+        std::vector<std::string> nodeIds;
+        nodeIds.reserve(nodes.size());
+
+        for (const auto node : nodes)
+        {
+            nodeIds.push_back(document.nodes.GetId(node));
+        }
+
+        return nodeIds;
+    }
+}
+
+DocumentHandles DocumentHandles::Resolve(const Document& document)
+{
+    DocumentHandles handles;
+
+    handles.accessors.reserve(document.accessors.Size());
+
+    for (const auto& accessor : document.accessors.Elements())
+    {
+        handles.accessors.push_back({
+            document.bufferViews.GetHandle(accessor.bufferViewId),
+            document.bufferViews.GetHandle(accessor.sparse.indicesBufferViewId),
+            document.bufferViews.GetHandle(accessor.sparse.valuesBufferViewId)
+        });
+    }
+
+    handles.animations.reserve(document.animations.Size());
+
+    for (const auto& animation : document.animations.Elements())
+    {
+        auto& references = handles.animations.emplace_back();
+
+        references.channels.reserve(animation.channels.Size());
+
+        for (const auto& channel : animation.channels.Elements())
+        {
+            references.channels.push_back({ animation.samplers.GetHandle(channel.samplerId), document.nodes.GetHandle(channel.target.nodeId) });
+        }
+
+        references.samplers.reserve(animation.samplers.Size());
+
+        for (const auto& sampler : animation.samplers.Elements())
+        {
+            references.samplers.push_back({ document.accessors.GetHandle(sampler.inputAccessorId), document.accessors.GetHandle(sampler.outputAccessorId) });
+        }
+    }
+
+    handles.bufferViews.reserve(document.bufferViews.Size());
+
+    for (const auto& bufferView : document.bufferViews.Elements())
+    {
+        handles.bufferViews.push_back({ document.buffers.GetHandle(bufferView.bufferId) });
+    }
+
+    handles.images.reserve(document.images.Size());
+
+    for (const auto& image : document.images.Elements())
+    {
+        handles.images.push_back({ document.bufferViews.GetHandle(image.bufferViewId) });
+    }
+
+    handles.materials.reserve(document.materials.Size());
+
+    for (const auto& material : document.materials.Elements())
+    {
+        auto& references = handles.materials.emplace_back();
+
+        references.baseColorTexture = document.textures.GetHandle(material.metallicRoughness.baseColorTexture.textureId);
+        references.metallicRoughnessTexture = document.textures.GetHandle(material.metallicRoughness.metallicRoughnessTexture.textureId);
+        references.normalTexture = document.textures.GetHandle(material.normalTexture.textureId);
+        references.occlusionTexture = document.textures.GetHandle(material.occlusionTexture.textureId);
+        references.emissiveTexture = document.textures.GetHandle(material.emissiveTexture.textureId);
+
+        VisitExtension<const Material, KHR::Materials::PBRSpecularGlossiness>(material, [&](const auto& specularGlossiness)
+        {
+            references.specularGlossinessDiffuseTexture = document.textures.GetHandle(specularGlossiness.diffuseTexture.textureId);
+            references.specularGlossinessTexture = document.textures.GetHandle(specularGlossiness.specularGlossinessTexture.textureId);
+        });
+    }
+
+    handles.meshes.reserve(document.meshes.Size());
+
+    for (const auto& mesh : document.meshes.Elements())
+    {
+        auto& references = handles.meshes.emplace_back();
+
+        references.primitives.reserve(mesh.primitives.size());
+
+        for (const auto& primitive : mesh.primitives)
+        {
+            auto& primitiveReferences = references.primitives.emplace_back();
+
+            primitiveReferences.attributes.reserve(primitive.attributes.size());
+
+            for (const auto& [name, accessorId] : primitive.attributes)
+            {
+                primitiveReferences.attributes.emplace_back(name, document.accessors.GetHandle(accessorId));
+            }
+
+            std::sort(primitiveReferences.attributes.begin(), primitiveReferences.attributes.end(), [](const auto& lhs, const auto& rhs)
+            {
+                return lhs.first < rhs.first;
+            });
+
+            primitiveReferences.indices = document.accessors.GetHandle(primitive.indicesAccessorId);
+            primitiveReferences.material = document.materials.GetHandle(primitive.materialId);
+
+            primitiveReferences.targets.reserve(primitive.targets.size());
+
+            for (const auto& target : primitive.targets)
+            {
+                primitiveReferences.targets.push_back({
+                    document.accessors.GetHandle(target.positionsAccessorId),
+                    document.accessors.GetHandle(target.normalsAccessorId),
+                    document.accessors.GetHandle(target.tangentsAccessorId)
+                });
+            }
+
+            VisitExtension<const MeshPrimitive, KHR::MeshPrimitives::DracoMeshCompression>(primitive, [&](const auto& draco)
+            {
+                primitiveReferences.dracoBufferView = document.bufferViews.GetHandle(draco.bufferViewId);
+            });
+        }
+    }
+
+    handles.nodes.reserve(document.nodes.Size());
+
+    for (const auto& node : document.nodes.Elements())
+    {
+        handles.nodes.push_back({
+            document.cameras.GetHandle(node.cameraId),
+            ResolveNodes(document, node.children),
+            document.meshes.GetHandle(node.meshId),
+            document.skins.GetHandle(node.skinId)
+        });
+    }
+
+    handles.scenes.reserve(document.scenes.Size());
+
+    for (const auto& scene : document.scenes.Elements())
+    {
+        handles.scenes.push_back({ ResolveNodes(document, scene.nodes) });
+    }
+
+    handles.skins.reserve(document.skins.Size());
+
+    for (const auto& skin : document.skins.Elements())
+    {
+        handles.skins.push_back({
+            document.accessors.GetHandle(skin.inverseBindMatricesAccessorId),
+            document.nodes.GetHandle(skin.skeletonId),
+            ResolveNodes(document, skin.jointIds)
+        });
+    }
+
+    handles.textures.reserve(document.textures.Size());
+
+    for (const auto& texture : document.textures.Elements())
+    {
+        handles.textures.push_back({ document.samplers.GetHandle(texture.samplerId), document.images.GetHandle(texture.imageId) });
+    }
+
+    handles.defaultScene = document.scenes.GetHandle(document.defaultSceneId);
+
+    return handles;
+}
+
+void DocumentHandles::Apply(Document& document) const
+{
+    Update(document.accessors, accessors, "accessors", [&document](auto& accessor, const AccessorReferences& references, auto set)
+    {
+        set(accessor.bufferViewId, document.bufferViews.GetId(references.bufferView));
+        set(accessor.sparse.indicesBufferViewId, document.bufferViews.GetId(references.sparseIndicesBufferView));
+        set(accessor.sparse.valuesBufferViewId, document.bufferViews.GetId(references.sparseValuesBufferView));
+    });
+
+    Update(document.animations, animations, "animations", [&document](auto& animation, const AnimationReferences& references, auto set)
+    {
+        CheckSize(animation.channels.Size(), references.channels, "animation channels");
+        CheckSize(animation.samplers.Size(), references.samplers, "animation samplers");
+
+        for (size_t i = 0U; i < references.channels.size(); ++i)
+        {
+            auto& channel = animation.channels[i];
+
+            set(channel.samplerId, animation.samplers.GetId(references.channels[i].sampler));
+            set(channel.target.nodeId, document.nodes.GetId(references.channels[i].targetNode));
+        }
+
+        for (size_t i = 0U; i < references.samplers.size(); ++i)
+        {
+            auto& sampler = animation.samplers[i];
+
+            set(sampler.inputAccessorId, document.accessors.GetId(references.samplers[i].input));
+            set(sampler.outputAccessorId, document.accessors.GetId(references.samplers[i].output));
+        }
+    });
+
+    Update(document.bufferViews, bufferViews, "bufferViews", [&document](auto& bufferView, const BufferViewReferences& references, auto set)
+    {
+        set(bufferView.bufferId, document.buffers.GetId(references.buffer));
+    });
+
+    Update(document.images, images, "images", [&document](auto& image, const ImageReferences& references, auto set)
+    {
+        set(image.bufferViewId, document.bufferViews.GetId(references.bufferView));
+    });
+
+    Update(document.materials, materials, "materials", [&document](auto& material, const MaterialReferences& references, auto set)
+    {
+        set(material.metallicRoughness.baseColorTexture.textureId, document.textures.GetId(references.baseColorTexture));
+        set(material.metallicRoughness.metallicRoughnessTexture.textureId, document.textures.GetId(references.metallicRoughnessTexture));
+        set(material.normalTexture.textureId, document.textures.GetId(references.normalTexture));
+        set(material.occlusionTexture.textureId, document.textures.GetId(references.occlusionTexture));
+        set(material.emissiveTexture.textureId, document.textures.GetId(references.emissiveTexture));
+
+        VisitExtension<std::remove_reference_t<decltype(material)>, KHR::Materials::PBRSpecularGlossiness>(material, [&](auto& specularGlossiness)
+        {
+            set(specularGlossiness.diffuseTexture.textureId, document.textures.GetId(references.specularGlossinessDiffuseTexture));
+            set(specularGlossiness.specularGlossinessTexture.textureId, document.textures.GetId(references.specularGlossinessTexture));
+        });
+    });
+
+    Update(document.meshes, meshes, "meshes", [&document](auto& mesh, const MeshReferences& references, auto set)
+    {
+        CheckSize(mesh.primitives.size(), references.primitives, "mesh primitives");
+
+        for (size_t i = 0U; i < references.primitives.size(); ++i)
+        {
+            auto& primitive = mesh.primitives[i];
+            const auto& primitiveReferences = references.primitives[i];
+
+            set(primitive.attributes, GetAttributes(document, primitiveReferences.attributes));
+            set(primitive.indicesAccessorId, document.accessors.GetId(primitiveReferences.indices));
+            set(primitive.materialId, document.materials.GetId(primitiveReferences.material));
+
+            CheckSize(primitive.targets.size(), primitiveReferences.targets, "morph targets");
+
+            for (size_t j = 0U; j < primitiveReferences.targets.size(); ++j)
+            {
+                set(primitive.targets[j].positionsAccessorId, document.accessors.GetId(primitiveReferences.targets[j].positions));
+                set(primitive.targets[j].normalsAccessorId, document.accessors.GetId(primitiveReferences.targets[j].normals));
+                set(primitive.targets[j].tangentsAccessorId, document.accessors.GetId(primitiveReferences.targets[j].tangents));
+            }
+
+            VisitExtension<std::remove_reference_t<decltype(primitive)>, KHR::MeshPrimitives::DracoMeshCompression>(primitive, [&](auto& draco)
+            {
+                set(draco.bufferViewId, document.bufferViews.GetId(primitiveReferences.dracoBufferView));
+            });
+        }
+    });
+
+    Update(document.nodes, nodes, "nodes", [&document](auto& node, const NodeReferences& references, auto set)
+    {
+        set(node.cameraId, document.cameras.GetId(references.camera));
+        set(node.children, GetNodeIds(document, references.children));
+        set(node.meshId, document.meshes.GetId(references.mesh));
+        set(node.skinId, document.skins.GetId(references.skin));
+    });
+
+    Update(document.scenes, scenes, "scenes", [&document](auto& scene, const SceneReferences& references, auto set)
+    {
+        set(scene.nodes, GetNodeIds(document, references.nodes));
+    });
+
+    Update(document.skins, skins, "skins", [&document](auto& skin, const SkinReferences& references, auto set)
+    {
+        set(skin.inverseBindMatricesAccessorId, document.accessors.GetId(references.inverseBindMatrices));
+        set(skin.skeletonId, document.nodes.GetId(references.skeleton));
+        set(skin.jointIds, GetNodeIds(document, references.joints));
+    });
+
+    Update(document.textures, textures, "textures", [&document](auto& texture, const TextureReferences& references, auto set)
+    {
+        set(texture.samplerId, document.samplers.GetId(references.sampler));
+        set(texture.imageId, document.images.GetId(references.image));
+    });
+
+    document.defaultSceneId = document.scenes.GetId(defaultScene);
+}
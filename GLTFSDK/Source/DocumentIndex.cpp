@@ -0,0 +1,212 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/DocumentIndex.h>
+
+#include <algorithm>
+#include <bit>
+#include <utility>
+
+using namespace Microsoft::glTF;
+
+namespace
+{
+    // The position of a single DocumentCollections flag, which is also the position of its table in the index
+    size_t GetSlot(DocumentCollections collection)
+    {
+        const auto flags = static_cast<std::underlying_type_t<DocumentCollections>>(collection);
+
+        if (std::popcount(flags) != 1 || (collection & DocumentCollections::All) == DocumentCollections::None)
+        {
+            throw GLTFException("Expected a single top-level array");
+        }
+
+        return static_cast<size_t>(std::countr_zero(flags));
+    }
+
+    DocumentCollections GetCollection(size_t slot)
+    {
+        return static_cast<DocumentCollections>(1U << slot);
+    }
+}
+
+DocumentIndex::DocumentIndex(const Document& document)
+{
+    // Every element needs an entry before references to it can be indexed
+    for (size_t slot = 0U; slot < m_entries.size(); ++slot)
+    {
+        m_entries[slot].resize(document.GetElementCount(GetCollection(slot)));
+    }
+
+    for (size_t slot = 0U; slot < m_entries.size(); ++slot)
+    {
+        for (size_t index = 0U; index < m_entries[slot].size(); ++index)
+        {
+            const DocumentElement element = { GetCollection(slot), index };
+
+            Link(element, ResolveReferences(document, element));
+        }
+    }
+}
+
+const std::vector<DocumentElement>& DocumentIndex::GetReferences(DocumentElement element) const
+{
+    return GetEntry(element).references;
+}
+
+const std::vector<DocumentElement>& DocumentIndex::GetReferencedBy(DocumentElement element) const
+{
+    return GetEntry(element).referencedBy;
+}
+
+size_t DocumentIndex::GetElementCount(DocumentCollections collection) const
+{
+    return m_entries[GetSlot(collection)].size();
+}
+
+void DocumentIndex::OnAppend(const Document& document, DocumentCollections collection)
+{
+    auto& entries = m_entries[GetSlot(collection)];
+
+    const size_t indexedCount = entries.size();
+    const size_t count = document.GetElementCount(collection);
+
+    if (count < indexedCount)
+    {
+        throw GLTFException("Elements were removed from the document without updating the index");
+    }
+
+    // The appended elements can refer to each other, e.g. a node to its children
+    entries.resize(count);
+
+    std::vector<std::vector<DocumentElement>> references;
+    references.reserve(count - indexedCount);
+
+    try
+    {
+        for (size_t index = indexedCount; index < count; ++index)
+        {
+            references.push_back(ResolveReferences(document, { collection, index }));
+        }
+    }
+    catch (...)
+    {
+        entries.resize(indexedCount);
+        throw;
+    }
+
+    for (size_t index = indexedCount; index < count; ++index)
+    {
+        Link({ collection, index }, std::move(references[index - indexedCount]));
+    }
+}
+
+void DocumentIndex::OnReplace(const Document& document, DocumentElement element)
+{
+    auto references = ResolveReferences(document, element);
+
+    for (const auto& reference : GetEntry(element).references)
+    {
+        auto& referencedBy = GetEntry(reference).referencedBy;
+        referencedBy.erase(std::find(referencedBy.begin(), referencedBy.end(), element));
+    }
+
+    Link(element, std::move(references));
+}
+
+void DocumentIndex::OnRemove(DocumentCollections collection, const IndexRemap& remap)
+{
+    auto& entries = m_entries[GetSlot(collection)];
+
+    if (remap.size() != entries.size())
+    {
+        throw GLTFException("The index remap doesn't match the index");
+    }
+
+    size_t size = 0U;
+
+    for (const auto newIndex : remap)
+    {
+        if (newIndex != RemovedIndex && newIndex != size++)
+        {
+            throw GLTFException("The index remap doesn't match the index");
+        }
+    }
+
+    for (size_t oldIndex = 0U; oldIndex < remap.size(); ++oldIndex)
+    {
+        if (remap[oldIndex] != RemovedIndex && remap[oldIndex] != oldIndex)
+        {
+            entries[remap[oldIndex]] = std::move(entries[oldIndex]);
+        }
+    }
+
+    entries.resize(size);
+
+    // A single pass over every reference drops those to or from removed elements and renumbers the rest
+    const auto isRemoved = [collection, &remap](const DocumentElement& element)
+    {
+        return element.collection == collection && remap[element.index] == RemovedIndex;
+    };
+
+    for (auto& tableEntries : m_entries)
+    {
+        for (auto& entry : tableEntries)
+        {
+            for (auto* elements : { &entry.references, &entry.referencedBy })
+            {
+                std::erase_if(*elements, isRemoved);
+
+                for (auto& element : *elements)
+                {
+                    if (element.collection == collection)
+                    {
+                        element.index = remap[element.index];
+                    }
+                }
+            }
+        }
+    }
+}
+
+const DocumentIndex::Entry& DocumentIndex::GetEntry(DocumentElement element) const
+{
+    const auto& entries = m_entries[GetSlot(element.collection)];
+
+    if (element.index >= entries.size())
+    {
+        throw GLTFException("index " + std::to_string(element.index) + " not in the document index");
+    }
+
+    return entries[element.index];
+}
+
+DocumentIndex::Entry& DocumentIndex::GetEntry(DocumentElement element)
+{
+    return const_cast<Entry&>(std::as_const(*this).GetEntry(element));
+}
+
+std::vector<DocumentElement> DocumentIndex::ResolveReferences(const Document& document, DocumentElement element) const
+{
+    std::vector<DocumentElement> references;
+
+    document.ForEachReference(element.collection, element.index, [this, &references](DocumentCollections collection, size_t index)
+    {
+        const DocumentElement reference = { collection, index };
+
+        GetEntry(reference); // Throws if the referenced element was appended but isn't indexed yet
+        references.push_back(reference);
+    });
+
+    return references;
+}
+
+void DocumentIndex::Link(DocumentElement element, std::vector<DocumentElement> references)
+{
+    for (const auto& reference : references)
+    {
+        GetEntry(reference).referencedBy.push_back(element);
+    }
+
+    GetEntry(element).references = std::move(references);
+}
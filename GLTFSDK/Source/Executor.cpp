@@ -0,0 +1,100 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/Executor.h>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+using namespace Microsoft::glTF;
+
+void SequentialExecutor::ParallelFor(size_t taskCount, const std::function<void(size_t)>& task) const
+{
+    std::exception_ptr exception;
+
+    // Like ThreadExecutor, the remaining tasks still run after one throws
+    for (size_t i = 0U; i < taskCount; ++i)
+    {
+        try
+        {
+            task(i);
+        }
+        catch (...)
+        {
+            if (!exception)
+            {
+                exception = std::current_exception();
+            }
+        }
+    }
+
+    if (exception)
+    {
+        std::rethrow_exception(exception);
+    }
+}
+
+ThreadExecutor::ThreadExecutor(size_t threadCount) :
+    m_threadCount(threadCount > 0U ? threadCount : std::max<size_t>(1U, std::thread::hardware_concurrency()))
+{
+}
+
+void ThreadExecutor::ParallelFor(size_t taskCount, const std::function<void(size_t)>& task) const
+{
+    std::atomic<size_t> nextTask = 0U;
+
+    std::mutex exceptionMutex;
+    std::exception_ptr exception;
+
+    // Each thread claims the next unclaimed task until there are none left, so threads that are given quick tasks
+    // go on to pick up more of the work
+    auto worker = [&]()
+    {
+        for (size_t i = nextTask++; i < taskCount; i = nextTask++)
+        {
+            try
+            {
+                task(i);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(exceptionMutex);
+
+                if (!exception)
+                {
+                    exception = std::current_exception();
+                }
+            }
+        }
+    };
+
+    {
+        // Threads are joined when they go out of scope. Should starting a thread fail then the threads started so
+        // far, along with the calling thread, complete the remaining tasks.
+        std::vector<std::jthread> threads;
+        threads.reserve(std::min(m_threadCount, taskCount));
+
+        try
+        {
+            for (size_t i = 1U; i < std::min(m_threadCount, taskCount); ++i)
+            {
+                threads.emplace_back(worker);
+            }
+        }
+        catch (const std::system_error&)
+        {
+        }
+
+        worker();
+    }
+
+    if (exception)
+    {
+        std::rethrow_exception(exception);
+    }
+}
@@ -38,17 +38,33 @@ namespace
 }
 
 GLBResourceReader::GLBResourceReader(std::shared_ptr<const IStreamReader> streamReader, std::shared_ptr<std::istream> glbStream)
+    : GLBResourceReader(std::move(streamReader), std::move(glbStream), {})
+{
+}
+
+GLBResourceReader::GLBResourceReader(std::unique_ptr<IStreamReaderCache> streamCache, std::shared_ptr<std::istream> glbStream)
+    : GLBResourceReader(std::move(streamCache), std::move(glbStream), {})
+{
+}
+
+GLBResourceReader::GLBResourceReader(std::shared_ptr<const IStreamReader> streamReader, std::shared_ptr<std::istream> glbStream, std::span<const uint8_t> glbData)
     : GLTFResourceReader(std::move(streamReader)),
+    m_glbData(glbData),
+    m_jsonLength(),
     m_buffer(std::move(glbStream)),
-    m_bufferOffset()
+    m_bufferOffset(),
+    m_bufferLength()
 {
     Init();
 }
 
-GLBResourceReader::GLBResourceReader(std::unique_ptr<IStreamReaderCache> streamCache, std::shared_ptr<std::istream> glbStream)
+GLBResourceReader::GLBResourceReader(std::unique_ptr<IStreamReaderCache> streamCache, std::shared_ptr<std::istream> glbStream, std::span<const uint8_t> glbData)
     : GLTFResourceReader(std::move(streamCache)),
+    m_glbData(glbData),
+    m_jsonLength(),
     m_buffer(std::move(glbStream)),
-    m_bufferOffset()
+    m_bufferOffset(),
+    m_bufferLength()
 {
     Init();
 }
@@ -57,8 +73,7 @@ std::shared_ptr<std::istream> GLBResourceReader::GetBinaryStream(const Buffer& b
 {
     std::shared_ptr<std::istream> stream;
 
-    // We allow "uri": "data:," to refer to a GLB buffer
-    if (buffer.uri.empty() || buffer.uri == EMPTY_URI)
+    if (IsBinaryChunkBuffer(buffer))
     {
         stream = m_buffer;
     }
@@ -74,8 +89,7 @@ std::streampos GLBResourceReader::GetBinaryStreamPos(const Buffer& buffer) const
 {
     std::streampos streamPos;
 
-    // We allow "uri": "data:," to refer to a GLB buffer
-    if (buffer.uri.empty() || buffer.uri == EMPTY_URI)
+    if (IsBinaryChunkBuffer(buffer))
     {
         streamPos = m_bufferOffset;
     }
@@ -87,8 +101,48 @@ std::streampos GLBResourceReader::GetBinaryStreamPos(const Buffer& buffer) const
     return streamPos;
 }
 
+bool GLBResourceReader::HasDefaultBinaryStreams() const
+{
+    return typeid(*this) == typeid(GLBResourceReader);
+}
+
+std::shared_ptr<const IRandomAccessReader> GLBResourceReader::CreateBinaryReader(const Buffer& buffer) const
+{
+    if (IsBinaryChunkBuffer(buffer))
+    {
+        return std::make_shared<StreamRandomAccessReader>(m_buffer, m_bufferOffset);
+    }
+
+    return GLTFResourceReader::CreateBinaryReader(buffer);
+}
+
+bool GLBResourceReader::IsBinaryChunkBuffer(const Buffer& buffer)
+{
+    return buffer.uri.empty() || buffer.uri == EMPTY_URI;
+}
+
 const std::string& GLBResourceReader::GetJson() const
 {
+    if (m_jsonCopy)
+    {
+        std::call_once(m_jsonCopy->onceFlag, [this]()
+        {
+            m_jsonCopy->json = GetJsonChunk();
+        });
+
+        return m_jsonCopy->json;
+    }
+
+    return m_json;
+}
+
+std::string_view GLBResourceReader::GetJsonChunk() const
+{
+    if (m_jsonCopy)
+    {
+        return { reinterpret_cast<const char*>(m_glbData.data()) + GLB_HEADER_BYTE_SIZE, m_jsonLength };
+    }
+
     return m_json;
 }
 
@@ -145,7 +199,21 @@ void GLBResourceReader::Init()
             " plus header length " + std::to_string(GLB_HEADER_BYTE_SIZE));
     }
 
-    m_json = ReadJson(*m_buffer, jsonChunkLength);
+    if (m_glbData.empty())
+    {
+        m_json = ReadJson(*m_buffer, jsonChunkLength);
+    }
+    else
+    {
+        if (m_glbData.size() != length)
+        {
+            throw InvalidGLTFException("GLB data length does not match the GLB stream length");
+        }
+
+        m_jsonCopy = std::make_unique<JsonCopy>();
+        m_jsonLength = jsonChunkLength;
+        m_buffer->seekg(GLB_HEADER_BYTE_SIZE + jsonChunkLength);
+    }
 
     // If length is exactly equal to the json chunk length, plus the header, it means there is no binary buffer chunk
     if (length == (GLB_HEADER_BYTE_SIZE + jsonChunkLength))
@@ -170,4 +238,5 @@ void GLBResourceReader::Init()
     }
 
     m_bufferOffset = m_buffer->tellg();
+    m_bufferLength = bufferChunkLength;
 }
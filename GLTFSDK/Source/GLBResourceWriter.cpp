@@ -3,6 +3,8 @@
 
 #include <GLTFSDK/GLBResourceWriter.h>
 
+#include <GLTFSDK/Serialize.h>
+
 #include <sstream>
 #include <fstream>
 
@@ -19,6 +21,11 @@ namespace
 
         return static_cast<uint32_t>(pad);
     }
+
+    uint32_t CalculatePaddedLength(uint32_t byteLength)
+    {
+        return byteLength + CalculatePadding(byteLength);
+    }
 }
 
 GLBResourceWriter::GLBResourceWriter(std::shared_ptr<const IStreamWriter> streamWriter)
@@ -51,10 +58,7 @@ void GLBResourceWriter::FlushStream(const std::string& manifest, T* stream)
 
     jsonChunkLength += jsonPaddingLength;
 
-    uint32_t binaryChunkLength = static_cast<uint32_t>(GetBufferOffset(GLB_BUFFER_ID));
-    const uint32_t binaryPaddingLength = ::CalculatePadding(binaryChunkLength);
-
-    binaryChunkLength += binaryPaddingLength;
+    const uint32_t binaryChunkLength = ::CalculatePaddedLength(static_cast<uint32_t>(GetBufferOffset(GLB_BUFFER_ID)));
 
     const uint32_t length = GLB_HEADER_BYTE_SIZE // 12 bytes (GLB header) + 8 bytes (JSON header)
         + jsonChunkLength
@@ -80,32 +84,95 @@ void GLBResourceWriter::FlushStream(const std::string& manifest, T* stream)
         StreamUtils::WriteBinary(*stream, std::string(jsonPaddingLength, ' '));
     }
 
+    WriteBinaryChunk(*stream);
+}
+
+template void GLBResourceWriter::FlushStream<std::fstream>(const std::string& manifest, std::fstream* stream);
+template void GLBResourceWriter::FlushStream<std::stringstream>(const std::string& manifest, std::stringstream* stream);
+
+void GLBResourceWriter::Flush(const std::string& manifest, const std::string& uri)
+{
+    auto stream = m_streamWriterCache->Get(uri);
+    this->FlushStream<std::ostream>(manifest, stream.get());
+}
+
+void GLBResourceWriter::FlushStream(const Document& document, std::ostream& stream, bool pPretty)
+{
+    const auto headerPos = stream.tellp();
+
+    if (headerPos == std::ostream::pos_type(-1))
+    {
+        throw GLTFException("Cannot write the GLB to a stream that doesn't support seeking");
+    }
+
+    // Write GLB header (12 bytes) and JSON header (8 bytes), the lengths are patched once the JSON has been written
+    StreamUtils::WriteBinary(stream, GLB_HEADER_MAGIC_STRING, GLB_HEADER_MAGIC_STRING_SIZE);
+    StreamUtils::WriteBinary(stream, GLB_HEADER_VERSION_2);
+    StreamUtils::WriteBinary(stream, uint32_t(0U));
+
+    StreamUtils::WriteBinary(stream, uint32_t(0U));
+    StreamUtils::WriteBinary(stream, GLB_CHUNK_TYPE_JSON, GLB_CHUNK_TYPE_SIZE);
+
+    // Write JSON (indeterminate length)
+    Serializer::Serialize(document, stream, pPretty);
+
+    const auto manifestLength = static_cast<size_t>(stream.tellp() - headerPos) - GLB_HEADER_BYTE_SIZE;
+    const uint32_t jsonPaddingLength = ::CalculatePadding(manifestLength);
+
+    if (jsonPaddingLength > 0)
+    {
+        // GLB spec requires the JSON chunk to be padded with trailing space characters (0x20) to satisfy alignment requirements
+        StreamUtils::WriteBinary(stream, std::string(jsonPaddingLength, ' '));
+    }
+
+    WriteBinaryChunk(stream);
+
+    const auto endPos = stream.tellp();
+
+    const uint32_t jsonChunkLength = static_cast<uint32_t>(manifestLength + jsonPaddingLength);
+    const uint32_t length = static_cast<uint32_t>(endPos - headerPos);
+
+    stream.seekp(headerPos + std::streamoff(GLB_HEADER_MAGIC_STRING_SIZE + sizeof(GLB_HEADER_VERSION_2)));
+    StreamUtils::WriteBinary(stream, length);
+    StreamUtils::WriteBinary(stream, jsonChunkLength);
+    stream.seekp(endPos);
+
+    if (stream.fail())
+    {
+        throw GLTFException("Cannot write the GLB to the stream");
+    }
+}
+
+void GLBResourceWriter::Flush(const Document& document, const std::string& uri, bool pPretty)
+{
+    auto stream = m_streamWriterCache->Get(uri);
+    FlushStream(document, *stream, pPretty);
+}
+
+void GLBResourceWriter::WriteBinaryChunk(std::ostream& stream)
+{
+    uint32_t binaryChunkLength = static_cast<uint32_t>(GetBufferOffset(GLB_BUFFER_ID));
+    const uint32_t binaryPaddingLength = ::CalculatePadding(binaryChunkLength);
+
+    binaryChunkLength += binaryPaddingLength;
+
     // Write BIN header (8 bytes)
-    StreamUtils::WriteBinary(*stream, binaryChunkLength);
-    StreamUtils::WriteBinary(*stream, GLB_CHUNK_TYPE_BIN, GLB_CHUNK_TYPE_SIZE);
+    StreamUtils::WriteBinary(stream, binaryChunkLength);
+    StreamUtils::WriteBinary(stream, GLB_CHUNK_TYPE_BIN, GLB_CHUNK_TYPE_SIZE);
 
     // Write BIN contents (indeterminate length) - copy the temporary buffer's contents to the output stream
     if (binaryChunkLength > 0)
     {
-        *stream << m_stream->rdbuf();
+        stream << m_stream->rdbuf();
     }
 
     if (binaryPaddingLength > 0)
     {
         // GLB spec requires the BIN chunk to be padded with trailing zeros (0x00) to satisfy alignment requirements
-        StreamUtils::WriteBinary(*stream, std::vector<uint8_t>(binaryPaddingLength, 0));
+        StreamUtils::WriteBinary(stream, std::vector<uint8_t>(binaryPaddingLength, 0));
     }
 }
 
-template void GLBResourceWriter::FlushStream<std::fstream>(const std::string& manifest, std::fstream* stream);
-template void GLBResourceWriter::FlushStream<std::stringstream>(const std::string& manifest, std::stringstream* stream);
-
-void GLBResourceWriter::Flush(const std::string& manifest, const std::string& uri)
-{
-    auto stream = m_streamWriterCache->Get(uri);
-    this->FlushStream<std::ostream>(manifest, stream.get());
-}
-
 std::string GLBResourceWriter::GenerateBufferUri(const std::string& bufferId) const
 {
     std::string bufferUri;
@@ -4,53 +4,396 @@
 #include <GLTFSDK/GLTFResourceReader.h>
 #include <GLTFSDK/ResourceReaderUtils.h>
 
+#include <algorithm>
+#include <cstring>
+#include <tuple>
+
 using namespace Microsoft::glTF;
 
 namespace
 {
-    template<typename T>
-    std::vector<float> DecodeToFloats(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
-    {
-        std::vector<T> rawData = reader.ReadBinaryData<T>(doc, accessor);
+    // Ranges separated by no more than this many bytes are merged, as reading the bytes in between (typically
+    // alignment padding or small bufferViews that weren't requested) is cheaper than issuing another read
+    constexpr size_t c_coalesceGapByteLength = 4U * 1024U;
 
-        std::vector<float> floatData;
-        floatData.reserve(rawData.size());
+    // Ranges are only merged while the result is smaller than this, so that a batch of accessors in one large
+    // buffer is still split into reads that can proceed in parallel
+    constexpr size_t c_coalesceMaxByteLength = 16U * 1024U * 1024U;
 
-        if (accessor.normalized)
+    // The size of the chunks of floats that strided accessors are converted in by ReadFloatData
+    constexpr size_t c_floatChunkByteLength = 8U * 1024U;
+
+    // Reads an accessor's raw components, used for accessors that can't be read as part of a merged range
+    void ReadAccessorComponents(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, void* output, size_t outputByteLength, size_t outputByteStride)
+    {
+        switch (accessor.componentType)
         {
-            for (size_t i = 0; i < rawData.size(); ++i)
-                floatData.push_back(ComponentToFloat(rawData[i]));
+        case COMPONENT_BYTE:
+            return reader.ReadBinaryData<int8_t>(doc, accessor, output, outputByteLength, outputByteStride);
+
+        case COMPONENT_UNSIGNED_BYTE:
+            return reader.ReadBinaryData<uint8_t>(doc, accessor, output, outputByteLength, outputByteStride);
+
+        case COMPONENT_SHORT:
+            return reader.ReadBinaryData<int16_t>(doc, accessor, output, outputByteLength, outputByteStride);
+
+        case COMPONENT_UNSIGNED_SHORT:
+            return reader.ReadBinaryData<uint16_t>(doc, accessor, output, outputByteLength, outputByteStride);
+
+        case COMPONENT_UNSIGNED_INT:
+            return reader.ReadBinaryData<uint32_t>(doc, accessor, output, outputByteLength, outputByteStride);
+
+        case COMPONENT_FLOAT:
+            return reader.ReadBinaryData<float>(doc, accessor, output, outputByteLength, outputByteStride);
+
+        default:
+            throw GLTFException("Unsupported accessor ComponentType");
         }
-        else
+    }
+
+    // Reads the raw components of each element into the start of that element's float slot in the
+    // output and then widens them in place. Converting from the last component to the first means
+    // a float is never written over a raw component that hasn't been converted yet.
+    template<typename T>
+    void DecodeToFloats(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, uint8_t* output, size_t outputByteLength, size_t outputByteStride)
+    {
+        static_assert(sizeof(T) <= sizeof(float), "Components must not be wider than a float");
+
+        reader.ReadBinaryData<T>(doc, accessor, output, outputByteLength, outputByteStride);
+
+        const size_t typeCount = Accessor::GetTypeCount(accessor.type);
+
+        for (size_t i = 0U; i < accessor.count; ++i)
         {
-            for (size_t i = 0; i < rawData.size(); ++i)
-                floatData.push_back(static_cast<float>(rawData[i]));
-        }
+            uint8_t* element = output + i * outputByteStride;
+
+            for (size_t j = typeCount; j-- > 0U;)
+            {
+                T rawValue;
+                std::memcpy(&rawValue, element + j * sizeof(T), sizeof(T));
 
-        return floatData;
+                const float floatValue = accessor.normalized ? ComponentToFloat(rawValue) : static_cast<float>(rawValue);
+                std::memcpy(element + j * sizeof(float), &floatValue, sizeof(float));
+            }
+        }
     }
 }
 
 std::vector<float> GLTFResourceReader::ReadFloatData(const Document& gltfDocument, const Accessor& accessor) const
 {
+    if (accessor.componentType == COMPONENT_FLOAT)
+    {
+        return ReadBinaryData<float>(gltfDocument, accessor);
+    }
+
+    std::vector<float> data(accessor.count * Accessor::GetTypeCount(accessor.type));
+    ReadFloatData(gltfDocument, accessor, std::span<float>(data));
+    return data;
+}
+
+void GLTFResourceReader::ReadFloatData(const Document& gltfDocument, const Accessor& accessor, std::span<float> output, size_t outputByteStride) const
+{
+    ReadFloatData(gltfDocument, accessor, output.data(), output.size_bytes(), outputByteStride);
+}
+
+void GLTFResourceReader::ReadFloatData(const Document& gltfDocument, const Accessor& accessor, void* output, size_t outputByteLength, size_t outputByteStride) const
+{
+    // The output must be validated against the size of a float element before any narrower raw components are read
+    const size_t stride = GetOutputByteStride(accessor, sizeof(float) * Accessor::GetTypeCount(accessor.type), outputByteLength, outputByteStride);
+    auto floatOutput = static_cast<uint8_t*>(output);
+
     switch (accessor.componentType)
     {
     case COMPONENT_BYTE:
-        return DecodeToFloats<int8_t>(gltfDocument, *this, accessor);
+        return ReadFloatComponents<int8_t>(gltfDocument, accessor, floatOutput, outputByteLength, stride);
 
     case COMPONENT_UNSIGNED_BYTE:
-        return DecodeToFloats<uint8_t>(gltfDocument, *this, accessor);
+        return ReadFloatComponents<uint8_t>(gltfDocument, accessor, floatOutput, outputByteLength, stride);
 
     case COMPONENT_SHORT:
-        return DecodeToFloats<int16_t>(gltfDocument, *this, accessor);
+        return ReadFloatComponents<int16_t>(gltfDocument, accessor, floatOutput, outputByteLength, stride);
 
     case COMPONENT_UNSIGNED_SHORT:
-        return DecodeToFloats<uint16_t>(gltfDocument, *this, accessor);
+        return ReadFloatComponents<uint16_t>(gltfDocument, accessor, floatOutput, outputByteLength, stride);
 
     case COMPONENT_FLOAT:
-        return ReadBinaryData<float>(gltfDocument, accessor);
+        return ReadBinaryData<float>(gltfDocument, accessor, output, outputByteLength, stride);
 
     default:
         throw GLTFException("Unsupported accessor ComponentType");
     }
 }
+
+std::shared_ptr<const std::vector<float>> GLTFResourceReader::ReadCachedFloatData(const Document& gltfDocument, const Accessor& accessor) const
+{
+    if (!m_accessorCache)
+    {
+        return std::make_shared<const std::vector<float>>(ReadFloatData(gltfDocument, accessor));
+    }
+
+    const auto readerId = m_sharedState->accessorCacheReaderId;
+
+    if (auto data = m_accessorCache->Get<float, AccessorCache::FloatData>(readerId, gltfDocument, accessor))
+    {
+        return data;
+    }
+
+    return m_accessorCache->Set<float, AccessorCache::FloatData>(readerId, gltfDocument, accessor, ReadFloatData(gltfDocument, accessor));
+}
+
+template<typename T>
+void GLTFResourceReader::ReadFloatComponents(const Document& gltfDocument, const Accessor& accessor, uint8_t* output, size_t outputByteLength, size_t outputByteStride) const
+{
+    // Sparse accessors, and those without a bufferView, are assembled in the output before being widened in place
+    if (accessor.sparse.count > 0U || accessor.bufferViewId.empty())
+    {
+        return DecodeToFloats<T>(gltfDocument, *this, accessor, output, outputByteLength, outputByteStride);
+    }
+
+    Validation::ValidateAccessor(gltfDocument, accessor);
+
+    const size_t typeCount = Accessor::GetTypeCount(accessor.type);
+    const size_t elementSize = sizeof(T) * typeCount;
+    const size_t floatElementSize = sizeof(float) * typeCount;
+
+    const BufferView& bufferView = gltfDocument.bufferViews.Get(accessor.bufferViewId);
+    const Buffer& buffer = gltfDocument.buffers.Get(bufferView.bufferId);
+
+    const size_t offset = accessor.byteOffset + bufferView.byteOffset;
+    const size_t stride = bufferView.byteStride ? bufferView.byteStride.Get() : elementSize;
+
+    // Interleaved elements, or a strided output, are packed a chunk at a time so that the conversion kernels can run
+    // over whole chunks. Chunks are small enough for the packed copies to stay in the L1 cache.
+    const size_t chunkElementCount = std::max<size_t>(1U, c_floatChunkByteLength / floatElementSize);
+
+    std::vector<uint8_t> packedComponents;
+    std::vector<uint8_t> packedFloats;
+
+    VisitBinaryData(buffer, offset, accessor.count, elementSize, stride, [&](const uint8_t* source, size_t first, size_t count)
+    {
+        uint8_t* destination = output + first * outputByteStride;
+
+        if (stride == elementSize && outputByteStride == floatElementSize)
+        {
+            ComponentsToFloats<T>(source, destination, count * typeCount, accessor.normalized);
+            return;
+        }
+
+        for (size_t i = 0U; i < count; i += chunkElementCount)
+        {
+            const size_t chunkCount = std::min(chunkElementCount, count - i);
+
+            const uint8_t* components = source + i * stride;
+            uint8_t* floats = destination + i * outputByteStride;
+
+            if (stride != elementSize)
+            {
+                packedComponents.resize(chunkElementCount * elementSize);
+                CopyStrided(components, stride, packedComponents.data(), elementSize, elementSize, chunkCount);
+                components = packedComponents.data();
+            }
+
+            if (outputByteStride != floatElementSize)
+            {
+                packedFloats.resize(chunkElementCount * floatElementSize);
+                floats = packedFloats.data();
+            }
+
+            ComponentsToFloats<T>(components, floats, chunkCount * typeCount, accessor.normalized);
+
+            if (outputByteStride != floatElementSize)
+            {
+                CopyStrided(packedFloats.data(), floatElementSize, destination + i * outputByteStride, outputByteStride, floatElementSize, chunkCount);
+            }
+        }
+    });
+}
+
+void GLTFResourceReader::ReadAccessors(const Document& gltfDocument, std::span<AccessorReadRequest> requests) const
+{
+    ReadAccessors(gltfDocument, requests, SequentialExecutor());
+}
+
+void GLTFResourceReader::ReadAccessors(const Document& gltfDocument, std::span<AccessorReadRequest> requests, const IExecutor& executor) const
+{
+    // Where each accessor's elements are read from and written to
+    struct AccessorPlan
+    {
+        const uint8_t* source = nullptr;
+        size_t         sourceByteStride = 0U;
+
+        uint8_t* output = nullptr;
+        size_t   outputByteLength = 0U;
+        size_t   outputByteStride = 0U;
+
+        size_t elementSize = 0U;
+
+        // Sparse accessors and the like are read individually rather than gathered from a merged range
+        bool isIndividual = false;
+
+        DecodedBufferCache::Data decodedData;
+    };
+
+    // The bytes of a buffer spanned by an accessor's elements
+    struct AccessorRange
+    {
+        const Buffer* buffer;
+        size_t        begin;
+        size_t        end;
+        size_t        requestIndex;
+    };
+
+    // One or more merged AccessorRanges that are read with a single call to ReadAt
+    struct MergedRange
+    {
+        const Buffer* buffer;
+        size_t        begin;
+        size_t        end;
+
+        std::vector<uint8_t> data;
+    };
+
+    std::vector<AccessorPlan> plans(requests.size());
+    std::vector<AccessorRange> ranges;
+
+    for (size_t i = 0U; i < requests.size(); ++i)
+    {
+        auto& request = requests[i];
+        auto& plan = plans[i];
+
+        if (!request.accessor)
+        {
+            throw GLTFException("AccessorReadRequest has no accessor");
+        }
+
+        const Accessor& accessor = *request.accessor;
+
+        Validation::ValidateAccessor(gltfDocument, accessor);
+
+        plan.elementSize = Accessor::GetComponentTypeSize(accessor.componentType) * Accessor::GetTypeCount(accessor.type);
+
+        if (request.output)
+        {
+            plan.output = static_cast<uint8_t*>(request.output);
+            plan.outputByteLength = request.outputByteLength;
+        }
+        else
+        {
+            request.data.resize(accessor.count * plan.elementSize);
+
+            plan.output = request.data.data();
+            plan.outputByteLength = request.data.size();
+        }
+
+        plan.outputByteStride = GetOutputByteStride(accessor, plan.elementSize, plan.outputByteLength, request.outputByteStride);
+
+        if (accessor.sparse.count > 0U || accessor.bufferViewId.empty())
+        {
+            plan.isIndividual = true;
+            continue;
+        }
+
+        if (accessor.count == 0U)
+        {
+            continue;
+        }
+
+        const BufferView& bufferView = gltfDocument.bufferViews.Get(accessor.bufferViewId);
+        const Buffer& buffer = gltfDocument.buffers.Get(bufferView.bufferId);
+
+        const size_t begin = bufferView.byteOffset + accessor.byteOffset;
+
+        plan.sourceByteStride = bufferView.byteStride ? bufferView.byteStride.Get() : plan.elementSize;
+
+        const size_t end = begin + (accessor.count - 1U) * plan.sourceByteStride + plan.elementSize;
+
+        std::string::const_iterator itBegin;
+        std::string::const_iterator itEnd;
+
+        if (IsUriBase64(buffer.uri, itBegin, itEnd))
+        {
+            // Decoded data URIs are already in memory, so there is nothing to merge
+            plan.decodedData = GetDecodedBufferData(buffer, Base64StringView(itBegin, itEnd));
+
+            if (!plan.decodedData)
+            {
+                plan.isIndividual = true;
+            }
+            else if (end > plan.decodedData->size())
+            {
+                throw GLTFException("Accessor " + accessor.id + " data is outside the range of the decoded data URI");
+            }
+            else
+            {
+                plan.source = plan.decodedData->data() + begin;
+            }
+        }
+        else
+        {
+            ranges.push_back({ &buffer, begin, end, i });
+        }
+    }
+
+    std::sort(ranges.begin(), ranges.end(), [](const AccessorRange& lhs, const AccessorRange& rhs)
+    {
+        return std::tie(lhs.buffer->id, lhs.begin, lhs.end) < std::tie(rhs.buffer->id, rhs.begin, rhs.end);
+    });
+
+    std::vector<MergedRange> mergedRanges;
+    std::vector<size_t> mergedRangeIndices(ranges.size());
+
+    for (size_t i = 0U; i < ranges.size(); ++i)
+    {
+        const auto& range = ranges[i];
+
+        if (!mergedRanges.empty())
+        {
+            auto& mergedRange = mergedRanges.back();
+
+            const bool isSameBuffer = mergedRange.buffer->id == range.buffer->id;
+            const bool isClose = range.begin <= mergedRange.end + c_coalesceGapByteLength;
+            const bool isSmall = std::max(mergedRange.end, range.end) - mergedRange.begin <= c_coalesceMaxByteLength;
+
+            if (isSameBuffer && isClose && (isSmall || range.end <= mergedRange.end))
+            {
+                mergedRange.end = std::max(mergedRange.end, range.end);
+                mergedRangeIndices[i] = mergedRanges.size() - 1U;
+                continue;
+            }
+        }
+
+        mergedRanges.push_back({ range.buffer, range.begin, range.end, {} });
+        mergedRangeIndices[i] = mergedRanges.size() - 1U;
+    }
+
+    executor.ParallelFor(mergedRanges.size(), [&](size_t i)
+    {
+        auto& mergedRange = mergedRanges[i];
+
+        mergedRange.data.resize(mergedRange.end - mergedRange.begin);
+
+        GetBinaryReader(*mergedRange.buffer)->ReadAt(mergedRange.begin, mergedRange.data);
+    });
+
+    for (size_t i = 0U; i < ranges.size(); ++i)
+    {
+        const auto& mergedRange = mergedRanges[mergedRangeIndices[i]];
+
+        plans[ranges[i].requestIndex].source = mergedRange.data.data() + (ranges[i].begin - mergedRange.begin);
+    }
+
+    executor.ParallelFor(plans.size(), [&](size_t i)
+    {
+        const auto& plan = plans[i];
+        const Accessor& accessor = *requests[i].accessor;
+
+        if (plan.isIndividual)
+        {
+            ReadAccessorComponents(gltfDocument, *this, accessor, plan.output, plan.outputByteLength, plan.outputByteStride);
+        }
+        else if (plan.source)
+        {
+            CopyStrided(plan.source, plan.sourceByteStride, plan.output, plan.outputByteStride, plan.elementSize, accessor.count);
+        }
+    });
+}
@@ -0,0 +1,101 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/MappedGLBResourceReader.h>
+
+#include <GLTFSDK/MemoryStream.h>
+
+using namespace Microsoft::glTF;
+
+namespace
+{
+    std::shared_ptr<const MemoryMappedFile> MapFile(const std::string& glbPath)
+    {
+        return std::make_shared<const MemoryMappedFile>(glbPath);
+    }
+
+    std::span<const uint8_t> GetData(const std::shared_ptr<const MemoryMappedFile>& glbFile)
+    {
+        if (!glbFile)
+        {
+            throw GLTFException("MemoryMappedFile instance must not be null");
+        }
+
+        return glbFile->GetData();
+    }
+
+    // The returned stream shares ownership of the mapping so that any stream handed out by
+    // GetBinaryStream remains valid after the reader itself is destroyed
+    std::shared_ptr<std::istream> MakeStream(const std::shared_ptr<const MemoryMappedFile>& glbFile)
+    {
+        if (!glbFile)
+        {
+            throw GLTFException("MemoryMappedFile instance must not be null");
+        }
+
+        return std::make_shared<MemoryStream>(glbFile->GetData(), glbFile);
+    }
+}
+
+MappedGLBResourceReader::MappedGLBResourceReader(std::shared_ptr<const IStreamReader> streamReader, const std::string& glbPath)
+    : MappedGLBResourceReader(std::move(streamReader), MapFile(glbPath))
+{
+}
+
+MappedGLBResourceReader::MappedGLBResourceReader(std::unique_ptr<IStreamReaderCache> streamCache, const std::string& glbPath)
+    : MappedGLBResourceReader(std::move(streamCache), MapFile(glbPath))
+{
+}
+
+MappedGLBResourceReader::MappedGLBResourceReader(std::shared_ptr<const IStreamReader> streamReader, std::shared_ptr<const MemoryMappedFile> glbFile)
+    : GLBResourceReader(std::move(streamReader), MakeStream(glbFile), GetData(glbFile)),
+    m_glbFile(std::move(glbFile))
+{
+}
+
+MappedGLBResourceReader::MappedGLBResourceReader(std::unique_ptr<IStreamReaderCache> streamCache, std::shared_ptr<const MemoryMappedFile> glbFile)
+    : GLBResourceReader(std::move(streamCache), MakeStream(glbFile), GetData(glbFile)),
+    m_glbFile(std::move(glbFile))
+{
+}
+
+std::span<const uint8_t> MappedGLBResourceReader::GetBinaryChunk() const
+{
+    return m_glbFile->GetData().subspan(static_cast<size_t>(GetBinaryChunkOffset()), GetBinaryChunkLength());
+}
+
+std::span<const uint8_t> MappedGLBResourceReader::GetBinaryDataView(const Document& document, const BufferView& bufferView) const
+{
+    const Buffer& buffer = document.buffers.Get(bufferView.bufferId);
+
+    if (!IsBinaryChunkBuffer(buffer))
+    {
+        throw GLTFException("BufferView " + bufferView.id + " doesn't reference the GLB binary chunk");
+    }
+
+    Validation::ValidateBufferView(bufferView, buffer);
+
+    const auto binaryChunk = GetBinaryChunk();
+
+    if (bufferView.byteOffset > binaryChunk.size() || bufferView.byteLength > (binaryChunk.size() - bufferView.byteOffset))
+    {
+        throw GLTFException("BufferView " + bufferView.id + " is outside the range of the GLB binary chunk");
+    }
+
+    return binaryChunk.subspan(bufferView.byteOffset, bufferView.byteLength);
+}
+
+bool MappedGLBResourceReader::HasDefaultBinaryStreams() const
+{
+    return typeid(*this) == typeid(MappedGLBResourceReader);
+}
+
+std::shared_ptr<const IRandomAccessReader> MappedGLBResourceReader::CreateBinaryReader(const Buffer& buffer) const
+{
+    if (IsBinaryChunkBuffer(buffer))
+    {
+        return std::make_shared<MemoryRandomAccessReader>(GetBinaryChunk(), m_glbFile);
+    }
+
+    return GLBResourceReader::CreateBinaryReader(buffer);
+}
@@ -0,0 +1,142 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/MemoryMappedFile.h>
+
+#include <GLTFSDK/Exceptions.h>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace Microsoft::glTF;
+
+#ifdef _WIN32
+
+namespace
+{
+    std::wstring ToWideString(const std::string& path)
+    {
+        const int length = MultiByteToWideChar(CP_UTF8, 0, path.c_str(), static_cast<int>(path.size()), nullptr, 0);
+
+        std::wstring result(static_cast<size_t>(length), L'\0');
+        MultiByteToWideChar(CP_UTF8, 0, path.c_str(), static_cast<int>(path.size()), result.data(), length);
+
+        return result;
+    }
+}
+
+MemoryMappedFile::MemoryMappedFile(const std::string& path) : m_data(nullptr), m_size(0U), m_fileMapping(nullptr)
+{
+    HANDLE file = CreateFileW(ToWideString(path).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        throw GLTFException("Unable to open file for mapping: " + path);
+    }
+
+    LARGE_INTEGER fileSize;
+
+    if (!GetFileSizeEx(file, &fileSize))
+    {
+        CloseHandle(file);
+        throw GLTFException("Unable to query the size of file: " + path);
+    }
+
+    m_size = static_cast<size_t>(fileSize.QuadPart);
+
+    // Zero length files can't be mapped, leave m_data as nullptr and expose an empty span instead
+    if (m_size > 0U)
+    {
+        m_fileMapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+        if (m_fileMapping)
+        {
+            m_data = static_cast<const uint8_t*>(MapViewOfFile(m_fileMapping, FILE_MAP_READ, 0, 0, 0));
+        }
+
+        if (!m_data)
+        {
+            if (m_fileMapping)
+            {
+                CloseHandle(m_fileMapping);
+            }
+
+            CloseHandle(file);
+            throw GLTFException("Unable to map file: " + path);
+        }
+    }
+
+    // The mapping holds its own reference to the file
+    CloseHandle(file);
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    if (m_data)
+    {
+        UnmapViewOfFile(m_data);
+    }
+
+    if (m_fileMapping)
+    {
+        CloseHandle(m_fileMapping);
+    }
+}
+
+#else
+
+MemoryMappedFile::MemoryMappedFile(const std::string& path) : m_data(nullptr), m_size(0U)
+{
+    const int fd = open(path.c_str(), O_RDONLY);
+
+    if (fd == -1)
+    {
+        throw GLTFException("Unable to open file for mapping: " + path);
+    }
+
+    struct stat fileStat;
+
+    if (fstat(fd, &fileStat) == -1)
+    {
+        close(fd);
+        throw GLTFException("Unable to query the size of file: " + path);
+    }
+
+    m_size = static_cast<size_t>(fileStat.st_size);
+
+    // Zero length files can't be mapped, leave m_data as nullptr and expose an empty span instead
+    if (m_size > 0U)
+    {
+        void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        if (data == MAP_FAILED)
+        {
+            close(fd);
+            throw GLTFException("Unable to map file: " + path);
+        }
+
+        m_data = static_cast<const uint8_t*>(data);
+    }
+
+    // The mapping holds its own reference to the file
+    close(fd);
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    if (m_data)
+    {
+        munmap(const_cast<uint8_t*>(m_data), m_size);
+    }
+}
+
+#endif
@@ -8,12 +8,86 @@
 #include <GLTFSDK/BufferBuilder.h>
 
 #include <cassert>
+#include <cstring>
 #include <numeric>
 
 using namespace Microsoft::glTF;
 
 namespace
 {
+    void ValidateIndicesAccessor(const Accessor& accessor)
+    {
+        if (accessor.type != TYPE_SCALAR)
+        {
+            throw GLTFException("Invalid type for indices accessor " + accessor.id);
+        }
+    }
+
+    void ValidatePositionsAccessor(const Accessor& positionsAccessor)
+    {
+        if (positionsAccessor.type != TYPE_VEC3)
+        {
+            throw GLTFException("Invalid type for positions accessor " + positionsAccessor.id);
+        }
+
+        if (positionsAccessor.componentType != COMPONENT_FLOAT)
+        {
+            throw GLTFException("Invalid component type for positions accessor " + positionsAccessor.id);
+        }
+    }
+
+    void ValidateNormalsAccessor(const Accessor& normalsAccessor)
+    {
+        if (normalsAccessor.type != TYPE_VEC3)
+        {
+            throw GLTFException("Invalid type for normals accessor " + normalsAccessor.id);
+        }
+
+        if (normalsAccessor.componentType != COMPONENT_FLOAT)
+        {
+            throw GLTFException("Invalid component type for normals accessor " + normalsAccessor.id);
+        }
+    }
+
+    void ValidateTangentsAccessor(const Accessor& tangentsAccessor)
+    {
+        if (tangentsAccessor.type != TYPE_VEC4)
+        {
+            throw GLTFException("Invalid type for tangents accessor " + tangentsAccessor.id);
+        }
+
+        if (tangentsAccessor.componentType != COMPONENT_FLOAT)
+        {
+            throw GLTFException("Invalid component type for tangents accessor " + tangentsAccessor.id);
+        }
+    }
+
+    void ValidateMorphTangentsAccessor(const Accessor& tangentsAccessor)
+    {
+        if (tangentsAccessor.type != TYPE_VEC3)
+        {
+            throw GLTFException("Invalid type for tangents accessor " + tangentsAccessor.id);
+        }
+
+        if (tangentsAccessor.componentType != COMPONENT_FLOAT)
+        {
+            throw GLTFException("Invalid component type for tangents accessor " + tangentsAccessor.id);
+        }
+    }
+
+    void ValidateTexCoordsAccessor(const Accessor& accessor)
+    {
+        if (accessor.type != TYPE_VEC2)
+        {
+            throw GLTFException("Invalid type for texcoords accessor " + accessor.id);
+        }
+
+        if (accessor.componentType != COMPONENT_FLOAT && accessor.componentType != COMPONENT_UNSIGNED_BYTE && accessor.componentType != COMPONENT_UNSIGNED_SHORT)
+        {
+            throw GLTFException("Invalid component type for texcoords accessor " + accessor.id);
+        }
+    }
+
     uint64_t ToUint64(const uint16_t short0, const uint16_t short1, const uint16_t short2, const uint16_t short3)
     {
         return
@@ -50,6 +124,30 @@ namespace
         return std::vector<TOut>(indices.begin(), indices.end());
     }
 
+    // Reads narrower indices into the start of the output and widens them in place. Widening from the
+    // last index to the first means an index is never overwritten before it has been converted.
+    template<typename TIn, typename TOut>
+    void ReadIndicesInto(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, std::span<TOut> output)
+    {
+        static_assert(sizeof(TOut) > sizeof(TIn), "Indices must be widened");
+
+        if (output.size() < accessor.count)
+        {
+            throw GLTFException("Output buffer is too small for indices accessor " + accessor.id);
+        }
+
+        auto outputBytes = reinterpret_cast<uint8_t*>(output.data());
+
+        reader.ReadBinaryData<TIn>(doc, accessor, outputBytes, output.size_bytes());
+
+        for (size_t i = accessor.count; i-- > 0U;)
+        {
+            TIn index;
+            std::memcpy(&index, outputBytes + i * sizeof(TIn), sizeof(TIn));
+            output[i] = index;
+        }
+    }
+
     std::vector<uint32_t> PackColorsRGBA(const std::vector<float>& colors)
     {
         assert(colors.size() % 4 == 0);
@@ -514,10 +612,7 @@ namespace
 
 std::vector<uint16_t> MeshPrimitiveUtils::GetIndices16(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
 {
-    if (accessor.type != TYPE_SCALAR)
-    {
-        throw GLTFException("Invalid type for indices accessor " + accessor.id);
-    }
+    ValidateIndicesAccessor(accessor);
 
     switch (accessor.componentType)
     {
@@ -543,10 +638,7 @@ std::vector<uint16_t> MeshPrimitiveUtils::GetIndices16(const Document& doc, cons
 
 std::vector<uint32_t> MeshPrimitiveUtils::GetIndices32(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
 {
-    if (accessor.type != TYPE_SCALAR)
-    {
-        throw GLTFException("Invalid type for indices accessor " + accessor.id);
-    }
+    ValidateIndicesAccessor(accessor);
 
     switch (accessor.componentType)
     {
@@ -570,6 +662,58 @@ std::vector<uint32_t> MeshPrimitiveUtils::GetIndices32(const Document& doc, cons
     return GetIndices32(doc, reader, accessor);
 }
 
+void MeshPrimitiveUtils::GetIndices16Into(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, std::span<uint16_t> output)
+{
+    ValidateIndicesAccessor(accessor);
+
+    switch (accessor.componentType)
+    {
+    case COMPONENT_UNSIGNED_BYTE:
+        return ReadIndicesInto<uint8_t, uint16_t>(doc, reader, accessor, output);
+
+    case COMPONENT_UNSIGNED_SHORT:
+        return reader.ReadBinaryData<uint16_t>(doc, accessor, output);
+
+    case COMPONENT_UNSIGNED_INT:
+        throw GLTFException("Cannot convert 32-bit indices to 16-bit");
+
+    default:
+        throw GLTFException("Invalid componentType for indices accessor " + accessor.id);
+    }
+}
+
+void MeshPrimitiveUtils::GetIndices16Into(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, std::span<uint16_t> output)
+{
+    const auto& accessor = doc.accessors.Get(meshPrimitive.indicesAccessorId);
+    GetIndices16Into(doc, reader, accessor, output);
+}
+
+void MeshPrimitiveUtils::GetIndices32Into(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, std::span<uint32_t> output)
+{
+    ValidateIndicesAccessor(accessor);
+
+    switch (accessor.componentType)
+    {
+    case COMPONENT_UNSIGNED_BYTE:
+        return ReadIndicesInto<uint8_t, uint32_t>(doc, reader, accessor, output);
+
+    case COMPONENT_UNSIGNED_SHORT:
+        return ReadIndicesInto<uint16_t, uint32_t>(doc, reader, accessor, output);
+
+    case COMPONENT_UNSIGNED_INT:
+        return reader.ReadBinaryData<uint32_t>(doc, accessor, output);
+
+    default:
+        throw GLTFException("Invalid componentType for indices accessor " + accessor.id);
+    }
+}
+
+void MeshPrimitiveUtils::GetIndices32Into(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, std::span<uint32_t> output)
+{
+    const auto& accessor = doc.accessors.Get(meshPrimitive.indicesAccessorId);
+    GetIndices32Into(doc, reader, accessor, output);
+}
+
 std::vector<uint16_t> MeshPrimitiveUtils::GetTriangulatedIndices16(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive)
 {
     return GetTriangulatedIndices<uint16_t>(meshPrimitive.mode, GetOrCreateIndices16(doc, reader, meshPrimitive));
@@ -594,131 +738,174 @@ std::vector<uint32_t> MeshPrimitiveUtils::GetSegmentedIndices32(const Document&
 // Positions
 std::vector<float> MeshPrimitiveUtils::GetPositions(const Document& doc, const GLTFResourceReader& reader, const Accessor& positionsAccessor)
 {
-    if (positionsAccessor.type != TYPE_VEC3)
-    {
-        throw GLTFException("Invalid type for positions accessor " + positionsAccessor.id);
-    }
-
-    if (positionsAccessor.componentType != COMPONENT_FLOAT)
-    {
-        throw GLTFException("Invalid component type for positions accessor " + positionsAccessor.id);
-    }
+    ValidatePositionsAccessor(positionsAccessor);
 
     return reader.ReadFloatData(doc, positionsAccessor);
 }
 
+void MeshPrimitiveUtils::GetPositionsInto(const Document& doc, const GLTFResourceReader& reader, const Accessor& positionsAccessor, std::span<float> output, size_t outputByteStride)
+{
+    ValidatePositionsAccessor(positionsAccessor);
+
+    reader.ReadFloatData(doc, positionsAccessor, output, outputByteStride);
+}
+
 std::vector<float> MeshPrimitiveUtils::GetPositions(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive)
 {
     const auto& positionsAccessor = doc.accessors.Get(meshPrimitive.GetAttributeAccessorId(ACCESSOR_POSITION));
     return GetPositions(doc, reader, positionsAccessor);
 }
 
+void MeshPrimitiveUtils::GetPositionsInto(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, std::span<float> output, size_t outputByteStride)
+{
+    const auto& accessor = doc.accessors.Get(meshPrimitive.GetAttributeAccessorId(ACCESSOR_POSITION));
+    GetPositionsInto(doc, reader, accessor, output, outputByteStride);
+}
+
 std::vector<float> MeshPrimitiveUtils::GetPositions(const Document& doc, const GLTFResourceReader& reader, const MorphTarget& morphTarget)
 {
     const auto& positionsAccessor = doc.accessors.Get(morphTarget.positionsAccessorId);
     return GetPositions(doc, reader, positionsAccessor);
 }
 
+void MeshPrimitiveUtils::GetPositionsInto(const Document& doc, const GLTFResourceReader& reader, const MorphTarget& morphTarget, std::span<float> output, size_t outputByteStride)
+{
+    const auto& accessor = doc.accessors.Get(morphTarget.positionsAccessorId);
+    GetPositionsInto(doc, reader, accessor, output, outputByteStride);
+}
+
 // Normals
 std::vector<float> MeshPrimitiveUtils::GetNormals(const Document& doc, const GLTFResourceReader& reader, const Accessor& normalsAccessor)
 {
-    if (normalsAccessor.type != TYPE_VEC3)
-    {
-        throw GLTFException("Invalid type for normals accessor " + normalsAccessor.id);
-    }
-
-    if (normalsAccessor.componentType != COMPONENT_FLOAT)
-    {
-        throw GLTFException("Invalid component type for normals accessor " + normalsAccessor.id);
-    }
+    ValidateNormalsAccessor(normalsAccessor);
 
     return reader.ReadFloatData(doc, normalsAccessor);
 }
 
+void MeshPrimitiveUtils::GetNormalsInto(const Document& doc, const GLTFResourceReader& reader, const Accessor& normalsAccessor, std::span<float> output, size_t outputByteStride)
+{
+    ValidateNormalsAccessor(normalsAccessor);
+
+    reader.ReadFloatData(doc, normalsAccessor, output, outputByteStride);
+}
+
 std::vector<float> MeshPrimitiveUtils::GetNormals(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive)
 {
     const auto& accessor = doc.accessors.Get(meshPrimitive.GetAttributeAccessorId(ACCESSOR_NORMAL));
     return GetNormals(doc, reader, accessor);
 }
 
+void MeshPrimitiveUtils::GetNormalsInto(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, std::span<float> output, size_t outputByteStride)
+{
+    const auto& accessor = doc.accessors.Get(meshPrimitive.GetAttributeAccessorId(ACCESSOR_NORMAL));
+    GetNormalsInto(doc, reader, accessor, output, outputByteStride);
+}
+
 std::vector<float> MeshPrimitiveUtils::GetNormals(const Document& doc, const GLTFResourceReader& reader, const MorphTarget& morphTarget)
 {
     const auto& accessor = doc.accessors.Get(morphTarget.normalsAccessorId);
     return GetNormals(doc, reader, accessor);
 }
 
+void MeshPrimitiveUtils::GetNormalsInto(const Document& doc, const GLTFResourceReader& reader, const MorphTarget& morphTarget, std::span<float> output, size_t outputByteStride)
+{
+    const auto& accessor = doc.accessors.Get(morphTarget.normalsAccessorId);
+    GetNormalsInto(doc, reader, accessor, output, outputByteStride);
+}
+
 // Tangents
 std::vector<float> MeshPrimitiveUtils::GetTangents(const Document& doc, const GLTFResourceReader& reader, const Accessor& tangentsAccessor)
 {
-    if (tangentsAccessor.type != TYPE_VEC4)
-    {
-        throw GLTFException("Invalid type for tangents accessor " + tangentsAccessor.id);
-    }
-
-    if (tangentsAccessor.componentType != COMPONENT_FLOAT)
-    {
-        throw GLTFException("Invalid component type for tangents accessor " + tangentsAccessor.id);
-    }
+    ValidateTangentsAccessor(tangentsAccessor);
 
     return reader.ReadFloatData(doc, tangentsAccessor);
 }
 
+void MeshPrimitiveUtils::GetTangentsInto(const Document& doc, const GLTFResourceReader& reader, const Accessor& tangentsAccessor, std::span<float> output, size_t outputByteStride)
+{
+    ValidateTangentsAccessor(tangentsAccessor);
+
+    reader.ReadFloatData(doc, tangentsAccessor, output, outputByteStride);
+}
+
 std::vector<float> MeshPrimitiveUtils::GetTangents(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive)
 {
     const auto& accessor = doc.accessors.Get(meshPrimitive.GetAttributeAccessorId(ACCESSOR_TANGENT));
     return GetTangents(doc, reader, accessor);
 }
 
+void MeshPrimitiveUtils::GetTangentsInto(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, std::span<float> output, size_t outputByteStride)
+{
+    const auto& accessor = doc.accessors.Get(meshPrimitive.GetAttributeAccessorId(ACCESSOR_TANGENT));
+    GetTangentsInto(doc, reader, accessor, output, outputByteStride);
+}
+
 // Morph Target Tangents (which have a different accessor type than base mesh tangents)
 std::vector<float> MeshPrimitiveUtils::GetMorphTangents(const Document& doc, const GLTFResourceReader& reader, const Accessor& tangentsAccessor)
 {
-    if (tangentsAccessor.type != TYPE_VEC3)
-    {
-        throw GLTFException("Invalid type for tangents accessor " + tangentsAccessor.id);
-    }
-
-    if (tangentsAccessor.componentType != COMPONENT_FLOAT)
-    {
-        throw GLTFException("Invalid component type for tangents accessor " + tangentsAccessor.id);
-    }
+    ValidateMorphTangentsAccessor(tangentsAccessor);
 
     return reader.ReadFloatData(doc, tangentsAccessor);
 }
 
+void MeshPrimitiveUtils::GetMorphTangentsInto(const Document& doc, const GLTFResourceReader& reader, const Accessor& tangentsAccessor, std::span<float> output, size_t outputByteStride)
+{
+    ValidateMorphTangentsAccessor(tangentsAccessor);
+
+    reader.ReadFloatData(doc, tangentsAccessor, output, outputByteStride);
+}
+
 std::vector<float> MeshPrimitiveUtils::GetTangents(const Document& doc, const GLTFResourceReader& reader, const MorphTarget& morphTarget)
 {
     const auto& accessor = doc.accessors.Get(morphTarget.tangentsAccessorId);
     return GetMorphTangents(doc, reader, accessor);
 }
 
+void MeshPrimitiveUtils::GetTangentsInto(const Document& doc, const GLTFResourceReader& reader, const MorphTarget& morphTarget, std::span<float> output, size_t outputByteStride)
+{
+    const auto& accessor = doc.accessors.Get(morphTarget.tangentsAccessorId);
+    GetMorphTangentsInto(doc, reader, accessor, output, outputByteStride);
+}
+
 // Texcoords
 std::vector<float> MeshPrimitiveUtils::GetTexCoords(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
 {
-    if (accessor.type != TYPE_VEC2)
-    {
-        throw GLTFException("Invalid type for texcoords accessor " + accessor.id);
-    }
-
-    if (accessor.componentType != COMPONENT_FLOAT && accessor.componentType != COMPONENT_UNSIGNED_BYTE && accessor.componentType != COMPONENT_UNSIGNED_SHORT)
-    {
-        throw GLTFException("Invalid component type for texcoords accessor " + accessor.id);
-    }
+    ValidateTexCoordsAccessor(accessor);
 
     return reader.ReadFloatData(doc, accessor);
 }
 
+void MeshPrimitiveUtils::GetTexCoordsInto(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, std::span<float> output, size_t outputByteStride)
+{
+    ValidateTexCoordsAccessor(accessor);
+
+    reader.ReadFloatData(doc, accessor, output, outputByteStride);
+}
+
 std::vector<float> MeshPrimitiveUtils::GetTexCoords_0(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive)
 {
     const auto& accessor = doc.accessors.Get(meshPrimitive.GetAttributeAccessorId(ACCESSOR_TEXCOORD_0));
     return GetTexCoords(doc, reader, accessor);
 }
 
+void MeshPrimitiveUtils::GetTexCoordsInto_0(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, std::span<float> output, size_t outputByteStride)
+{
+    const auto& accessor = doc.accessors.Get(meshPrimitive.GetAttributeAccessorId(ACCESSOR_TEXCOORD_0));
+    GetTexCoordsInto(doc, reader, accessor, output, outputByteStride);
+}
+
 std::vector<float> MeshPrimitiveUtils::GetTexCoords_1(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive)
 {
     const auto& accessor = doc.accessors.Get(meshPrimitive.GetAttributeAccessorId(ACCESSOR_TEXCOORD_1));
     return GetTexCoords(doc, reader, accessor);
 }
 
+void MeshPrimitiveUtils::GetTexCoordsInto_1(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, std::span<float> output, size_t outputByteStride)
+{
+    const auto& accessor = doc.accessors.Get(meshPrimitive.GetAttributeAccessorId(ACCESSOR_TEXCOORD_1));
+    GetTexCoordsInto(doc, reader, accessor, output, outputByteStride);
+}
+
 // Colors
 std::vector<uint32_t> MeshPrimitiveUtils::GetColors(const Document& doc, const GLTFResourceReader& reader, const Accessor& colorsAccessor)
 {
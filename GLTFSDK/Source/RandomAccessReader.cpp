@@ -0,0 +1,210 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/RandomAccessReader.h>
+
+#include <GLTFSDK/Exceptions.h>
+#include <GLTFSDK/StreamUtils.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace Microsoft::glTF;
+
+namespace
+{
+    void ValidateRange(uint64_t offset, size_t byteLength, uint64_t size)
+    {
+        if (offset > size || byteLength > (size - offset))
+        {
+            throw GLTFException("Read of " + std::to_string(byteLength) + " bytes at offset " + std::to_string(offset) + " is outside the range of the resource");
+        }
+    }
+
+#ifdef _WIN32
+    std::wstring ToWideString(const std::string& path)
+    {
+        const int length = MultiByteToWideChar(CP_UTF8, 0, path.c_str(), static_cast<int>(path.size()), nullptr, 0);
+
+        std::wstring result(static_cast<size_t>(length), L'\0');
+        MultiByteToWideChar(CP_UTF8, 0, path.c_str(), static_cast<int>(path.size()), result.data(), length);
+
+        return result;
+    }
+#endif
+}
+
+MemoryRandomAccessReader::MemoryRandomAccessReader(std::span<const uint8_t> data, std::shared_ptr<const void> owner) :
+    m_owner(std::move(owner)),
+    m_data(data)
+{
+}
+
+void MemoryRandomAccessReader::ReadAt(uint64_t offset, std::span<uint8_t> data) const
+{
+    ValidateRange(offset, data.size(), m_data.size());
+
+    if (!data.empty())
+    {
+        std::memcpy(data.data(), m_data.data() + offset, data.size());
+    }
+}
+
+uint64_t MemoryRandomAccessReader::GetSize() const
+{
+    return m_data.size();
+}
+
+#ifdef _WIN32
+
+FileRandomAccessReader::FileRandomAccessReader(const std::string& path) : m_file(nullptr), m_size(0U)
+{
+    HANDLE file = CreateFileW(ToWideString(path).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        throw GLTFException("Unable to open file: " + path);
+    }
+
+    LARGE_INTEGER fileSize;
+
+    if (!GetFileSizeEx(file, &fileSize))
+    {
+        CloseHandle(file);
+        throw GLTFException("Unable to query the size of file: " + path);
+    }
+
+    m_file = file;
+    m_size = static_cast<uint64_t>(fileSize.QuadPart);
+}
+
+FileRandomAccessReader::~FileRandomAccessReader()
+{
+    CloseHandle(m_file);
+}
+
+void FileRandomAccessReader::ReadAt(uint64_t offset, std::span<uint8_t> data) const
+{
+    ValidateRange(offset, data.size(), m_size);
+
+    while (!data.empty())
+    {
+        // Specifying the offset via an OVERLAPPED structure makes each read independent of the file pointer
+        OVERLAPPED overlapped = {};
+        overlapped.Offset = static_cast<DWORD>(offset);
+        overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32U);
+
+        const DWORD byteCount = static_cast<DWORD>(std::min<size_t>(data.size(), std::numeric_limits<DWORD>::max()));
+        DWORD bytesRead = 0U;
+
+        if (!ReadFile(m_file, data.data(), byteCount, &bytesRead, &overlapped) || bytesRead == 0U)
+        {
+            throw GLTFException("Unable to read " + std::to_string(data.size()) + " bytes at offset " + std::to_string(offset));
+        }
+
+        offset += bytesRead;
+        data = data.subspan(bytesRead);
+    }
+}
+
+#else
+
+FileRandomAccessReader::FileRandomAccessReader(const std::string& path) : m_file(-1), m_size(0U)
+{
+    const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+    if (fd == -1)
+    {
+        throw GLTFException("Unable to open file: " + path);
+    }
+
+    struct stat fileStat;
+
+    if (fstat(fd, &fileStat) == -1)
+    {
+        close(fd);
+        throw GLTFException("Unable to query the size of file: " + path);
+    }
+
+    m_file = fd;
+    m_size = static_cast<uint64_t>(fileStat.st_size);
+}
+
+FileRandomAccessReader::~FileRandomAccessReader()
+{
+    close(m_file);
+}
+
+void FileRandomAccessReader::ReadAt(uint64_t offset, std::span<uint8_t> data) const
+{
+    ValidateRange(offset, data.size(), m_size);
+
+    // pread may return fewer bytes than requested so keep reading until the span is full
+    while (!data.empty())
+    {
+        const ssize_t bytesRead = pread(m_file, data.data(), data.size(), static_cast<off_t>(offset));
+
+        if (bytesRead == -1 && errno == EINTR)
+        {
+            continue;
+        }
+
+        if (bytesRead <= 0)
+        {
+            throw GLTFException("Unable to read " + std::to_string(data.size()) + " bytes at offset " + std::to_string(offset));
+        }
+
+        offset += static_cast<uint64_t>(bytesRead);
+        data = data.subspan(static_cast<size_t>(bytesRead));
+    }
+}
+
+#endif
+
+uint64_t FileRandomAccessReader::GetSize() const
+{
+    return m_size;
+}
+
+StreamRandomAccessReader::StreamRandomAccessReader(std::shared_ptr<std::istream> stream, std::streampos streamPos) :
+    m_stream(std::move(stream)),
+    m_streamPos(streamPos)
+{
+    if (!m_stream)
+    {
+        throw GLTFException("Stream must not be null");
+    }
+}
+
+void StreamRandomAccessReader::ReadAt(uint64_t offset, std::span<uint8_t> data) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_stream->seekg(m_streamPos + static_cast<std::streamoff>(offset));
+
+    StreamUtils::ReadBinary(*m_stream, reinterpret_cast<char*>(data.data()), data.size());
+}
+
+uint64_t StreamRandomAccessReader::GetSize() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_stream->seekg(0, std::ios::end);
+
+    const std::streamoff size = m_stream->tellg() - m_streamPos;
+
+    return size > 0 ? static_cast<uint64_t>(size) : 0U;
+}
@@ -0,0 +1,796 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/ResourceReaderUtils.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+#if defined(_M_X64) || defined(__x86_64__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define GLTFSDK_SIMD_SSE2
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define GLTFSDK_TARGET_SSSE3
+#define GLTFSDK_TARGET_AVX2
+#else
+#define GLTFSDK_TARGET_SSSE3 __attribute__((target("ssse3")))
+#define GLTFSDK_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define GLTFSDK_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+using namespace Microsoft::glTF;
+
+namespace
+{
+#ifdef GLTFSDK_SIMD_SSE2
+    struct CPUFeatures
+    {
+        bool isSSSE3Supported;
+        bool isAVX2Supported;
+    };
+
+    CPUFeatures GetCPUFeatures()
+    {
+#ifdef _MSC_VER
+        int info[4];
+
+        __cpuid(info, 0);
+
+        const int maxFunctionId = info[0];
+
+        __cpuid(info, 1);
+
+        const bool isSSSE3Supported = (info[2] & (1 << 9)) != 0;
+
+        // The OS must have enabled saving the YMM registers (OSXSAVE + XCR0 bits 1 and 2) as well as the CPU supporting AVX
+        const bool isAVXSupported = (info[2] & (1 << 27)) && (info[2] & (1 << 28)) && ((_xgetbv(0) & 0x6) == 0x6);
+
+        bool isAVX2Supported = false;
+
+        if (isAVXSupported && maxFunctionId >= 7)
+        {
+            __cpuidex(info, 7, 0);
+            isAVX2Supported = (info[1] & (1 << 5)) != 0;
+        }
+
+        return { isSSSE3Supported, isAVX2Supported };
+#else
+        return { __builtin_cpu_supports("ssse3") != 0, __builtin_cpu_supports("avx2") != 0 };
+#endif
+    }
+
+    const CPUFeatures& GetSupportedCPUFeatures()
+    {
+        static const CPUFeatures features = GetCPUFeatures();
+        return features;
+    }
+#endif
+
+    template<size_t ElementSize>
+    void CopyStridedScalar(const uint8_t* source, size_t sourceStride, uint8_t* destination, size_t destinationStride, size_t elementCount)
+    {
+        for (size_t i = 0U; i < elementCount; ++i)
+        {
+            std::memcpy(destination + i * destinationStride, source + i * sourceStride, ElementSize);
+        }
+    }
+
+    void CopyStridedScalar(const uint8_t* source, size_t sourceStride, uint8_t* destination, size_t destinationStride, size_t elementSize, size_t elementCount)
+    {
+        // A fixed size memcpy compiles down to a handful of moves for the common element sizes
+        switch (elementSize)
+        {
+        case 1U:
+            return CopyStridedScalar<1U>(source, sourceStride, destination, destinationStride, elementCount);
+        case 2U:
+            return CopyStridedScalar<2U>(source, sourceStride, destination, destinationStride, elementCount);
+        case 4U:
+            return CopyStridedScalar<4U>(source, sourceStride, destination, destinationStride, elementCount);
+        case 8U:
+            return CopyStridedScalar<8U>(source, sourceStride, destination, destinationStride, elementCount);
+        case 12U:
+            return CopyStridedScalar<12U>(source, sourceStride, destination, destinationStride, elementCount);
+        case 16U:
+            return CopyStridedScalar<16U>(source, sourceStride, destination, destinationStride, elementCount);
+        }
+
+        for (size_t i = 0U; i < elementCount; ++i)
+        {
+            std::memcpy(destination + i * destinationStride, source + i * sourceStride, elementSize);
+        }
+    }
+
+    // The number of leading elements that can be copied with loads and stores that are Width bytes wide.
+    // When an element is narrower than Width each store spills into the next element of the tightly packed
+    // destination (which is rewritten by the following iteration) and each load reads past the end of the
+    // element, so the trailing elements whose wide loads or stores would fall outside the source or
+    // destination must be copied by the scalar loop instead.
+    template<size_t Width>
+    size_t GetWideCopyCount(size_t elementSize, size_t elementCount)
+    {
+        const size_t overrun = Width - elementSize;
+        const size_t tailCount = (overrun > 0U) ? 1U + (overrun + elementSize - 1U) / elementSize : 0U;
+
+        return (elementCount > tailCount) ? elementCount - tailCount : 0U;
+    }
+
+#ifdef GLTFSDK_SIMD_SSE2
+    void CopyStrided16(const uint8_t* source, size_t sourceStride, uint8_t* destination, size_t destinationStride, size_t elementCount)
+    {
+        for (size_t i = 0U; i < elementCount; ++i)
+        {
+            const __m128i element = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i * sourceStride));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i * destinationStride), element);
+        }
+    }
+
+    GLTFSDK_TARGET_AVX2 void CopyStrided32(const uint8_t* source, size_t sourceStride, uint8_t* destination, size_t destinationStride, size_t elementCount)
+    {
+        for (size_t i = 0U; i < elementCount; ++i)
+        {
+            const __m256i element = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i * sourceStride));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i * destinationStride), element);
+        }
+    }
+
+    // Gathers 8 strided 4 byte elements (e.g. a single float attribute) per iteration into a tightly packed destination
+    GLTFSDK_TARGET_AVX2 size_t GatherPacked4(const uint8_t* source, size_t sourceStride, uint8_t* destination, size_t elementCount)
+    {
+        const int stride = static_cast<int>(sourceStride);
+        const __m256i offsets = _mm256_setr_epi32(0, stride, 2 * stride, 3 * stride, 4 * stride, 5 * stride, 6 * stride, 7 * stride);
+
+        size_t i = 0U;
+
+        for (; i + 8U <= elementCount; i += 8U)
+        {
+            const __m256i elements = _mm256_i32gather_epi32(reinterpret_cast<const int*>(source + i * sourceStride), offsets, 1);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i * 4U), elements);
+        }
+
+        return i;
+    }
+
+    // Gathers 4 strided 8 byte elements (e.g. a VEC2 float attribute) per iteration into a tightly packed destination
+    GLTFSDK_TARGET_AVX2 size_t GatherPacked8(const uint8_t* source, size_t sourceStride, uint8_t* destination, size_t elementCount)
+    {
+        const int stride = static_cast<int>(sourceStride);
+        const __m128i offsets = _mm_setr_epi32(0, stride, 2 * stride, 3 * stride);
+
+        size_t i = 0U;
+
+        for (; i + 4U <= elementCount; i += 4U)
+        {
+            const __m256i elements = _mm256_i32gather_epi64(reinterpret_cast<const long long*>(source + i * sourceStride), offsets, 1);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i * 8U), elements);
+        }
+
+        return i;
+    }
+#endif
+
+#ifdef GLTFSDK_SIMD_NEON
+    void CopyStrided16(const uint8_t* source, size_t sourceStride, uint8_t* destination, size_t destinationStride, size_t elementCount)
+    {
+        for (size_t i = 0U; i < elementCount; ++i)
+        {
+            vst1q_u8(destination + i * destinationStride, vld1q_u8(source + i * sourceStride));
+        }
+    }
+#endif
+
+    // Copies as many leading elements as possible with a vector kernel and returns the number copied
+    size_t CopyStridedVector(const uint8_t* source, size_t sourceStride, uint8_t* destination, size_t destinationStride, size_t elementSize, size_t elementCount)
+    {
+        // Wide loads rely on consecutive source elements not overlapping
+        if (sourceStride < elementSize)
+        {
+            return 0U;
+        }
+
+        const bool isPacked = (destinationStride == elementSize);
+
+#ifdef GLTFSDK_SIMD_SSE2
+        const bool isAVX2Supported = GetSupportedCPUFeatures().isAVX2Supported;
+
+        // The gather offsets are 32-bit so the stride must be small enough for 8 elements to fit
+        if (isAVX2Supported && isPacked && sourceStride <= (INT32_MAX / 8))
+        {
+            if (elementSize == 4U)
+            {
+                return GatherPacked4(source, sourceStride, destination, elementCount);
+            }
+
+            if (elementSize == 8U)
+            {
+                return GatherPacked8(source, sourceStride, destination, elementCount);
+            }
+        }
+
+        if (isAVX2Supported && elementSize > 16U && elementSize <= 32U && (isPacked || elementSize == 32U))
+        {
+            const size_t count = (elementSize == 32U) ? elementCount : GetWideCopyCount<32U>(elementSize, elementCount);
+            CopyStrided32(source, sourceStride, destination, destinationStride, count);
+            return count;
+        }
+#endif
+
+#if defined(GLTFSDK_SIMD_SSE2) || defined(GLTFSDK_SIMD_NEON)
+        if (elementSize > 8U && elementSize <= 16U && (isPacked || elementSize == 16U))
+        {
+            const size_t count = (elementSize == 16U) ? elementCount : GetWideCopyCount<16U>(elementSize, elementCount);
+            CopyStrided16(source, sourceStride, destination, destinationStride, count);
+            return count;
+        }
+#else
+        (void)source;
+        (void)sourceStride;
+        (void)destination;
+        (void)isPacked;
+#endif
+
+        return 0U;
+    }
+
+    // Base64 decoding
+
+    using Base64DecodeTable = std::array<uint8_t, 256>;
+
+    // Extends GetDecodeTable to cover every possible char value so that lookups never need a range check
+    Base64DecodeTable GetFullDecodeTable()
+    {
+        Base64DecodeTable decodeTable;
+        decodeTable.fill(std::numeric_limits<uint8_t>::max());
+
+        const auto asciiDecodeTable = GetDecodeTable();
+        std::copy(asciiDecodeTable.begin(), asciiDecodeTable.end(), decodeTable.begin());
+
+        return decodeTable;
+    }
+
+    uint32_t DecodeBase64Char(const Base64DecodeTable& decodeTable, char encodedChar)
+    {
+        const uint8_t decodedChar = decodeTable[static_cast<uint8_t>(encodedChar)];
+
+        if (decodedChar == std::numeric_limits<uint8_t>::max())
+        {
+            throw GLTFException("Invalid base64 character");
+        }
+
+        return decodedChar;
+    }
+
+    // Decodes a group of up to 4 characters into up to 3 bytes, returning the number of bytes decoded
+    size_t DecodeBase64Group(const Base64DecodeTable& decodeTable, const char* encoded, size_t charCount, uint8_t* decoded)
+    {
+        uint32_t block = 0U;
+
+        for (size_t i = 0U; i < charCount; ++i)
+        {
+            block |= DecodeBase64Char(decodeTable, encoded[i]) << (18U - 6U * i);
+        }
+
+        // Any bits of a trailing partial group that don't make up a whole byte are discarded
+        const size_t byteCount = (charCount * 6U) / 8U;
+
+        for (size_t i = 0U; i < byteCount; ++i)
+        {
+            decoded[i] = static_cast<uint8_t>(block >> (16U - 8U * i));
+        }
+
+        return byteCount;
+    }
+
+#ifdef GLTFSDK_SIMD_SSE2
+    // Translates 16 base64 characters to their 6-bit values. Characters outside of the base64 alphabet (including
+    // any with the high bit set, which compare as negative) are reported via the returned movemask being != 0xFFFF.
+    GLTFSDK_TARGET_SSSE3 int TranslateBase64(__m128i encoded, __m128i& decoded)
+    {
+        const __m128i isUpper = _mm_and_si128(_mm_cmpgt_epi8(encoded, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(encoded, _mm_set1_epi8('Z' + 1)));
+        const __m128i isLower = _mm_and_si128(_mm_cmpgt_epi8(encoded, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(encoded, _mm_set1_epi8('z' + 1)));
+        const __m128i isDigit = _mm_and_si128(_mm_cmpgt_epi8(encoded, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(encoded, _mm_set1_epi8('9' + 1)));
+        const __m128i isPlus = _mm_cmpeq_epi8(encoded, _mm_set1_epi8('+'));
+        const __m128i isSlash = _mm_cmpeq_epi8(encoded, _mm_set1_epi8('/'));
+
+        const __m128i isValid = _mm_or_si128(_mm_or_si128(_mm_or_si128(isUpper, isLower), _mm_or_si128(isDigit, isPlus)), isSlash);
+
+        __m128i shift = _mm_and_si128(isUpper, _mm_set1_epi8(-'A'));
+        shift = _mm_or_si128(shift, _mm_and_si128(isLower, _mm_set1_epi8(26 - 'a')));
+        shift = _mm_or_si128(shift, _mm_and_si128(isDigit, _mm_set1_epi8(52 - '0')));
+        shift = _mm_or_si128(shift, _mm_and_si128(isPlus, _mm_set1_epi8(62 - '+')));
+        shift = _mm_or_si128(shift, _mm_and_si128(isSlash, _mm_set1_epi8(63 - '/')));
+
+        decoded = _mm_add_epi8(encoded, shift);
+
+        return _mm_movemask_epi8(isValid);
+    }
+
+    // Packs each group of 4 6-bit values into 3 bytes stored in the low 12 bytes of the result
+    GLTFSDK_TARGET_SSSE3 __m128i PackBase64(__m128i decoded)
+    {
+        // [a, b, c, d] => [a << 6 | b, c << 6 | d] => [a << 18 | b << 12 | c << 6 | d]
+        const __m128i pairs = _mm_maddubs_epi16(decoded, _mm_set1_epi32(0x01400140));
+        const __m128i groups = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+
+        // Each 32-bit group is little-endian so reverse its 3 low bytes into output order
+        return _mm_shuffle_epi8(groups, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+    }
+
+    // Decodes 4 groups per iteration. Each store writes 16 bytes of which only 12 are decoded data, so the loop stops
+    // while there is still room for a whole store. Returns the number of groups decoded, which is less than
+    // groupCount if an invalid character is found or the end of the output is reached.
+    GLTFSDK_TARGET_SSSE3 size_t DecodeBase64SSSE3(const char* encoded, size_t groupCount, uint8_t* decoded, size_t decodedCapacity)
+    {
+        size_t i = 0U;
+
+        for (; i + 4U <= groupCount && i * 3U + 16U <= decodedCapacity; i += 4U)
+        {
+            __m128i values;
+
+            if (TranslateBase64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(encoded + i * 4U)), values) != 0xFFFF)
+            {
+                break;
+            }
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(decoded + i * 3U), PackBase64(values));
+        }
+
+        return i;
+    }
+
+    // The AVX2 equivalent of DecodeBase64SSSE3, decoding 8 groups per iteration with 32 byte stores
+    GLTFSDK_TARGET_AVX2 size_t DecodeBase64AVX2(const char* encoded, size_t groupCount, uint8_t* decoded, size_t decodedCapacity)
+    {
+        size_t i = 0U;
+
+        for (; i + 8U <= groupCount && i * 3U + 32U <= decodedCapacity; i += 8U)
+        {
+            const __m256i chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(encoded + i * 4U));
+
+            const __m256i isUpper = _mm256_and_si256(_mm256_cmpgt_epi8(chars, _mm256_set1_epi8('A' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), chars));
+            const __m256i isLower = _mm256_and_si256(_mm256_cmpgt_epi8(chars, _mm256_set1_epi8('a' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), chars));
+            const __m256i isDigit = _mm256_and_si256(_mm256_cmpgt_epi8(chars, _mm256_set1_epi8('0' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), chars));
+            const __m256i isPlus = _mm256_cmpeq_epi8(chars, _mm256_set1_epi8('+'));
+            const __m256i isSlash = _mm256_cmpeq_epi8(chars, _mm256_set1_epi8('/'));
+
+            const __m256i isValid = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(isUpper, isLower), _mm256_or_si256(isDigit, isPlus)), isSlash);
+
+            if (_mm256_movemask_epi8(isValid) != -1)
+            {
+                break;
+            }
+
+            __m256i shift = _mm256_and_si256(isUpper, _mm256_set1_epi8(-'A'));
+            shift = _mm256_or_si256(shift, _mm256_and_si256(isLower, _mm256_set1_epi8(26 - 'a')));
+            shift = _mm256_or_si256(shift, _mm256_and_si256(isDigit, _mm256_set1_epi8(52 - '0')));
+            shift = _mm256_or_si256(shift, _mm256_and_si256(isPlus, _mm256_set1_epi8(62 - '+')));
+            shift = _mm256_or_si256(shift, _mm256_and_si256(isSlash, _mm256_set1_epi8(63 - '/')));
+
+            const __m256i values = _mm256_add_epi8(chars, shift);
+
+            const __m256i pairs = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+            const __m256i groups = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+
+            // The byte shuffle works within each 128-bit lane, leaving 12 bytes at the start of each lane which the
+            // cross-lane permute then moves next to each other
+            const __m256i lanes = _mm256_shuffle_epi8(groups, _mm256_setr_epi8(
+                2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+            const __m256i packed = _mm256_permutevar8x32_epi32(lanes, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(decoded + i * 3U), packed);
+        }
+
+        return i;
+    }
+#endif
+
+#if defined(GLTFSDK_SIMD_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+    uint8x16_t InRange(uint8x16_t chars, uint8_t first, uint8_t last)
+    {
+        return vandq_u8(vcgeq_u8(chars, vdupq_n_u8(first)), vcleq_u8(chars, vdupq_n_u8(last)));
+    }
+
+    // Translates 16 base64 characters to their 6-bit values, returning false if any aren't in the base64 alphabet
+    bool TranslateBase64(uint8x16_t chars, uint8x16_t& decoded)
+    {
+        const uint8x16_t isUpper = InRange(chars, 'A', 'Z');
+        const uint8x16_t isLower = InRange(chars, 'a', 'z');
+        const uint8x16_t isDigit = InRange(chars, '0', '9');
+        const uint8x16_t isPlus = vceqq_u8(chars, vdupq_n_u8('+'));
+        const uint8x16_t isSlash = vceqq_u8(chars, vdupq_n_u8('/'));
+
+        const uint8x16_t isValid = vorrq_u8(vorrq_u8(vorrq_u8(isUpper, isLower), vorrq_u8(isDigit, isPlus)), isSlash);
+
+        uint8x16_t shift = vandq_u8(isUpper, vdupq_n_u8(static_cast<uint8_t>(-'A')));
+        shift = vorrq_u8(shift, vandq_u8(isLower, vdupq_n_u8(static_cast<uint8_t>(26 - 'a'))));
+        shift = vorrq_u8(shift, vandq_u8(isDigit, vdupq_n_u8(static_cast<uint8_t>(52 - '0'))));
+        shift = vorrq_u8(shift, vandq_u8(isPlus, vdupq_n_u8(static_cast<uint8_t>(62 - '+'))));
+        shift = vorrq_u8(shift, vandq_u8(isSlash, vdupq_n_u8(static_cast<uint8_t>(63 - '/'))));
+
+        decoded = vaddq_u8(chars, shift);
+
+        return vminvq_u8(isValid) == 0xFF;
+    }
+
+    // Decodes 16 groups per iteration: the structured load splits the characters by their position within each
+    // group and the structured store interleaves the 3 output bytes of each group, so nothing is written past the
+    // decoded data
+    size_t DecodeBase64NEON(const char* encoded, size_t groupCount, uint8_t* decoded, size_t)
+    {
+        size_t i = 0U;
+
+        for (; i + 16U <= groupCount; i += 16U)
+        {
+            const uint8x16x4_t chars = vld4q_u8(reinterpret_cast<const uint8_t*>(encoded + i * 4U));
+
+            uint8x16_t a, b, c, d;
+
+            if (!TranslateBase64(chars.val[0], a) || !TranslateBase64(chars.val[1], b) || !TranslateBase64(chars.val[2], c) || !TranslateBase64(chars.val[3], d))
+            {
+                break;
+            }
+
+            uint8x16x3_t bytes;
+            bytes.val[0] = vorrq_u8(vshlq_n_u8(a, 2), vshrq_n_u8(b, 4));
+            bytes.val[1] = vorrq_u8(vshlq_n_u8(b, 4), vshrq_n_u8(c, 2));
+            bytes.val[2] = vorrq_u8(vshlq_n_u8(c, 6), d);
+
+            vst3q_u8(decoded + i * 3U, bytes);
+        }
+
+        return i;
+    }
+#endif
+
+    // Decodes as many leading groups as possible with the fastest kernels the CPU supports, returns the number decoded
+    size_t DecodeBase64Vector(const char* encoded, size_t groupCount, uint8_t* decoded, size_t decodedCapacity)
+    {
+        size_t i = 0U;
+
+#ifdef GLTFSDK_SIMD_SSE2
+        const auto& features = GetSupportedCPUFeatures();
+
+        if (features.isAVX2Supported)
+        {
+            i = DecodeBase64AVX2(encoded, groupCount, decoded, decodedCapacity);
+        }
+
+        if (features.isSSSE3Supported)
+        {
+            i += DecodeBase64SSSE3(encoded + i * 4U, groupCount - i, decoded + i * 3U, decodedCapacity - i * 3U);
+        }
+#elif defined(GLTFSDK_SIMD_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+        i = DecodeBase64NEON(encoded, groupCount, decoded, decodedCapacity);
+#else
+        (void)encoded;
+        (void)groupCount;
+        (void)decoded;
+        (void)decodedCapacity;
+#endif
+
+        return i;
+    }
+
+    // The divisor the 2.0 spec uses to normalize each component type, i.e. the type's maximum value
+    template<typename T>
+    constexpr float c_normalizationScale = static_cast<float>(std::numeric_limits<T>::max());
+
+#ifdef GLTFSDK_SIMD_SSE2
+    // Loads 4 components and widens them to 32-bit integers
+    template<typename T>
+    __m128i LoadComponents4(const uint8_t* source)
+    {
+        const __m128i zero = _mm_setzero_si128();
+
+        if constexpr (sizeof(T) == 1U)
+        {
+            int32_t bytes;
+            std::memcpy(&bytes, source, sizeof(bytes));
+
+            const __m128i components = _mm_cvtsi32_si128(bytes);
+
+            if constexpr (std::is_signed_v<T>)
+            {
+                // Duplicating each byte into all 4 bytes of its lane and then shifting right sign extends it
+                const __m128i duplicated = _mm_unpacklo_epi8(components, components);
+                return _mm_srai_epi32(_mm_unpacklo_epi16(duplicated, duplicated), 24);
+            }
+            else
+            {
+                return _mm_unpacklo_epi16(_mm_unpacklo_epi8(components, zero), zero);
+            }
+        }
+        else
+        {
+            const __m128i components = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(source));
+
+            if constexpr (std::is_signed_v<T>)
+            {
+                return _mm_srai_epi32(_mm_unpacklo_epi16(components, components), 16);
+            }
+            else
+            {
+                return _mm_unpacklo_epi16(components, zero);
+            }
+        }
+    }
+
+    // Loads 8 components and widens them to 32-bit integers
+    template<typename T>
+    GLTFSDK_TARGET_AVX2 __m256i LoadComponents8(const uint8_t* source)
+    {
+        if constexpr (std::is_same_v<T, int8_t>)
+        {
+            return _mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(source)));
+        }
+        else if constexpr (std::is_same_v<T, uint8_t>)
+        {
+            return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(source)));
+        }
+        else if constexpr (std::is_same_v<T, int16_t>)
+        {
+            return _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source)));
+        }
+        else
+        {
+            return _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source)));
+        }
+    }
+
+    // Normalization divides rather than multiplying by the reciprocal, so that the results are rounded exactly as
+    // ComponentToFloat's are
+    template<typename T>
+    size_t ComponentsToFloatsSSE2(const uint8_t* source, uint8_t* destination, size_t componentCount, bool normalized)
+    {
+        const __m128 scale = _mm_set1_ps(c_normalizationScale<T>);
+        const __m128 minimum = _mm_set1_ps(-1.0f);
+
+        size_t i = 0U;
+
+        for (; i + 4U <= componentCount; i += 4U)
+        {
+            __m128 values = _mm_cvtepi32_ps(LoadComponents4<T>(source + i * sizeof(T)));
+
+            if (normalized)
+            {
+                values = _mm_div_ps(values, scale);
+
+                if constexpr (std::is_signed_v<T>)
+                {
+                    values = _mm_max_ps(values, minimum);
+                }
+            }
+
+            _mm_storeu_ps(reinterpret_cast<float*>(destination + i * sizeof(float)), values);
+        }
+
+        return i;
+    }
+
+    template<typename T>
+    GLTFSDK_TARGET_AVX2 size_t ComponentsToFloatsAVX2(const uint8_t* source, uint8_t* destination, size_t componentCount, bool normalized)
+    {
+        const __m256 scale = _mm256_set1_ps(c_normalizationScale<T>);
+        const __m256 minimum = _mm256_set1_ps(-1.0f);
+
+        size_t i = 0U;
+
+        for (; i + 8U <= componentCount; i += 8U)
+        {
+            __m256 values = _mm256_cvtepi32_ps(LoadComponents8<T>(source + i * sizeof(T)));
+
+            if (normalized)
+            {
+                values = _mm256_div_ps(values, scale);
+
+                if constexpr (std::is_signed_v<T>)
+                {
+                    values = _mm256_max_ps(values, minimum);
+                }
+            }
+
+            _mm256_storeu_ps(reinterpret_cast<float*>(destination + i * sizeof(float)), values);
+        }
+
+        return i;
+    }
+#endif
+
+#if defined(GLTFSDK_SIMD_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+    // Loads 8 components and converts them to floats
+    template<typename T>
+    float32x4x2_t LoadComponentsNEON(const uint8_t* source)
+    {
+        float32x4x2_t values;
+
+        if constexpr (std::is_same_v<T, int8_t>)
+        {
+            const int16x8_t components = vmovl_s8(vld1_s8(reinterpret_cast<const int8_t*>(source)));
+            values.val[0] = vcvtq_f32_s32(vmovl_s16(vget_low_s16(components)));
+            values.val[1] = vcvtq_f32_s32(vmovl_s16(vget_high_s16(components)));
+        }
+        else if constexpr (std::is_same_v<T, uint8_t>)
+        {
+            const uint16x8_t components = vmovl_u8(vld1_u8(source));
+            values.val[0] = vcvtq_f32_u32(vmovl_u16(vget_low_u16(components)));
+            values.val[1] = vcvtq_f32_u32(vmovl_u16(vget_high_u16(components)));
+        }
+        else if constexpr (std::is_same_v<T, int16_t>)
+        {
+            const int16x8_t components = vld1q_s16(reinterpret_cast<const int16_t*>(source));
+            values.val[0] = vcvtq_f32_s32(vmovl_s16(vget_low_s16(components)));
+            values.val[1] = vcvtq_f32_s32(vmovl_s16(vget_high_s16(components)));
+        }
+        else
+        {
+            const uint16x8_t components = vld1q_u16(reinterpret_cast<const uint16_t*>(source));
+            values.val[0] = vcvtq_f32_u32(vmovl_u16(vget_low_u16(components)));
+            values.val[1] = vcvtq_f32_u32(vmovl_u16(vget_high_u16(components)));
+        }
+
+        return values;
+    }
+
+    template<typename T>
+    size_t ComponentsToFloatsNEON(const uint8_t* source, uint8_t* destination, size_t componentCount, bool normalized)
+    {
+        const float32x4_t scale = vdupq_n_f32(c_normalizationScale<T>);
+        const float32x4_t minimum = vdupq_n_f32(-1.0f);
+
+        size_t i = 0U;
+
+        for (; i + 8U <= componentCount; i += 8U)
+        {
+            float32x4x2_t values = LoadComponentsNEON<T>(source + i * sizeof(T));
+
+            for (auto& value : values.val)
+            {
+                if (normalized)
+                {
+                    value = vdivq_f32(value, scale);
+
+                    if constexpr (std::is_signed_v<T>)
+                    {
+                        value = vmaxq_f32(value, minimum);
+                    }
+                }
+            }
+
+            vst1q_f32(reinterpret_cast<float*>(destination + i * sizeof(float)), values.val[0]);
+            vst1q_f32(reinterpret_cast<float*>(destination + (i + 4U) * sizeof(float)), values.val[1]);
+        }
+
+        return i;
+    }
+#endif
+
+    // Converts as many leading components as possible with the fastest kernels the CPU supports, returns the number converted
+    template<typename T>
+    size_t ComponentsToFloatsVector(const uint8_t* source, uint8_t* destination, size_t componentCount, bool normalized)
+    {
+        size_t i = 0U;
+
+#ifdef GLTFSDK_SIMD_SSE2
+        if (GetSupportedCPUFeatures().isAVX2Supported)
+        {
+            i = ComponentsToFloatsAVX2<T>(source, destination, componentCount, normalized);
+        }
+
+        i += ComponentsToFloatsSSE2<T>(source + i * sizeof(T), destination + i * sizeof(float), componentCount - i, normalized);
+#elif defined(GLTFSDK_SIMD_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+        i = ComponentsToFloatsNEON<T>(source, destination, componentCount, normalized);
+#else
+        (void)source;
+        (void)destination;
+        (void)componentCount;
+        (void)normalized;
+#endif
+
+        return i;
+    }
+}
+
+void Microsoft::glTF::CopyStrided(const uint8_t* source, size_t sourceStride, uint8_t* destination, size_t destinationStride, size_t elementSize, size_t elementCount)
+{
+    if (sourceStride == elementSize && destinationStride == elementSize)
+    {
+        std::memcpy(destination, source, elementSize * elementCount);
+        return;
+    }
+
+    const size_t vectorCount = CopyStridedVector(source, sourceStride, destination, destinationStride, elementSize, elementCount);
+
+    CopyStridedScalar(
+        source + vectorCount * sourceStride,
+        sourceStride,
+        destination + vectorCount * destinationStride,
+        destinationStride,
+        elementSize,
+        elementCount - vectorCount);
+}
+
+void Microsoft::glTF::Base64Decode(Base64StringView encodedData, Base64BufferView decodedData, size_t bytesToSkip)
+{
+    if (encodedData.GetByteCount() != (decodedData.bufferByteLength + bytesToSkip))
+    {
+        throw GLTFException("The specified decode buffer's size is incorrect");
+    }
+
+    static const Base64DecodeTable decodeTable = GetFullDecodeTable();
+
+    const char* encoded = std::to_address(encodedData.itBegin);
+    const size_t groupCount = encodedData.GetCharCount() / 4U;
+
+    uint8_t* decoded = static_cast<uint8_t*>(decodedData.buffer);
+    uint8_t* const decodedEnd = decoded + decodedData.bufferByteLength;
+
+    uint8_t group[3];
+    size_t i = 0U;
+
+    // Groups that only contain skipped bytes must still be validated
+    for (; i < groupCount && bytesToSkip >= 3U; ++i, bytesToSkip -= 3U)
+    {
+        DecodeBase64Group(decodeTable, encoded + i * 4U, 4U, group);
+    }
+
+    if (i < groupCount && bytesToSkip > 0U)
+    {
+        DecodeBase64Group(decodeTable, encoded + i * 4U, 4U, group);
+
+        decoded = std::copy(group + bytesToSkip, group + 3U, decoded);
+        bytesToSkip = 0U;
+        ++i;
+    }
+
+    const size_t vectorCount = DecodeBase64Vector(encoded + i * 4U, groupCount - i, decoded, static_cast<size_t>(decodedEnd - decoded));
+
+    decoded += vectorCount * 3U;
+    i += vectorCount;
+
+    // Any groups the vector kernels didn't decode, including any containing an invalid character which throws here
+    for (; i < groupCount; ++i)
+    {
+        decoded += DecodeBase64Group(decodeTable, encoded + i * 4U, 4U, decoded);
+    }
+
+    if (const size_t remainder = encodedData.GetCharCount() % 4U)
+    {
+        const size_t byteCount = DecodeBase64Group(decodeTable, encoded + groupCount * 4U, remainder, group);
+
+        if (bytesToSkip < byteCount)
+        {
+            decoded = std::copy(group + bytesToSkip, group + byteCount, decoded);
+        }
+    }
+
+    assert(decoded == decodedEnd);
+}
+
+template<typename T>
+void Microsoft::glTF::ComponentsToFloats(const uint8_t* source, uint8_t* destination, size_t componentCount, bool normalized)
+{
+    // Trailing components that don't fill a whole vector are converted individually
+    for (size_t i = ComponentsToFloatsVector<T>(source, destination, componentCount, normalized); i < componentCount; ++i)
+    {
+        T component;
+        std::memcpy(&component, source + i * sizeof(T), sizeof(T));
+
+        const float value = normalized ? ComponentToFloat(component) : static_cast<float>(component);
+        std::memcpy(destination + i * sizeof(float), &value, sizeof(float));
+    }
+}
+
+template void Microsoft::glTF::ComponentsToFloats<int8_t>(const uint8_t*, uint8_t*, size_t, bool);
+template void Microsoft::glTF::ComponentsToFloats<uint8_t>(const uint8_t*, uint8_t*, size_t, bool);
+template void Microsoft::glTF::ComponentsToFloats<int16_t>(const uint8_t*, uint8_t*, size_t, bool);
+template void Microsoft::glTF::ComponentsToFloats<uint16_t>(const uint8_t*, uint8_t*, size_t, bool);
@@ -92,6 +92,13 @@ const std::unordered_map<std::string, std::string>& Microsoft::glTF::GetDefaultS
     return SchemaJson::GLTF_SCHEMA_MAP;
 }
 
+SchemaFlags Microsoft::glTF::GetSchemaFlag(const std::string& schemaUri)
+{
+    auto itFlag = schemaFlagMap.find(schemaUri);
+
+    return itFlag != schemaFlagMap.end() ? itFlag->second : SchemaFlags::None;
+}
+
 std::unique_ptr<const ISchemaLocator> Microsoft::glTF::GetDefaultSchemaLocator(SchemaFlags schemaFlags)
 {
     return std::make_unique<const DefaultSchemaLocator>(schemaFlags);
@@ -3,10 +3,287 @@
 
 #include <GLTFSDK/SchemaValidation.h>
 #include <GLTFSDK/Exceptions.h>
+#include "TopLevelArrays.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <string_view>
+#include <tuple>
 #include <unordered_map>
+#include <vector>
 #include <GLTFSDK/valijson_nlohmann_bundled.hpp>
 
+#ifdef GLTFSDK_NATIVE_SCHEMA_VALIDATION
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace NativeSchemaValidation
+        {
+            typedef bool (*ValidateFn)(const nlohmann::json& value, Context& context);
+
+            // The state of a native validation: the location of the value being validated and the first schema violation
+            // found, described the same way valijson describes it. The functions generated by GenerateSchemaValidator.cmake
+            // return false as soon as a value fails to validate, so the first violation recorded is the one reported.
+            class Context
+            {
+            public:
+                // Appends a property name or array index to the location of the value being validated for its lifetime
+                class Scope
+                {
+                public:
+                    Scope(Context& context, const std::string& name) : m_context(context)
+                    {
+                        context.m_path.push_back({ &name, 0U });
+                    }
+
+                    Scope(Context& context, size_t index) : m_context(context)
+                    {
+                        context.m_path.push_back({ nullptr, index });
+                    }
+
+                    ~Scope()
+                    {
+                        m_context.m_path.pop_back();
+                    }
+
+                private:
+                    Context& m_context;
+                };
+
+                Context(SchemaFlags schemaFlags, const std::string& rootContext) :
+                    m_schemaFlags(schemaFlags),
+                    m_rootContext(rootContext.empty() ? std::string_view("<root>") : std::string_view(rootContext)),
+                    m_countDepth(0U),
+                    m_failed(false)
+                {
+                }
+
+                bool IsDisabled(SchemaFlags schemaFlag) const
+                {
+                    return schemaFlag != SchemaFlags::None && (m_schemaFlags & schemaFlag) == schemaFlag;
+                }
+
+                // Records the violation at the current location and returns false. Violations found while only counting
+                // the subschemas a value matches are discarded without building their description.
+                bool Fail(const char* description)
+                {
+                    if (m_countDepth == 0U && !m_failed)
+                    {
+                        m_failed = true;
+                        m_errorContext = GetPath();
+                        m_errorDescription = description;
+                    }
+
+                    return false;
+                }
+
+                bool Fail(const std::string& description)
+                {
+                    return Fail(description.c_str());
+                }
+
+                bool Fail(const char* description, double value)
+                {
+                    return m_countDepth == 0U ? Fail(description + std::to_string(value)) : false;
+                }
+
+                // When no subschema matches, valijson reports the violations of the first one
+                bool AnyOf(const nlohmann::json& value, std::initializer_list<ValidateFn> schemas)
+                {
+                    return CountMatches(value, schemas, 1U) == 1U || Report(value, *schemas.begin());
+                }
+
+                bool OneOf(const nlohmann::json& value, std::initializer_list<ValidateFn> schemas)
+                {
+                    const size_t matchCount = CountMatches(value, schemas, 2U);
+
+                    if (matchCount == 0U)
+                    {
+                        return Report(value, *schemas.begin());
+                    }
+
+                    return matchCount == 1U || Fail("Failed to validate against exactly one child schema.");
+                }
+
+                bool Not(const nlohmann::json& value, ValidateFn schema)
+                {
+                    return CountMatches(value, { schema }, 1U) == 0U || Fail("Target should not validate against schema specified in 'not' constraint.");
+                }
+
+                bool UniqueItems(const nlohmann::json& value)
+                {
+                    if (value.is_array())
+                    {
+                        for (size_t i = 0U; i < value.size(); ++i)
+                        {
+                            for (size_t j = i + 1U; j < value.size(); ++j)
+                            {
+                                if (AreEqual(value[i], value[j]))
+                                {
+                                    return Fail("Elements at indexes #" + std::to_string(i) + " and #" + std::to_string(j) + " violate uniqueness constraint.");
+                                }
+                            }
+                        }
+                    }
+
+                    return true;
+                }
+
+                // As valijson, zero is a multiple of any divisor and doubles are truncated when the divisor is an integer
+                static bool IsMultipleOf(const nlohmann::json& value, int64_t divisor)
+                {
+                    if (!value.is_number())
+                    {
+                        return true;
+                    }
+
+                    const int64_t i = value.is_number_float() ? static_cast<int64_t>(value.get<double>()) : value.get<int64_t>();
+
+                    return i == 0 || i % divisor == 0;
+                }
+
+                static bool IsMultipleOf(const nlohmann::json& value, double divisor)
+                {
+                    if (!value.is_number())
+                    {
+                        return true;
+                    }
+
+                    const double d = value.get<double>();
+
+                    return d == 0.0 || std::fabs(std::remainder(d, divisor)) <= std::numeric_limits<double>::epsilon();
+                }
+
+                [[noreturn]] void ThrowViolation() const
+                {
+                    throw ValidationException("Schema violation at " + m_errorContext + " due to " + m_errorDescription);
+                }
+
+            private:
+                struct PathSegment
+                {
+                    const std::string* name;
+                    size_t index;
+                };
+
+                // Returns the number of schemas the value validates against, stopping once it reaches maxCount
+                size_t CountMatches(const nlohmann::json& value, std::initializer_list<ValidateFn> schemas, size_t maxCount)
+                {
+                    size_t count = 0U;
+
+                    ++m_countDepth;
+
+                    for (auto schema : schemas)
+                    {
+                        if (schema(value, *this) && ++count == maxCount)
+                        {
+                            break;
+                        }
+                    }
+
+                    --m_countDepth;
+
+                    return count;
+                }
+
+                // Validates the value against a schema it is known to fail, this time recording the violation
+                bool Report(const nlohmann::json& value, ValidateFn schema)
+                {
+                    if (m_countDepth == 0U)
+                    {
+                        schema(value, *this);
+                    }
+
+                    return false;
+                }
+
+                std::string GetPath() const
+                {
+                    std::string path(m_rootContext);
+
+                    for (const auto& segment : m_path)
+                    {
+                        path += '[';
+                        path += segment.name ? *segment.name : std::to_string(segment.index);
+                        path += ']';
+                    }
+
+                    return path;
+                }
+
+                // Equivalent to valijson's strict equalTo, numbers are equal if their values are regardless of type
+                static bool AreEqual(const nlohmann::json& lhs, const nlohmann::json& rhs)
+                {
+                    if (lhs.is_number() || rhs.is_number())
+                    {
+                        return lhs.is_number() && rhs.is_number() && lhs.get<double>() == rhs.get<double>();
+                    }
+
+                    if (lhs.type() != rhs.type() || lhs.size() != rhs.size())
+                    {
+                        return false;
+                    }
+
+                    if (lhs.is_array())
+                    {
+                        for (size_t i = 0U; i < lhs.size(); ++i)
+                        {
+                            if (!AreEqual(lhs[i], rhs[i]))
+                            {
+                                return false;
+                            }
+                        }
+
+                        return true;
+                    }
+
+                    if (lhs.is_object())
+                    {
+                        for (auto it = lhs.begin(); it != lhs.end(); ++it)
+                        {
+                            auto itOther = rhs.find(it.key());
+
+                            if (itOther == rhs.end() || !AreEqual(*it, *itOther))
+                            {
+                                return false;
+                            }
+                        }
+
+                        return true;
+                    }
+
+                    return lhs == rhs;
+                }
+
+                const SchemaFlags m_schemaFlags;
+                const std::string_view m_rootContext;
+
+                std::vector<PathSegment> m_path;
+                size_t m_countDepth;
+
+                bool m_failed;
+                std::string m_errorContext;
+                std::string m_errorDescription;
+            };
+
+            // Used by the generated code for subschemas without any constraints where a function is required
+            inline bool AcceptAny(const nlohmann::json&, Context&)
+            {
+                return true;
+            }
+        }
+    }
+}
+
+#include "SchemaValidatorNative.h" // Auto-generated header, don't include in any other translation units to avoid linker errors
+
+#endif
+
 using namespace Microsoft::glTF;
 
 namespace
@@ -14,71 +291,400 @@ namespace
     class RemoteSchemaDocumentProvider
     {
     public:
-        RemoteSchemaDocumentProvider(std::unique_ptr<const ISchemaLocator> schemaLocator) : schemaLocator(std::move(schemaLocator))
+        RemoteSchemaDocumentProvider(const ISchemaLocator& schemaLocator) : schemaLocator(schemaLocator)
         {
-            assert(this->schemaLocator);
         }
 
         nlohmann::json getJson(const std::string& uri) {
 
             try {
-                return nlohmann::json::parse(schemaLocator->GetSchemaContent(uri));
+                return nlohmann::json::parse(schemaLocator.GetSchemaContent(uri));
             }catch (...) {
                 throw GLTFException("Schema document at " + uri + " is not valid JSON");
             }
         }
 
-        valijson::Schema GetRemoteDocumentStr(const std::string& uri)
+        void GetRemoteDocumentStr(const std::string& uri, valijson::Schema& schema)
         {
-
-            valijson::Schema schema;
-
             try {
                 nlohmann::json document = getJson(uri);
                 valijson::SchemaParser parser(valijson::SchemaParser::kDraft4);
                 const valijson::adapters::NlohmannJsonAdapter schemaDocumentAdapter(document);
                 parser.populateSchema(schemaDocumentAdapter, schema, [this](const std::string &uri) {
-                    return new nlohmann::json(nlohmann::json::parse(schemaLocator->GetSchemaContent(uri)));;
+                    return new nlohmann::json(nlohmann::json::parse(schemaLocator.GetSchemaContent(uri)));;
                 },[](const nlohmann::json* json) {
                     delete json;
                 });
             }catch (...) {
                 throw GLTFException("Schema document at " + uri + " is not valid JSON");
             }
-
-            return schema;
         }
 
-        const std::unique_ptr<const ISchemaLocator> schemaLocator;
+        const ISchemaLocator& schemaLocator;
 
     private:
     };
+
+    // A cached schema, compiled by the first thread to request it while any others requesting it at the same time wait
+    struct SchemaCacheEntry
+    {
+        std::once_flag compiled;
+        std::shared_ptr<const SchemaValidator> validator;
+    };
+
+    template<typename CreateFn>
+    std::shared_ptr<const SchemaValidator> GetCompiledSchema(SchemaCacheEntry& entry, CreateFn&& create)
+    {
+        // If compilation throws, the exception propagates and the next caller tries again
+        std::call_once(entry.compiled, [&entry, &create]()
+        {
+            entry.validator = create();
+        });
+
+        return entry.validator;
+    }
+
+    struct LocatorSchemaCacheEntry : SchemaCacheEntry
+    {
+        std::weak_ptr<const ISchemaLocator> schemaLocator;
+    };
+
+    std::mutex schemaCacheMutex;
+    std::map<std::tuple<std::string, SchemaFlags, SchemaValidationEngine>, std::shared_ptr<SchemaCacheEntry>> defaultSchemaCache;
+    std::map<std::pair<std::string, const ISchemaLocator*>, std::shared_ptr<LocatorSchemaCacheEntry>> locatorSchemaCache;
+
+    bool IsSameOwner(const std::weak_ptr<const ISchemaLocator>& lhs, const std::shared_ptr<const ISchemaLocator>& rhs)
+    {
+        return !lhs.owner_before(rhs) && !rhs.owner_before(lhs);
+    }
+
+    // A top-level array of the manifest whose elements are validated against their own schema. These schemas aren't
+    // referenced anywhere else, so disabling them only stops the root schema from validating the array elements.
+    using ElementArraySchema = Detail::TopLevelArrayInfo;
+
+    constexpr const auto& elementArraySchemas = Detail::c_topLevelArrayInfos;
+
+    // A range of an array's elements validated by a single task, which stops at the first element that fails
+    struct ValidationChunk
+    {
+        const ElementArraySchema* array;
+        const nlohmann::json* elements;
+        const SchemaValidator* validator;
+        size_t begin;
+        size_t end;
+
+        size_t failedIndex = std::numeric_limits<size_t>::max();
+        std::string violation;
+    };
+
+    std::string GetElementContext(const ElementArraySchema& array, size_t index)
+    {
+        return "<root>[" + std::string(array.name) + "][" + std::to_string(index) + "]";
+    }
+
+    std::string GetViolation(const SchemaValidator& validator, const nlohmann::json& json, const std::string& rootContext)
+    {
+        try
+        {
+            validator.Validate(json, rootContext);
+        }
+        catch (const ValidationException& ex)
+        {
+            return ex.what();
+        }
+
+        return {};
+    }
 }
 
-void Microsoft::glTF::ValidateDocumentAgainstSchema(const nlohmann::json& document, const std::string& schemaUri, std::unique_ptr<const ISchemaLocator> schemaLocator)
+SchemaValidator::SchemaValidator(const std::string& schemaUri, SchemaFlags schemaFlags) :
+    m_nativeSchema(nullptr),
+    m_schemaFlags(schemaFlags)
+{
+#ifdef GLTFSDK_NATIVE_SCHEMA_VALIDATION
+    auto itSchema = NativeSchemaValidation::SCHEMA_VALIDATOR_MAP.find(schemaUri);
+
+    if (itSchema == NativeSchemaValidation::SCHEMA_VALIDATOR_MAP.end())
+    {
+        throw GLTFException("Unknown Schema uri " + schemaUri);
+    }
+
+    m_nativeSchema = itSchema->second;
+#else
+    m_schema = std::make_unique<valijson::Schema>();
+
+    auto schemaLocator = GetDefaultSchemaLocator(schemaFlags);
+    RemoteSchemaDocumentProvider provider(*schemaLocator);
+
+    provider.GetRemoteDocumentStr(schemaUri, *m_schema);
+#endif
+}
+
+SchemaValidator::SchemaValidator(const std::string& schemaUri, const ISchemaLocator& schemaLocator) :
+    m_schema(std::make_unique<valijson::Schema>()),
+    m_nativeSchema(nullptr),
+    m_schemaFlags(SchemaFlags::None)
+{
+    RemoteSchemaDocumentProvider provider(schemaLocator);
+
+    provider.GetRemoteDocumentStr(schemaUri, *m_schema);
+}
+
+SchemaValidator::SchemaValidator(const std::string& schemaUri, std::unique_ptr<const ISchemaLocator> schemaLocator) :
+    m_schema(std::make_unique<valijson::Schema>()),
+    m_nativeSchema(nullptr),
+    m_schemaFlags(SchemaFlags::None)
 {
     if (!schemaLocator)
     {
         throw GLTFException("ISchemaLocator instance must not be null");
     }
 
-    RemoteSchemaDocumentProvider provider(std::move(schemaLocator));
+    RemoteSchemaDocumentProvider provider(*schemaLocator);
+
+    provider.GetRemoteDocumentStr(schemaUri, *m_schema);
+}
 
-    const auto &schemaDocument = provider.GetRemoteDocumentStr(schemaUri);
+SchemaValidator::~SchemaValidator() = default;
+
+bool SchemaValidator::IsNative() const
+{
+    return m_nativeSchema != nullptr;
+}
+
+void SchemaValidator::Validate(const nlohmann::json& document, const std::string& rootContext) const
+{
+#ifdef GLTFSDK_NATIVE_SCHEMA_VALIDATION
+    if (m_nativeSchema)
+    {
+        NativeSchemaValidation::Context context(m_schemaFlags, rootContext);
+
+        if (!m_nativeSchema(document, context))
+        {
+            context.ThrowViolation();
+        }
+
+        return;
+    }
+#endif
 
     valijson::Validator validator(valijson::Validator::kStrongTypes);
     valijson::ValidationResults results;
     const valijson::adapters::NlohmannJsonAdapter targetDocumentAdapter(document);
-    if (!validator.validate(schemaDocument, targetDocumentAdapter, &results)) {
+    if (!validator.validate(*m_schema, targetDocumentAdapter, &results)) {
         valijson::ValidationResults::Error validationError;
         while (results.popError(validationError)) {
 
             std::string context;
             for (auto &itr: validationError.context) { context += itr; }
 
+            if (!rootContext.empty() && context.starts_with("<root>"))
+            {
+                context.replace(0U, 6U, rootContext);
+            }
+
             throw ValidationException("Schema violation at " + context + " due to " + validationError.description);
 
         }
     }
+}
+
+std::shared_ptr<const SchemaValidator> Microsoft::glTF::GetSchemaValidator(const std::string& schemaUri, SchemaFlags schemaFlags, SchemaValidationEngine schemaEngine)
+{
+    std::shared_ptr<SchemaCacheEntry> entry;
+
+    {
+        std::lock_guard<std::mutex> lock(schemaCacheMutex);
+
+        auto& cachedEntry = defaultSchemaCache[{ schemaUri, schemaFlags, schemaEngine }];
+
+        if (!cachedEntry)
+        {
+            cachedEntry = std::make_shared<SchemaCacheEntry>();
+        }
+
+        entry = cachedEntry;
+    }
+
+    return GetCompiledSchema(*entry, [&schemaUri, schemaFlags, schemaEngine]()
+    {
+        if (schemaEngine == SchemaValidationEngine::Native)
+        {
+            return std::make_shared<const SchemaValidator>(schemaUri, schemaFlags);
+        }
+
+        return std::make_shared<const SchemaValidator>(schemaUri, GetDefaultSchemaLocator(schemaFlags));
+    });
+}
+
+std::shared_ptr<const SchemaValidator> Microsoft::glTF::GetSchemaValidator(const std::string& schemaUri, const std::shared_ptr<const ISchemaLocator>& schemaLocator)
+{
+    if (!schemaLocator)
+    {
+        throw GLTFException("ISchemaLocator instance must not be null");
+    }
+
+    std::shared_ptr<LocatorSchemaCacheEntry> entry;
+
+    {
+        std::lock_guard<std::mutex> lock(schemaCacheMutex);
+
+        auto& cachedEntry = locatorSchemaCache[{ schemaUri, schemaLocator.get() }];
+
+        // A locator destroyed since the entry was cached may have been replaced by a new one at the same address
+        if (!cachedEntry || !IsSameOwner(cachedEntry->schemaLocator, schemaLocator))
+        {
+            std::erase_if(locatorSchemaCache, [](const auto& item) { return item.second && item.second->schemaLocator.expired(); });
+
+            auto& newEntry = locatorSchemaCache[{ schemaUri, schemaLocator.get() }];
+            newEntry = std::make_shared<LocatorSchemaCacheEntry>();
+            newEntry->schemaLocator = schemaLocator;
+
+            entry = newEntry;
+        }
+        else
+        {
+            entry = cachedEntry;
+        }
+    }
+
+    return GetCompiledSchema(*entry, [&schemaUri, &schemaLocator]()
+    {
+        return std::make_shared<const SchemaValidator>(schemaUri, *schemaLocator);
+    });
+}
+
+void Microsoft::glTF::ValidateDocumentAgainstSchema(const nlohmann::json& document, const std::string& schemaUri, SchemaFlags schemaFlags, SchemaValidationEngine schemaEngine)
+{
+    GetSchemaValidator(schemaUri, schemaFlags, schemaEngine)->Validate(document);
+}
+
+void Microsoft::glTF::ValidateDocumentAgainstSchema(const nlohmann::json& document, const std::string& schemaUri, std::unique_ptr<const ISchemaLocator> schemaLocator)
+{
+    SchemaValidator(schemaUri, std::move(schemaLocator)).Validate(document);
+}
+
+void Microsoft::glTF::ValidateDocumentAgainstSchema(const nlohmann::json& document, SchemaFlags schemaFlags, const IExecutor& executor, size_t chunkSize, SchemaValidationEngine schemaEngine)
+{
+    if ((schemaFlags & SchemaFlags::DisableSchemaRoot) == SchemaFlags::DisableSchemaRoot)
+    {
+        return;
+    }
+
+    chunkSize = std::max<size_t>(chunkSize, 1U);
+
+    std::vector<std::shared_ptr<const SchemaValidator>> validators;
+    std::vector<ValidationChunk> chunks;
+
+    SchemaFlags elementSchemaFlags = SchemaFlags::None;
+
+    if (document.is_object())
+    {
+        for (const auto& array : elementArraySchemas)
+        {
+            auto itArray = document.find(array.name);
+
+            if (itArray == document.end() || !itArray->is_array() || (schemaFlags & array.schemaFlag) == array.schemaFlag)
+            {
+                continue;
+            }
+
+            validators.push_back(GetSchemaValidator(array.schemaUri, schemaFlags, schemaEngine));
+            elementSchemaFlags |= array.schemaFlag;
+
+            for (size_t begin = 0U; begin < itArray->size(); begin += chunkSize)
+            {
+                chunks.push_back({
+                    .array = &array,
+                    .elements = &*itArray,
+                    .validator = validators.back().get(),
+                    .begin = begin,
+                    .end = std::min(begin + chunkSize, itArray->size()),
+                    .failedIndex = std::numeric_limits<size_t>::max(),
+                    .violation = {}
+                });
+            }
+        }
+    }
+
+    executor.ParallelFor(chunks.size(), [&chunks](size_t i)
+    {
+        auto& chunk = chunks[i];
+
+        for (size_t index = chunk.begin; index < chunk.end; ++index)
+        {
+            const auto& element = (*chunk.elements)[index];
+
+            // The element's location is only needed to describe a violation, so it is only built for failed elements
+            try
+            {
+                chunk.validator->Validate(element);
+            }
+            catch (const ValidationException&)
+            {
+                chunk.failedIndex = index;
+                chunk.violation = GetViolation(*chunk.validator, element, GetElementContext(*chunk.array, index));
+                break;
+            }
+        }
+    });
+
+    // Serial validation checks the root schema's properties in name order and each array's elements in index order,
+    // so the first of the failed elements in that order is the one it would find
+    const ValidationChunk* failedChunk = nullptr;
+
+    for (const auto& chunk : chunks)
+    {
+        if (chunk.failedIndex == std::numeric_limits<size_t>::max())
+        {
+            continue;
+        }
+
+        if (!failedChunk || std::string(chunk.array->name) < failedChunk->array->name || (chunk.array == failedChunk->array && chunk.failedIndex < failedChunk->failedIndex))
+        {
+            failedChunk = &chunk;
+        }
+    }
+
+    if (!failedChunk)
+    {
+        GetSchemaValidator(SCHEMA_URI_GLTF, schemaFlags | elementSchemaFlags, schemaEngine)->Validate(document);
+        return;
+    }
+
+    // A violation of the rest of the manifest may still precede the failed element, e.g. a missing dependency of the
+    // root object. Find out by validating a manifest reduced to just the failed element, where the other arrays keep
+    // their length but hold nulls that their disabled schemas accept.
+    const auto& failedElement = (*failedChunk->elements)[failedChunk->failedIndex];
+    const auto failedSchemaFlag = static_cast<std::underlying_type_t<SchemaFlags>>(failedChunk->array->schemaFlag);
+    const auto reducedSchemaFlags = schemaFlags | static_cast<SchemaFlags>(static_cast<std::underlying_type_t<SchemaFlags>>(elementSchemaFlags) & ~failedSchemaFlag);
+
+    nlohmann::json reducedDocument = nlohmann::json::object();
+
+    for (auto it = document.begin(); it != document.end(); ++it)
+    {
+        auto itArray = std::find_if(std::begin(elementArraySchemas), std::end(elementArraySchemas), [&it](const ElementArraySchema& array) { return it.key() == array.name; });
+
+        if (itArray == failedChunk->array)
+        {
+            reducedDocument[it.key()] = nlohmann::json::array({ failedElement });
+        }
+        else if (itArray != std::end(elementArraySchemas) && it->is_array() && (reducedSchemaFlags & itArray->schemaFlag) == itArray->schemaFlag)
+        {
+            reducedDocument[it.key()] = nlohmann::json::array_t(it->size());
+        }
+        else
+        {
+            reducedDocument[it.key()] = *it;
+        }
+    }
+
+    const auto reducedViolation = GetViolation(*GetSchemaValidator(SCHEMA_URI_GLTF, reducedSchemaFlags, schemaEngine), reducedDocument, {});
+
+    if (!reducedViolation.empty() && reducedViolation != GetViolation(*failedChunk->validator, failedElement, GetElementContext(*failedChunk->array, 0U)))
+    {
+        throw ValidationException(reducedViolation);
+    }
 
+    throw ValidationException(failedChunk->violation);
 }
@@ -4,11 +4,501 @@
 #include <GLTFSDK/Serialize.h>
 
 #include <GLTFSDK/Document.h>
+#include <GLTFSDK/Executor.h>
+
+#include "TopLevelArrays.h"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <iterator>
+#include <ostream>
+#include <sstream>
+#include <string_view>
+#include <vector>
 
 using namespace Microsoft::glTF;
 
+namespace {
+class ManifestWriter;
+
+// A top-level array of the manifest whose elements are serialized one at a time
+struct ElementArray {
+    const char* name;
+    size_t (*size)(const Document& document);
+    void (*writeElement)(const Document& document, size_t index, ManifestWriter& writer);
+};
+
+// Writes JSON in exactly the format nlohmann::json::dump(indentStep) does, one member or array element at a time, so
+// that the DOM of the whole manifest is never built. Note that Serialize has always passed an indent of 0 rather than
+// -1 when not pretty printing, i.e. values are still separated by newlines.
+class ManifestWriter {
+public:
+    ManifestWriter(std::ostream& output, unsigned int indentStep, unsigned int depth = 0U) :
+        output(output), serializer(nlohmann::detail::output_adapter<char>(output), ' '), indentStep(indentStep), depth(depth) {}
+
+    void StartContainer(char c) {
+        output.put(c);
+        output.put('\n');
+        ++depth;
+    }
+
+    void EndContainer(char c) {
+        --depth;
+        output.put('\n');
+        Indent();
+        output.put(c);
+    }
+
+    void Separator() {
+        output.write(",\n", 2);
+    }
+
+    void Key(std::string_view key) {
+        Indent();
+        String(key);
+        output.write(": ", 2);
+    }
+
+    // Values without a direct writer, e.g. extensions and extras, are dumped by nlohmann::json's own serializer at
+    // the current indentation
+    void Value(const nlohmann::json& value) {
+        serializer.dump(value, true, false, indentStep, depth * indentStep);
+    }
+
+    void Null() {
+        output.write("null", 4);
+    }
+
+    void Bool(bool value) {
+        value ? output.write("true", 4) : output.write("false", 5);
+    }
+
+    void Number(size_t value) {
+        char buffer[24];
+        const auto result = std::to_chars(std::begin(buffer), std::end(buffer), value);
+        output.write(buffer, result.ptr - buffer);
+    }
+
+    // Floats are widened to double and formatted by the same shortest round-trip conversion nlohmann::json uses
+    void Number(float value) {
+        if (!std::isfinite(value)) {
+            Null();
+            return;
+        }
+
+        char buffer[64];
+        const char* end = nlohmann::detail::to_chars(std::begin(buffer), std::end(buffer), static_cast<double>(value));
+        output.write(buffer, end - buffer);
+    }
+
+    // Strings of printable ASCII characters other than quotes and backslashes are written as they are, anything else
+    // is left to nlohmann::json to escape and validate as UTF-8
+    void String(std::string_view value) {
+        const bool isVerbatim = std::all_of(value.begin(), value.end(), [](char c) {
+            return c >= 0x20 && c != '"' && c != '\\';
+        });
+
+        if (!isVerbatim) {
+            Value(nlohmann::json(value));
+            return;
+        }
+
+        output.put('"');
+        output.write(value.data(), static_cast<std::streamsize>(value.size()));
+        output.put('"');
+    }
+
+    // Writes each element of the range with writeElement(element), an empty range is written as []
+    template<typename Range, typename Fn>
+    void Array(const Range& range, Fn&& writeElement) {
+        if (std::empty(range)) {
+            output.write("[]", 2);
+            return;
+        }
+
+        StartContainer('[');
+
+        bool isFirst = true;
+
+        for (const auto& element : range) {
+            if (!isFirst) Separator();
+            isFirst = false;
+
+            Indent();
+            writeElement(element);
+        }
+
+        EndContainer(']');
+    }
+
+    template<typename Range>
+    void Numbers(const Range& range) {
+        Array(range, [this](auto value) { Number(value); });
+    }
+
+    // Writes the elements [begin, end) of a top-level array, preceded by a separator unless begin is the first
+    void Elements(const Document& document, const ElementArray& array, size_t begin, size_t end) {
+        for (size_t index = begin; index < end; ++index) {
+            if (index > 0U) Separator();
+
+            Indent();
+            array.writeElement(document, index, *this);
+        }
+    }
+
+    unsigned int GetDepth() const { return depth; }
+
+private:
+    void Indent() {
+        const size_t length = depth * indentStep;
+
+        if (indentation.size() < length) indentation.resize(length, ' ');
+
+        output.write(indentation.data(), static_cast<std::streamsize>(length));
+    }
+
+    std::ostream& output;
+    nlohmann::detail::serializer<nlohmann::json> serializer;
+    std::string indentation;
+    const unsigned int indentStep;
+    unsigned int depth;
+};
+
+// Writes the members of an object, which must be passed in the order nlohmann::json would write them, i.e. sorted by
+// key. Like converting a property with nothing to serialize via to_json, an object without any members is null.
+class ObjectWriter {
+public:
+    explicit ObjectWriter(ManifestWriter& writer) : writer(writer) {}
+
+    ManifestWriter& Member(std::string_view key) {
+        memberCount++ == 0U ? writer.StartContainer('{') : writer.Separator();
+        writer.Key(key);
+        return writer;
+    }
+
+    void End() {
+        memberCount == 0U ? writer.Null() : writer.EndContainer('}');
+    }
+
+private:
+    ManifestWriter& writer;
+    size_t memberCount = 0U;
+};
+
+// The members of glTFProperty, see its to_json
+void WriteExtensions(ObjectWriter& object, const glTFProperty& property) {
+    nlohmann::json extensions;
+    property.serializeExtensions(extensions);
+
+    if (!extensions.is_null()) object.Member("extensions").Value(extensions);
+}
+
+void WriteExtras(ObjectWriter& object, const glTFProperty& property) {
+    if (!property.extras.empty()) object.Member("extras").Value(nlohmann::json::parse(property.extras));
+}
+
+void WriteName(ObjectWriter& object, const glTFChildOfRootProperty& property) {
+    if (!property.name.empty()) object.Member("name").String(property.name);
+}
+
+// The most numerous elements are written directly, matching their to_json and serialize member functions member for
+// member. Any other element is converted to an nlohmann::json and dumped.
+template<typename T>
+void WriteElement(ManifestWriter& writer, const Document&, const T& element) {
+    writer.Value(nlohmann::json(element));
+}
+
+void WriteElement(ManifestWriter& writer, const Document& document, const Accessor& accessor) {
+    ObjectWriter object(writer);
+
+    if (!accessor.bufferViewId.empty()) object.Member("bufferView").Number(document.bufferViews.GetIndex(accessor.bufferViewId));
+    if (accessor.byteOffset != 0U) object.Member("byteOffset").Number(accessor.byteOffset);
+    object.Member("componentType").Number(static_cast<size_t>(accessor.componentType));
+    object.Member("count").Number(accessor.count);
+    WriteExtensions(object, accessor);
+    WriteExtras(object, accessor);
+    if (!accessor.max.empty()) object.Member("max").Numbers(accessor.max);
+    if (!accessor.min.empty()) object.Member("min").Numbers(accessor.min);
+    WriteName(object, accessor);
+    if (accessor.normalized) object.Member("normalized").Bool(true);
+
+    if (const auto& sparse = accessor.sparse; sparse.count > 0U) {
+        ObjectWriter sparseObject(object.Member("sparse"));
+        sparseObject.Member("count").Number(sparse.count);
+
+        ObjectWriter indices(sparseObject.Member("indices"));
+        indices.Member("bufferView").Number(document.bufferViews.GetIndex(sparse.indicesBufferViewId));
+        if (sparse.indicesByteOffset != 0U) indices.Member("byteOffset").Number(sparse.indicesByteOffset);
+        indices.Member("componentType").Number(static_cast<size_t>(sparse.indicesComponentType));
+        indices.End();
+
+        ObjectWriter values(sparseObject.Member("values"));
+        values.Member("bufferView").Number(document.bufferViews.GetIndex(sparse.valuesBufferViewId));
+        if (sparse.valuesByteOffset != 0U) values.Member("byteOffset").Number(sparse.valuesByteOffset);
+        values.End();
+
+        sparseObject.End();
+    }
+
+    object.Member("type").String(Accessor::GetAccessorTypeName(accessor.type));
+    object.End();
+}
+
+void WriteElement(ManifestWriter& writer, const Document& document, const BufferView& bufferView) {
+    ObjectWriter object(writer);
+
+    object.Member("buffer").Number(document.buffers.GetIndex(bufferView.bufferId));
+    object.Member("byteLength").Number(bufferView.byteLength);
+    object.Member("byteOffset").Number(bufferView.byteOffset);
+    if (bufferView.byteStride) object.Member("byteStride").Number(bufferView.byteStride.Get());
+    WriteExtensions(object, bufferView);
+    WriteExtras(object, bufferView);
+    WriteName(object, bufferView);
+    if (bufferView.target) object.Member("target").Number(static_cast<size_t>(bufferView.target.Get()));
+    object.End();
+}
+
+void WriteMorphTarget(ManifestWriter& writer, const Document& document, const MorphTarget& target) {
+    ObjectWriter object(writer);
+
+    if (!target.normalsAccessorId.empty()) object.Member(ACCESSOR_NORMAL).Number(document.accessors.GetIndex(target.normalsAccessorId));
+    if (!target.positionsAccessorId.empty()) object.Member(ACCESSOR_POSITION).Number(document.accessors.GetIndex(target.positionsAccessorId));
+    if (!target.tangentsAccessorId.empty()) object.Member(ACCESSOR_TANGENT).Number(document.accessors.GetIndex(target.tangentsAccessorId));
+    object.End();
+}
+
+void WriteMeshPrimitive(ManifestWriter& writer, const Document& document, const MeshPrimitive& primitive) {
+    ObjectWriter object(writer);
+
+    if (!primitive.attributes.empty()) {
+        std::vector<const std::pair<const std::string, std::string>*> attributes;
+        attributes.reserve(primitive.attributes.size());
+
+        for (const auto& attribute : primitive.attributes) attributes.push_back(&attribute);
+
+        std::sort(attributes.begin(), attributes.end(), [](auto lhs, auto rhs) { return lhs->first < rhs->first; });
+
+        ObjectWriter attributesObject(object.Member("attributes"));
+
+        for (const auto* attribute : attributes) {
+            attributesObject.Member(attribute->first).Number(document.accessors.GetIndex(attribute->second));
+        }
+
+        attributesObject.End();
+    }
+
+    WriteExtensions(object, primitive);
+    WriteExtras(object, primitive);
+    if (!primitive.indicesAccessorId.empty()) object.Member("indices").Number(document.accessors.GetIndex(primitive.indicesAccessorId));
+    if (!primitive.materialId.empty()) object.Member("material").Number(document.materials.GetIndex(primitive.materialId));
+    if (primitive.mode != MESH_TRIANGLES) object.Member("mode").Number(static_cast<size_t>(primitive.mode));
+
+    if (!primitive.targets.empty()) {
+        object.Member("targets").Array(primitive.targets, [&](const MorphTarget& target) { WriteMorphTarget(writer, document, target); });
+    }
+
+    object.End();
+}
+
+void WriteElement(ManifestWriter& writer, const Document& document, const Mesh& mesh) {
+    ObjectWriter object(writer);
+
+    WriteExtensions(object, mesh);
+    WriteExtras(object, mesh);
+    WriteName(object, mesh);
+    object.Member("primitives").Array(mesh.primitives, [&](const MeshPrimitive& primitive) { WriteMeshPrimitive(writer, document, primitive); });
+    if (!mesh.weights.empty()) object.Member("weights").Numbers(mesh.weights);
+    object.End();
+}
+
+void WriteElement(ManifestWriter& writer, const Document& document, const Node& node) {
+    if (!node.HasValidTransformType()) {
+        throw DocumentException("Node " + node.id + " doesn't have a valid transform type");
+    }
+
+    const auto transformationType = node.GetTransformationType();
+    const bool isTRS = transformationType == TRANSFORMATION_TRS;
+
+    ObjectWriter object(writer);
+
+    if (!node.cameraId.empty()) object.Member("camera").Number(document.cameras.GetIndex(node.cameraId));
+
+    if (!node.children.empty()) {
+        object.Member("children").Array(node.children, [&](const std::string& child) { writer.Number(document.nodes.GetIndex(child)); });
+    }
+
+    WriteExtensions(object, node);
+    WriteExtras(object, node);
+
+    // Node::serialize writes the morph target weights, when there are any, as the matrix
+    if (!node.weights.empty()) {
+        object.Member("matrix").Numbers(node.weights);
+    } else if (transformationType == TRANSFORMATION_MATRIX) {
+        object.Member("matrix").Numbers(node.matrix.values);
+    }
+
+    if (!node.meshId.empty()) object.Member("mesh").Number(document.meshes.GetIndex(node.meshId));
+    WriteName(object, node);
+
+    if (isTRS && node.rotation != Quaternion::IDENTITY) {
+        object.Member("rotation").Numbers(std::array<float, 4>{node.rotation.x, node.rotation.y, node.rotation.z, node.rotation.w});
+    }
+
+    if (isTRS && node.scale != Vector3::ONE) {
+        object.Member("scale").Numbers(std::array<float, 3>{node.scale.x, node.scale.y, node.scale.z});
+    }
+
+    if (!node.skinId.empty()) object.Member("skin").Number(document.skins.GetIndex(node.skinId));
+
+    if (isTRS && node.translation != Vector3::ZERO) {
+        object.Member("translation").Numbers(std::array<float, 3>{node.translation.x, node.translation.y, node.translation.z});
+    }
+
+    object.End();
+}
+
+template<size_t I>
+const auto& GetContainer(const Document& document) {
+    return document.*std::get<I>(Detail::c_topLevelArrays).container;
+}
+
+template<size_t I>
+size_t GetElementCount(const Document& document) {
+    return GetContainer<I>(document).Size();
+}
+
+template<size_t I>
+void WriteElementAt(const Document& document, size_t index, ManifestWriter& writer) {
+    WriteElement(writer, document, GetContainer<I>(document)[index]);
+}
+
+constexpr auto c_elementArrays = Detail::MakeTopLevelArrayTable<ElementArray>([](auto i) -> ElementArray {
+    return {std::get<i>(Detail::c_topLevelArrays).name, &GetElementCount<i>, &WriteElementAt<i>};
+});
+
+// The root object's members in the order nlohmann::json would write them, i.e. sorted by key. Each member is either
+// one of the document's properties or a non-empty top-level array.
+struct Member {
+    std::string key;
+    const nlohmann::json* value;
+    const ElementArray* array;
+    size_t elementCount;
+};
+
+std::vector<Member> GetMembers(const Document& document, const nlohmann::json& properties) {
+    std::vector<Member> members;
+
+    for (const auto& property : properties.items()) {
+        members.push_back({property.key(), &property.value(), nullptr, 0U});
+    }
+
+    for (const auto& array : c_elementArrays) {
+        if (const size_t elementCount = array.size(document); elementCount > 0U) members.push_back({array.name, nullptr, &array, elementCount});
+    }
+
+    std::sort(members.begin(), members.end(), [](const Member& lhs, const Member& rhs) { return lhs.key < rhs.key; });
+
+    return members;
+}
+
+nlohmann::json GetProperties(const Document& document) {
+    nlohmann::json properties;
+    nlohmann::to_json(properties, static_cast<const glTFProperty&>(document));
+    document.serializeProperties(properties);
+    return properties;
+}
+
+// Writes the manifest, calling writeElements to write the contents of each top-level array
+template<typename Fn>
+void WriteManifest(const std::vector<Member>& members, ManifestWriter& writer, Fn&& writeElements) {
+    writer.StartContainer('{');
+
+    for (size_t i = 0U; i < members.size(); ++i) {
+        const auto& member = members[i];
+
+        if (i > 0U) writer.Separator();
+
+        writer.Key(member.key);
+
+        if (member.value) {
+            writer.Value(*member.value);
+            continue;
+        }
+
+        writer.StartContainer('[');
+        writeElements(i);
+        writer.EndContainer(']');
+    }
+
+    writer.EndContainer('}');
+}
+}
+
 std::string Serializer::Serialize(const std::shared_ptr<Document> &gltfDocument, bool pPretty) {
     nlohmann::json json = gltfDocument;
     return json.dump(pPretty ? 4 : 0);
 }
 
+void Serializer::Serialize(const Document& gltfDocument, std::ostream& stream, bool pPretty) {
+    const auto properties = GetProperties(gltfDocument);
+    const auto members = GetMembers(gltfDocument, properties);
+
+    ManifestWriter writer(stream, pPretty ? 4U : 0U);
+
+    WriteManifest(members, writer, [&](size_t i) {
+        writer.Elements(gltfDocument, *members[i].array, 0U, members[i].elementCount);
+    });
+}
+
+void Serializer::Serialize(const Document& gltfDocument, std::ostream& stream, const IExecutor& executor, bool pPretty, size_t chunkSize) {
+    if (chunkSize == 0U) {
+        throw GLTFException("The serialization chunk size must be greater than zero");
+    }
+
+    const auto properties = GetProperties(gltfDocument);
+    const auto members = GetMembers(gltfDocument, properties);
+
+    struct Fragment {
+        const Member* member;
+        size_t begin;
+        size_t end;
+        std::string json;
+    };
+
+    std::vector<Fragment> fragments;
+    std::vector<size_t> memberFragments(members.size() + 1U); // The index of each member's first fragment
+
+    for (size_t i = 0U; i < members.size(); ++i) {
+        memberFragments[i] = fragments.size();
+
+        for (size_t begin = 0U; begin < members[i].elementCount; begin += chunkSize) {
+            fragments.push_back({&members[i], begin, std::min(begin + chunkSize, members[i].elementCount), {}});
+        }
+    }
+
+    memberFragments.back() = fragments.size();
+
+    const unsigned int indentStep = pPretty ? 4U : 0U;
+
+    // The elements are at depth 2, within the root object and their array
+    executor.ParallelFor(fragments.size(), [&](size_t i) {
+        auto& fragment = fragments[i];
+
+        std::ostringstream json;
+
+        ManifestWriter writer(json, indentStep, 2U);
+        writer.Elements(gltfDocument, *fragment.member->array, fragment.begin, fragment.end);
+
+        fragment.json = std::move(json).str();
+    });
+
+    ManifestWriter writer(stream, indentStep);
+
+    WriteManifest(members, writer, [&](size_t i) {
+        for (size_t fragment = memberFragments[i]; fragment < memberFragments[i + 1U]; ++fragment) {
+            stream.write(fragments[fragment].json.data(), fragments[fragment].json.size());
+        }
+    });
+}
@@ -0,0 +1,119 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/Deserialize.h>
+#include <GLTFSDK/Document.h>
+#include <GLTFSDK/Schema.h>
+
+#include <array>
+#include <tuple>
+#include <utility>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Detail
+        {
+            // What is known about each of the manifest's top-level arrays independently of the element type
+            struct TopLevelArrayInfo
+            {
+                const char* name;
+                const char* schemaUri;
+                SchemaFlags schemaFlag;
+                DocumentCollections collection;
+                size_t DocumentSummary::* summaryCount;
+            };
+
+            template<typename T>
+            struct TopLevelArray : TopLevelArrayInfo
+            {
+                using ElementType = T;
+
+                IndexedContainer<const T> Document::* container;
+            };
+
+            template<typename T>
+            constexpr TopLevelArray<T> MakeTopLevelArray(const char* name, const char* schemaUri, SchemaFlags schemaFlag, DocumentCollections collection, size_t DocumentSummary::* summaryCount, IndexedContainer<const T> Document::* container)
+            {
+                return { { name, schemaUri, schemaFlag, collection, summaryCount }, container };
+            }
+
+            // The single list of the manifest's top-level arrays. Deserialization, serialization, schema validation,
+            // Deserializer::Peek and Document's reference remapping all derive their per-array tables from it, so an
+            // array added here is handled by all of them.
+            constexpr auto c_topLevelArrays = std::make_tuple(
+                MakeTopLevelArray("accessors", SCHEMA_URI_ACCESSOR, SchemaFlags::DisableSchemaAccessor, DocumentCollections::Accessors, &DocumentSummary::accessorCount, &Document::accessors),
+                MakeTopLevelArray("animations", SCHEMA_URI_ANIMATION, SchemaFlags::DisableSchemaAnimation, DocumentCollections::Animations, &DocumentSummary::animationCount, &Document::animations),
+                MakeTopLevelArray("buffers", SCHEMA_URI_BUFFER, SchemaFlags::DisableSchemaBuffer, DocumentCollections::Buffers, &DocumentSummary::bufferCount, &Document::buffers),
+                MakeTopLevelArray("bufferViews", SCHEMA_URI_BUFFERVIEW, SchemaFlags::DisableSchemaBufferView, DocumentCollections::BufferViews, &DocumentSummary::bufferViewCount, &Document::bufferViews),
+                MakeTopLevelArray("cameras", SCHEMA_URI_CAMERA, SchemaFlags::DisableSchemaCamera, DocumentCollections::Cameras, &DocumentSummary::cameraCount, &Document::cameras),
+                MakeTopLevelArray("images", SCHEMA_URI_IMAGE, SchemaFlags::DisableSchemaImage, DocumentCollections::Images, &DocumentSummary::imageCount, &Document::images),
+                MakeTopLevelArray("materials", SCHEMA_URI_MATERIAL, SchemaFlags::DisableSchemaMaterial, DocumentCollections::Materials, &DocumentSummary::materialCount, &Document::materials),
+                MakeTopLevelArray("meshes", SCHEMA_URI_MESH, SchemaFlags::DisableSchemaMesh, DocumentCollections::Meshes, &DocumentSummary::meshCount, &Document::meshes),
+                MakeTopLevelArray("nodes", SCHEMA_URI_NODE, SchemaFlags::DisableSchemaNode, DocumentCollections::Nodes, &DocumentSummary::nodeCount, &Document::nodes),
+                MakeTopLevelArray("samplers", SCHEMA_URI_SAMPLER, SchemaFlags::DisableSchemaSampler, DocumentCollections::Samplers, &DocumentSummary::samplerCount, &Document::samplers),
+                MakeTopLevelArray("scenes", SCHEMA_URI_SCENE, SchemaFlags::DisableSchemaScene, DocumentCollections::Scenes, &DocumentSummary::sceneCount, &Document::scenes),
+                MakeTopLevelArray("skins", SCHEMA_URI_SKIN, SchemaFlags::DisableSchemaSkin, DocumentCollections::Skins, &DocumentSummary::skinCount, &Document::skins),
+                MakeTopLevelArray("textures", SCHEMA_URI_TEXTURE, SchemaFlags::DisableSchemaTexture, DocumentCollections::Textures, &DocumentSummary::textureCount, &Document::textures));
+
+            constexpr size_t TopLevelArrayCount = std::tuple_size_v<decltype(c_topLevelArrays)>;
+
+            // Builds a table with an entry per top-level array, fn is called with each index as a
+            // std::integral_constant so that it can be used to instantiate templates
+            template<typename Entry, typename Fn>
+            constexpr std::array<Entry, TopLevelArrayCount> MakeTopLevelArrayTable(Fn&& fn)
+            {
+                return [&fn]<size_t... I>(std::index_sequence<I...>)
+                {
+                    return std::array<Entry, TopLevelArrayCount>{ fn(std::integral_constant<size_t, I>())... };
+                }(std::make_index_sequence<TopLevelArrayCount>());
+            }
+
+            // The type independent part of each entry of c_topLevelArrays, in the same order
+            constexpr auto c_topLevelArrayInfos = MakeTopLevelArrayTable<TopLevelArrayInfo>([](auto i) -> TopLevelArrayInfo
+            {
+                return std::get<i>(c_topLevelArrays);
+            });
+
+            // Calls fn with each top-level array's entry of c_topLevelArrays in turn
+            template<typename Fn>
+            void ForEachTopLevelArray(Fn&& fn)
+            {
+                std::apply([&fn](const auto&... arrays) { (fn(arrays), ...); }, c_topLevelArrays);
+            }
+
+            template<typename Result, size_t I, typename TDocument, typename Fn>
+            Result VisitContainerAt(TDocument& document, DocumentCollections collection, Fn& fn)
+            {
+                if constexpr (I == TopLevelArrayCount)
+                {
+                    throw GLTFException("Expected a single top-level array");
+                }
+                else
+                {
+                    const auto& array = std::get<I>(c_topLevelArrays);
+
+                    if (array.collection == collection)
+                    {
+                        return fn(document.*array.container);
+                    }
+
+                    return VisitContainerAt<Result, I + 1U>(document, collection, fn);
+                }
+            }
+
+            // Calls fn with the document's IndexedContainer for a single collection and returns its result, which
+            // must be of the same type for every container
+            template<typename TDocument, typename Fn>
+            decltype(auto) VisitContainer(TDocument& document, DocumentCollections collection, Fn&& fn)
+            {
+                using Result = std::invoke_result_t<Fn&, decltype((document.accessors))>;
+
+                return VisitContainerAt<Result, 0U>(document, collection, fn);
+            }
+        }
+    }
+}